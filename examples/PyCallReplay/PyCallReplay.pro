@@ -0,0 +1,22 @@
+# --------- PyCallReplay profile -------------------
+# Last changed by $Author: agent $
+# $Id$
+# $Source$
+# --------------------------------------------------
+
+TARGET   = PyCallReplay
+TEMPLATE = app
+
+mac:CONFIG -= app_bundle
+CONFIG += console
+
+DESTDIR           = ../../lib
+
+QT += widgets
+
+include ( ../../build/common.prf )  
+include ( ../../build/PythonQt.prf )  
+include ( ../../build/PythonQt_QtAll.prf )  
+
+SOURCES +=                    \
+  main.cpp        
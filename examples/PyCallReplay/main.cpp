@@ -0,0 +1,125 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    main.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+// Replays the calls that an application recorded with PythonQtCallRecorder (or PythonQt.Debug.startCallRecording())
+// against stub objects and prints the latency of PythonQt's binding layer per signature:
+//
+//   PyCallReplay [-n REPETITIONS] [--top N] RECORDING
+//
+// The application's classes are not needed, the stubs only have the recorded signatures.
+// Argument types that are unknown to PythonQt and the Qt wrappers are reported as failures.
+
+#include "PythonQt.h"
+#include "PythonQt_QtAll.h"
+#include "PythonQtCallRecorder.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+
+#include <iostream>
+
+static const char* kindName(PythonQtRecordedCall::Kind kind)
+{
+  switch (kind) {
+  case PythonQtRecordedCall::SlotCall: return "slot";
+  case PythonQtRecordedCall::SignalDispatch: return "signal";
+  case PythonQtRecordedCall::VirtualCall: return "virtual";
+  }
+  return "";
+}
+
+int main( int argc, char **argv )
+{
+  QApplication app(argc, argv);
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Replays a PythonQt call recording and reports the latency per signature.");
+  parser.addHelpOption();
+  QCommandLineOption repetitionsOption("n", "Number of times the recording is replayed (default: 10).", "REPETITIONS", "10");
+  QCommandLineOption topOption("top", "Only print the N signatures with the highest total time.", "N", "-1");
+  parser.addOption(repetitionsOption);
+  parser.addOption(topOption);
+  parser.addPositionalArgument("recording", "File that was written by PythonQtCallRecorder::save().", "RECORDING");
+  parser.process(app);
+
+  if (parser.positionalArguments().size() != 1) {
+    parser.showHelp(1);
+  }
+  QList<PythonQtRecordedCall> calls;
+  if (!PythonQtCallRecorder::load(parser.positionalArguments().at(0), calls)) {
+    std::cerr << "could not read recording " << parser.positionalArguments().at(0).toLocal8Bit().constData() << std::endl;
+    return 1;
+  }
+
+  PythonQt::init(PythonQt::IgnoreSiteModule);
+  PythonQt_QtAll::init();
+
+  const int repetitions = qMax(parser.value(repetitionsOption).toInt(), 1);
+  const QList<PythonQtReplayStatistics> statistics = PythonQtCallReplay::replay(calls, repetitions);
+
+  std::cout << calls.size() << " recorded calls, replayed " << repetitions << " times" << std::endl;
+  std::cout << "kind     calls  failures  mean us   min us   max us  signature" << std::endl;
+  int top = parser.value(topOption).toInt();
+  int failed = 0;
+  for (int i = 0; i < statistics.size(); i++) {
+    const PythonQtReplayStatistics& entry = statistics.at(i);
+    failed += entry.failures;
+    if (top >= 0 && i >= top) {
+      continue;
+    }
+    const double mean = entry.calls ? entry.totalNs / 1000. / entry.calls : 0.;
+    std::cout << QString("%1 %2 %3 %4 %5 %6  ")
+                 .arg(QString::fromLatin1(kindName(entry.kind)), -7)
+                 .arg(entry.calls, 6)
+                 .arg(entry.failures, 9)
+                 .arg(mean, 8, 'f', 2)
+                 .arg(entry.minNs / 1000., 8, 'f', 2)
+                 .arg(entry.maxNs / 1000., 8, 'f', 2).toLocal8Bit().constData()
+              << entry.className.constData() << (entry.className.isEmpty() ? "" : "::")
+              << entry.signature.constData() << std::endl;
+  }
+  if (failed) {
+    std::cout << failed << " calls could not be replayed, their argument or return types are unknown to PythonQt" << std::endl;
+  }
+
+  PythonQt::cleanup();
+  return 0;
+}
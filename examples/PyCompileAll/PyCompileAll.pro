@@ -0,0 +1,19 @@
+# --------- PyCompileAll profile -------------------
+# Last changed by $Author: agent $
+# $Id$
+# $Source$
+# --------------------------------------------------
+
+TARGET   = PyCompileAll
+TEMPLATE = app
+
+mac:CONFIG -= app_bundle
+CONFIG += console
+
+DESTDIR           = ../../lib
+
+include ( ../../build/common.prf )  
+include ( ../../build/PythonQt.prf )  
+
+SOURCES +=                    \
+  main.cpp        
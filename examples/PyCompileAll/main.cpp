@@ -0,0 +1,115 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    main.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+// Compiles a tree of Python sources ahead of time, e.g. after installing an application:
+//
+//   PyCompileAll [-j N] [--cache-dir DIR] [--resources FILE.rcc] PATH...
+//
+// PATH may be a directory, a single file or a resource path like ":/scripts" of a registered
+// rcc file. Sources that can't have a pyc file next to them are written into the cache directory,
+// which the application has to pass to PythonQt::setBytecodeCacheDirectory() as well.
+
+#include "PythonQt.h"
+#include "PythonQtBytecodeCompiler.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QResource>
+
+#include <iostream>
+
+int main( int argc, char **argv )
+{
+  QCoreApplication app(argc, argv);
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Compiles Python sources to pyc files using the PythonQt importer.");
+  parser.addHelpOption();
+  QCommandLineOption threadsOption("j", "Number of worker threads (default: number of cores).", "N", "0");
+  QCommandLineOption cacheDirOption("cache-dir", "Bytecode cache directory for sources that can't have a pyc file next to them.", "DIR");
+  QCommandLineOption resourcesOption("resources", "Registers an rcc file, so that its resource paths can be compiled.", "FILE");
+  parser.addOption(threadsOption);
+  parser.addOption(cacheDirOption);
+  parser.addOption(resourcesOption);
+  parser.addPositionalArgument("paths", "Source files or directories to compile.", "PATH...");
+  parser.process(app);
+
+  const QStringList paths = parser.positionalArguments();
+  if (paths.isEmpty()) {
+    parser.showHelp(1);
+  }
+  Q_FOREACH(const QString& rccFile, parser.values(resourcesOption)) {
+    if (!QResource::registerResource(rccFile)) {
+      std::cerr << "could not register resource file " << rccFile.toLocal8Bit().constData() << std::endl;
+      return 1;
+    }
+  }
+
+  PythonQt::setEnableThreadSupport(true);
+  PythonQt::init(PythonQt::IgnoreSiteModule);
+  if (parser.isSet(cacheDirOption) &&
+      !PythonQt::self()->setBytecodeCacheDirectory(parser.value(cacheDirOption))) {
+    return 1;
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+  const QList<PythonQtCompiledFile> results = PythonQtBytecodeCompiler::compileTree(paths, parser.value(threadsOption).toInt());
+  const qint64 elapsed = timer.elapsed();
+
+  int failed = 0;
+  Q_FOREACH(const PythonQtCompiledFile& result, results) {
+    if (result.ok) {
+      std::cout << QString::number(result.milliseconds, 'f', 1).toLocal8Bit().constData() << " ms  "
+                << result.sourcePath.toLocal8Bit().constData() << std::endl;
+    } else {
+      failed++;
+      std::cerr << "FAILED " << result.sourcePath.toLocal8Bit().constData() << ": "
+                << result.error.toLocal8Bit().constData() << std::endl;
+    }
+  }
+  std::cout << "compiled " << (results.size() - failed) << " of " << results.size() << " files in "
+            << elapsed << " ms" << std::endl;
+
+  PythonQt::cleanup();
+  return failed ? 2 : 0;
+}
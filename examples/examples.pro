@@ -6,4 +6,6 @@ SUBDIRS = CPPPyWrapperExample \
           PyGuiExample \
           PyDecoratorsExample \
           PyScriptingConsole \
-          PyLauncher
+          PyLauncher \
+          PyCompileAll \
+          PyCallReplay
@@ -33,6 +33,7 @@
 #include "PythonQt_QtAll.h"
 
 #include "PythonQt.h"
+#include "PythonQtStartupProfile.h"
 
 #ifdef PYTHONQT_WITH_GUI
 void PythonQt_init_QtGui(PyObject*);
@@ -75,47 +76,54 @@ void PythonQt_init_QtUiTools(PyObject*);
 void PythonQt_init_QtWebKit(PyObject*);
 #endif
 
+//! initializes the given package as its own startup phase
+#define PYTHONQT_QTALL_INIT(name) { PythonQtStartupPhaseScope phase("PythonQt_init_" #name); PythonQt_init_##name(0); }
+
 namespace PythonQt_QtAll
 {
   PYTHONQT_QTALL_EXPORT void init() {
+    PythonQtStartupPhaseScope phase("PythonQt_QtAll::init");
+    // classes may be registered on first use, see PythonQt::setDeferredClassRegistration()
+    PythonQt::priv()->beginDeferredRegistration();
 #ifdef PYTHONQT_WITH_CORE
-    PythonQt_init_QtCore(0);
+    PYTHONQT_QTALL_INIT(QtCore)
 #endif
 #ifdef PYTHONQT_WITH_NETWORK
-    PythonQt_init_QtNetwork(0);
+    PYTHONQT_QTALL_INIT(QtNetwork)
 #endif
 #ifdef PYTHONQT_WITH_GUI
-    PythonQt_init_QtGui(0);
+    PYTHONQT_QTALL_INIT(QtGui)
 #endif
 #ifdef PYTHONQT_WITH_XML
-    PythonQt_init_QtXml(0);
+    PYTHONQT_QTALL_INIT(QtXml)
 #endif
 #ifdef PYTHONQT_WITH_SVG
-    PythonQt_init_QtSvg(0);
+    PYTHONQT_QTALL_INIT(QtSvg)
 #endif
 #ifdef PYTHONQT_WITH_SQL
-    PythonQt_init_QtSql(0);
+    PYTHONQT_QTALL_INIT(QtSql)
 #endif
 #ifdef PYTHONQT_WITH_WEBKIT
-    PythonQt_init_QtWebKit(0);
+    PYTHONQT_QTALL_INIT(QtWebKit)
 #endif
 #ifdef PYTHONQT_WITH_OPENGL
-    PythonQt_init_QtOpenGL(0);
+    PYTHONQT_QTALL_INIT(QtOpenGL)
 #endif
 #ifdef PYTHONQT_WITH_XMLPATTERNS
-    PythonQt_init_QtXmlPatterns(0);
+    PYTHONQT_QTALL_INIT(QtXmlPatterns)
 #endif
 #ifdef PYTHONQT_WITH_MULTIMEDIA
-    PythonQt_init_QtMultimedia(0);
+    PYTHONQT_QTALL_INIT(QtMultimedia)
 #endif
 #ifdef PYTHONQT_WITH_QML
-    PythonQt_init_QtQml(0);
+    PYTHONQT_QTALL_INIT(QtQml)
 #endif
 #ifdef PYTHONQT_WITH_QUICK
-    PythonQt_init_QtQuick(0);
+    PYTHONQT_QTALL_INIT(QtQuick)
 #endif
 #ifdef PYTHONQT_WITH_UITOOLS
-    PythonQt_init_QtUiTools(0);
+    PYTHONQT_QTALL_INIT(QtUiTools)
 #endif
+    PythonQt::priv()->endDeferredRegistration();
   }
 }
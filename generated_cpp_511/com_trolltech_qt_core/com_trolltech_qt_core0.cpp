@@ -48,7 +48,7 @@ PythonQtShell_QAbstractAnimation::~PythonQtShell_QAbstractAnimation() {
 void PythonQtShell_QAbstractAnimation::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -70,7 +70,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -92,7 +92,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractAnimation::duration() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::duration")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("duration");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -125,7 +125,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractAnimation::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -158,7 +158,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractAnimation::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -191,7 +191,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -213,7 +213,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::updateCurrentTime(int  currentTime0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::updateCurrentTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -235,7 +235,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::updateDirection(QAbstractAnimation::Direction  direction0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::updateDirection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateDirection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -257,7 +257,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractAnimation::updateState(QAbstractAnimation::State  newState0, QAbstractAnimation::State  oldState1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractAnimation::updateState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -372,7 +372,7 @@ PythonQtShell_QAbstractItemModel::~PythonQtShell_QAbstractItemModel() {
 QModelIndex  PythonQtShell_QAbstractItemModel::buddy(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::buddy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("buddy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -405,7 +405,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::canDropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::canDropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canDropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -438,7 +438,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::canFetchMore(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::canFetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canFetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -471,7 +471,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -493,7 +493,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemModel::columnCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::columnCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("columnCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -526,7 +526,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -548,7 +548,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractItemModel::data(const QModelIndex&  index0, int  role1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::data")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("data");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -581,7 +581,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::dropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::dropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -614,7 +614,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -647,7 +647,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -680,7 +680,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::fetchMore(const QModelIndex&  parent0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::fetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -702,7 +702,7 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QAbstractItemModel::flags(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::flags")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("flags");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -735,7 +735,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::hasChildren(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::hasChildren")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasChildren");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -768,7 +768,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractItemModel::headerData(int  section0, Qt::Orientation  orientation1, int  role2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::headerData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("headerData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -801,7 +801,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemModel::index(int  row0, int  column1, const QModelIndex&  parent2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::index")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("index");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -834,7 +834,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::insertColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::insertColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -867,7 +867,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::insertRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::insertRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -900,7 +900,7 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QAbstractItemModel::itemData(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::itemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -933,7 +933,7 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractItemModel::match(const QModelIndex&  start0, int  role1, const QVariant&  value2, int  hits3, Qt::MatchFlags  flags4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::match")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("match");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -966,7 +966,7 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QAbstractItemModel::mimeData(const QList<QModelIndex >&  indexes0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::mimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -999,7 +999,7 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAbstractItemModel::mimeTypes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::mimeTypes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeTypes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1032,7 +1032,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::moveColumns(const QModelIndex&  sourceParent0, int  sourceColumn1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::moveColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1065,7 +1065,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::moveRows(const QModelIndex&  sourceParent0, int  sourceRow1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::moveRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1098,7 +1098,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemModel::parent(const QModelIndex&  child0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::parent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("parent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1131,7 +1131,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::removeColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::removeColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1164,7 +1164,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::removeRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::removeRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1197,7 +1197,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::revert()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::revert")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("revert");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1219,7 +1219,7 @@ if (_wrapper) {
 QHash<int , QByteArray >  PythonQtShell_QAbstractItemModel::roleNames() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::roleNames")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("roleNames");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1252,7 +1252,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemModel::rowCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::rowCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1285,7 +1285,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::setData(const QModelIndex&  index0, const QVariant&  value1, int  role2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::setData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1318,7 +1318,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::setHeaderData(int  section0, Qt::Orientation  orientation1, const QVariant&  value2, int  role3)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::setHeaderData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setHeaderData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1351,7 +1351,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::setItemData(const QModelIndex&  index0, const QMap<int , QVariant >&  roles1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::setItemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setItemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1384,7 +1384,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemModel::sibling(int  row0, int  column1, const QModelIndex&  idx2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::sibling")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sibling");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1417,7 +1417,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::sort(int  column0, Qt::SortOrder  order1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::sort")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sort");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1439,7 +1439,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractItemModel::span(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::span")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("span");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1472,7 +1472,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemModel::submit()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::submit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("submit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1505,7 +1505,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractItemModel::supportedDragActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::supportedDragActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDragActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1538,7 +1538,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractItemModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::supportedDropActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDropActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1571,7 +1571,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemModel::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemModel::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1916,7 +1916,7 @@ PythonQtShell_QAbstractListModel::~PythonQtShell_QAbstractListModel() {
 QModelIndex  PythonQtShell_QAbstractListModel::buddy(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::buddy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("buddy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1949,7 +1949,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::canDropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::canDropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canDropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1982,7 +1982,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::canFetchMore(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::canFetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canFetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2015,7 +2015,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2037,7 +2037,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2059,7 +2059,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractListModel::data(const QModelIndex&  index0, int  role1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::data")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("data");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2092,7 +2092,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::dropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::dropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2125,7 +2125,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2158,7 +2158,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2191,7 +2191,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::fetchMore(const QModelIndex&  parent0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::fetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2213,7 +2213,7 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QAbstractListModel::flags(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::flags")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("flags");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2246,7 +2246,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractListModel::headerData(int  section0, Qt::Orientation  orientation1, int  role2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::headerData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("headerData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2279,7 +2279,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractListModel::index(int  row0, int  column1, const QModelIndex&  parent2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::index")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("index");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2312,7 +2312,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::insertColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::insertColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2345,7 +2345,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::insertRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::insertRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2378,7 +2378,7 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QAbstractListModel::itemData(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::itemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2411,7 +2411,7 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractListModel::match(const QModelIndex&  start0, int  role1, const QVariant&  value2, int  hits3, Qt::MatchFlags  flags4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::match")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("match");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2444,7 +2444,7 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QAbstractListModel::mimeData(const QList<QModelIndex >&  indexes0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::mimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2477,7 +2477,7 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAbstractListModel::mimeTypes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::mimeTypes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeTypes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2510,7 +2510,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::moveColumns(const QModelIndex&  sourceParent0, int  sourceColumn1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::moveColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2543,7 +2543,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::moveRows(const QModelIndex&  sourceParent0, int  sourceRow1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::moveRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2576,7 +2576,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::removeColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::removeColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2609,7 +2609,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::removeRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::removeRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2642,7 +2642,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::revert()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::revert")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("revert");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2664,7 +2664,7 @@ if (_wrapper) {
 QHash<int , QByteArray >  PythonQtShell_QAbstractListModel::roleNames() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::roleNames")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("roleNames");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2697,7 +2697,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractListModel::rowCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::rowCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2730,7 +2730,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::setData(const QModelIndex&  index0, const QVariant&  value1, int  role2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::setData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2763,7 +2763,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::setHeaderData(int  section0, Qt::Orientation  orientation1, const QVariant&  value2, int  role3)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::setHeaderData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setHeaderData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2796,7 +2796,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::setItemData(const QModelIndex&  index0, const QMap<int , QVariant >&  roles1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::setItemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setItemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2829,7 +2829,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractListModel::sibling(int  row0, int  column1, const QModelIndex&  idx2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::sibling")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sibling");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2862,7 +2862,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::sort(int  column0, Qt::SortOrder  order1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::sort")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sort");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2884,7 +2884,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractListModel::span(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::span")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("span");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2917,7 +2917,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractListModel::submit()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::submit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("submit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2950,7 +2950,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractListModel::supportedDragActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::supportedDragActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDragActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2983,7 +2983,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractListModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::supportedDropActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDropActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3016,7 +3016,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractListModel::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractListModel::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3061,7 +3061,7 @@ PythonQtShell_QAbstractState::~PythonQtShell_QAbstractState() {
 void PythonQtShell_QAbstractState::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractState::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3083,7 +3083,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractState::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3105,7 +3105,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractState::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractState::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3138,7 +3138,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractState::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractState::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3171,7 +3171,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::onEntry(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractState::onEntry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onEntry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3193,7 +3193,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::onExit(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractState::onExit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onExit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3215,7 +3215,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractState::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractState::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3285,7 +3285,7 @@ PythonQtShell_QAbstractTransition::~PythonQtShell_QAbstractTransition() {
 void PythonQtShell_QAbstractTransition::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTransition::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3307,7 +3307,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTransition::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTransition::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3329,7 +3329,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTransition::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTransition::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3362,7 +3362,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTransition::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTransition::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3395,7 +3395,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTransition::eventTest(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTransition::eventTest")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventTest");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3428,7 +3428,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTransition::onTransition(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTransition::onTransition")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onTransition");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3450,7 +3450,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTransition::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTransition::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3560,7 +3560,7 @@ PythonQtShell_QAnimationGroup::~PythonQtShell_QAnimationGroup() {
 void PythonQtShell_QAnimationGroup::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3582,7 +3582,7 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3604,7 +3604,7 @@ if (_wrapper) {
 int  PythonQtShell_QAnimationGroup::duration() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::duration")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("duration");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3637,7 +3637,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAnimationGroup::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3670,7 +3670,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAnimationGroup::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3703,7 +3703,7 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3725,7 +3725,7 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::updateCurrentTime(int  currentTime0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::updateCurrentTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3747,7 +3747,7 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::updateDirection(QAbstractAnimation::Direction  direction0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::updateDirection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateDirection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3769,7 +3769,7 @@ if (_wrapper) {
 void PythonQtShell_QAnimationGroup::updateState(QAbstractAnimation::State  newState0, QAbstractAnimation::State  oldState1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAnimationGroup::updateState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3936,7 +3936,7 @@ PythonQtShell_QBuffer::~PythonQtShell_QBuffer() {
 bool  PythonQtShell_QBuffer::atEnd() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::atEnd")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("atEnd");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3969,7 +3969,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::bytesAvailable() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::bytesAvailable")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesAvailable");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4002,7 +4002,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::bytesToWrite() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::bytesToWrite")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesToWrite");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4035,7 +4035,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::canReadLine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::canReadLine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canReadLine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4068,7 +4068,7 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4090,7 +4090,7 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::close()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::close")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("close");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4112,7 +4112,7 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::connectNotify(const QMetaMethod&  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::connectNotify")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("connectNotify");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4134,7 +4134,7 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4156,7 +4156,7 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::disconnectNotify(const QMetaMethod&  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::disconnectNotify")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("disconnectNotify");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4178,7 +4178,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4211,7 +4211,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4244,7 +4244,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::isSequential() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::isSequential")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isSequential");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4277,7 +4277,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::open(QIODevice::OpenMode  openMode0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4310,7 +4310,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::pos() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::pos")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pos");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4343,7 +4343,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::readData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::readData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4376,7 +4376,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::readLineData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::readLineData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readLineData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4409,7 +4409,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4442,7 +4442,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::seek(qint64  off0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::seek")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("seek");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4475,7 +4475,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::size() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::size")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("size");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4508,7 +4508,7 @@ if (_wrapper) {
 void PythonQtShell_QBuffer::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4530,7 +4530,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::waitForBytesWritten(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::waitForBytesWritten")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForBytesWritten");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4563,7 +4563,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBuffer::waitForReadyRead(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::waitForReadyRead")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForReadyRead");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4596,7 +4596,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QBuffer::writeData(const char*  data0, qint64  len1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBuffer::writeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("writeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6193,7 +6193,7 @@ PythonQtShell_QEventLoop::~PythonQtShell_QEventLoop() {
 void PythonQtShell_QEventLoop::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventLoop::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6215,7 +6215,7 @@ if (_wrapper) {
 void PythonQtShell_QEventLoop::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventLoop::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6237,7 +6237,7 @@ if (_wrapper) {
 bool  PythonQtShell_QEventLoop::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventLoop::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6270,7 +6270,7 @@ if (_wrapper) {
 bool  PythonQtShell_QEventLoop::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventLoop::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6303,7 +6303,7 @@ if (_wrapper) {
 void PythonQtShell_QEventLoop::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventLoop::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6378,7 +6378,7 @@ PythonQtShell_QEventTransition::~PythonQtShell_QEventTransition() {
 void PythonQtShell_QEventTransition::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventTransition::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6400,7 +6400,7 @@ if (_wrapper) {
 void PythonQtShell_QEventTransition::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventTransition::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6422,7 +6422,7 @@ if (_wrapper) {
 bool  PythonQtShell_QEventTransition::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventTransition::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6455,7 +6455,7 @@ if (_wrapper) {
 bool  PythonQtShell_QEventTransition::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventTransition::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6488,7 +6488,7 @@ if (_wrapper) {
 bool  PythonQtShell_QEventTransition::eventTest(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventTransition::eventTest")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventTest");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6521,7 +6521,7 @@ if (_wrapper) {
 void PythonQtShell_QEventTransition::onTransition(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventTransition::onTransition")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onTransition");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6543,7 +6543,7 @@ if (_wrapper) {
 void PythonQtShell_QEventTransition::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QEventTransition::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6612,7 +6612,7 @@ PythonQtShell_QFactoryInterface::~PythonQtShell_QFactoryInterface() {
 QStringList  PythonQtShell_QFactoryInterface::keys() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFactoryInterface::keys")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keys");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
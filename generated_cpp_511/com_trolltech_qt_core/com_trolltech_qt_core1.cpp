@@ -54,7 +54,7 @@ PythonQtShell_QFile::~PythonQtShell_QFile() {
 bool  PythonQtShell_QFile::atEnd() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::atEnd")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("atEnd");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -87,7 +87,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::bytesAvailable() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::bytesAvailable")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesAvailable");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -120,7 +120,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::bytesToWrite() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::bytesToWrite")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesToWrite");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -153,7 +153,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::canReadLine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::canReadLine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canReadLine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -186,7 +186,7 @@ if (_wrapper) {
 void PythonQtShell_QFile::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -208,7 +208,7 @@ if (_wrapper) {
 void PythonQtShell_QFile::close()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::close")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("close");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -230,7 +230,7 @@ if (_wrapper) {
 void PythonQtShell_QFile::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -252,7 +252,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -285,7 +285,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -318,7 +318,7 @@ if (_wrapper) {
 QString  PythonQtShell_QFile::fileName() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::fileName")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fileName");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -351,7 +351,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::isSequential() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::isSequential")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isSequential");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -384,7 +384,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::open(QIODevice::OpenMode  flags0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -417,7 +417,7 @@ if (_wrapper) {
 QFileDevice::Permissions  PythonQtShell_QFile::permissions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::permissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("permissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -450,7 +450,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::pos() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::pos")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pos");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -483,7 +483,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::readData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::readData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -516,7 +516,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::readLineData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::readLineData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readLineData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -549,7 +549,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -582,7 +582,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::resize(qint64  sz0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::resize")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resize");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -615,7 +615,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::seek(qint64  offset0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::seek")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("seek");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -648,7 +648,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::setPermissions(QFileDevice::Permissions  permissionSpec0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::setPermissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setPermissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -681,7 +681,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::size() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::size")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("size");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -714,7 +714,7 @@ if (_wrapper) {
 void PythonQtShell_QFile::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -736,7 +736,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::waitForBytesWritten(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::waitForBytesWritten")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForBytesWritten");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -769,7 +769,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFile::waitForReadyRead(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::waitForReadyRead")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForReadyRead");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -802,7 +802,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFile::writeData(const char*  data0, qint64  len1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFile::writeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("writeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -965,7 +965,7 @@ PythonQtShell_QFileDevice::~PythonQtShell_QFileDevice() {
 bool  PythonQtShell_QFileDevice::atEnd() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::atEnd")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("atEnd");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -998,7 +998,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFileDevice::bytesAvailable() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::bytesAvailable")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesAvailable");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1031,7 +1031,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFileDevice::bytesToWrite() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::bytesToWrite")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesToWrite");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1064,7 +1064,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::canReadLine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::canReadLine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canReadLine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1097,7 +1097,7 @@ if (_wrapper) {
 void PythonQtShell_QFileDevice::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1119,7 +1119,7 @@ if (_wrapper) {
 void PythonQtShell_QFileDevice::close()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::close")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("close");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1141,7 +1141,7 @@ if (_wrapper) {
 void PythonQtShell_QFileDevice::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1163,7 +1163,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1196,7 +1196,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1229,7 +1229,7 @@ if (_wrapper) {
 QString  PythonQtShell_QFileDevice::fileName() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::fileName")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fileName");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1262,7 +1262,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::isSequential() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::isSequential")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isSequential");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1295,7 +1295,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::open(QIODevice::OpenMode  mode0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1328,7 +1328,7 @@ if (_wrapper) {
 QFileDevice::Permissions  PythonQtShell_QFileDevice::permissions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::permissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("permissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1361,7 +1361,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFileDevice::pos() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::pos")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pos");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1394,7 +1394,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFileDevice::readData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::readData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1427,7 +1427,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFileDevice::readLineData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::readLineData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readLineData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1460,7 +1460,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1493,7 +1493,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::resize(qint64  sz0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::resize")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resize");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1526,7 +1526,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::seek(qint64  offset0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::seek")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("seek");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1559,7 +1559,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::setPermissions(QFileDevice::Permissions  permissionSpec0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::setPermissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setPermissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1592,7 +1592,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFileDevice::size() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::size")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("size");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1625,7 +1625,7 @@ if (_wrapper) {
 void PythonQtShell_QFileDevice::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1647,7 +1647,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::waitForBytesWritten(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::waitForBytesWritten")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForBytesWritten");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1680,7 +1680,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileDevice::waitForReadyRead(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::waitForReadyRead")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForReadyRead");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1713,7 +1713,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QFileDevice::writeData(const char*  data0, qint64  len1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileDevice::writeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("writeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2107,7 +2107,7 @@ PythonQtShell_QFileSelector::~PythonQtShell_QFileSelector() {
 void PythonQtShell_QFileSelector::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSelector::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2129,7 +2129,7 @@ if (_wrapper) {
 void PythonQtShell_QFileSelector::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSelector::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2151,7 +2151,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileSelector::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSelector::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2184,7 +2184,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileSelector::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSelector::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2217,7 +2217,7 @@ if (_wrapper) {
 void PythonQtShell_QFileSelector::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSelector::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2287,7 +2287,7 @@ PythonQtShell_QFileSystemWatcher::~PythonQtShell_QFileSystemWatcher() {
 void PythonQtShell_QFileSystemWatcher::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSystemWatcher::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2309,7 +2309,7 @@ if (_wrapper) {
 void PythonQtShell_QFileSystemWatcher::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSystemWatcher::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2331,7 +2331,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileSystemWatcher::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSystemWatcher::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2364,7 +2364,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFileSystemWatcher::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSystemWatcher::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2397,7 +2397,7 @@ if (_wrapper) {
 void PythonQtShell_QFileSystemWatcher::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFileSystemWatcher::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2476,7 +2476,7 @@ PythonQtShell_QFinalState::~PythonQtShell_QFinalState() {
 void PythonQtShell_QFinalState::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFinalState::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2498,7 +2498,7 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFinalState::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2520,7 +2520,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFinalState::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFinalState::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2553,7 +2553,7 @@ if (_wrapper) {
 bool  PythonQtShell_QFinalState::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFinalState::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2586,7 +2586,7 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::onEntry(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFinalState::onEntry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onEntry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2608,7 +2608,7 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::onExit(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFinalState::onExit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onExit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2630,7 +2630,7 @@ if (_wrapper) {
 void PythonQtShell_QFinalState::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QFinalState::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2675,7 +2675,7 @@ PythonQtShell_QHistoryState::~PythonQtShell_QHistoryState() {
 void PythonQtShell_QHistoryState::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QHistoryState::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2697,7 +2697,7 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QHistoryState::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2719,7 +2719,7 @@ if (_wrapper) {
 bool  PythonQtShell_QHistoryState::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QHistoryState::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2752,7 +2752,7 @@ if (_wrapper) {
 bool  PythonQtShell_QHistoryState::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QHistoryState::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2785,7 +2785,7 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::onEntry(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QHistoryState::onEntry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onEntry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2807,7 +2807,7 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::onExit(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QHistoryState::onExit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onExit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2829,7 +2829,7 @@ if (_wrapper) {
 void PythonQtShell_QHistoryState::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QHistoryState::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2908,7 +2908,7 @@ PythonQtShell_QIODevice::~PythonQtShell_QIODevice() {
 bool  PythonQtShell_QIODevice::atEnd() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::atEnd")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("atEnd");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2941,7 +2941,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::bytesAvailable() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::bytesAvailable")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesAvailable");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2974,7 +2974,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::bytesToWrite() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::bytesToWrite")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesToWrite");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3007,7 +3007,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::canReadLine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::canReadLine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canReadLine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3040,7 +3040,7 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3062,7 +3062,7 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::close()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::close")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("close");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3084,7 +3084,7 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3106,7 +3106,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3139,7 +3139,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3172,7 +3172,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::isSequential() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::isSequential")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isSequential");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3205,7 +3205,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::open(QIODevice::OpenMode  mode0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3238,7 +3238,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::pos() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::pos")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pos");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3271,7 +3271,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::readData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::readData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3304,7 +3304,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::readLineData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::readLineData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readLineData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3337,7 +3337,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3370,7 +3370,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::seek(qint64  pos0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::seek")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("seek");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3403,7 +3403,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::size() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::size")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("size");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3436,7 +3436,7 @@ if (_wrapper) {
 void PythonQtShell_QIODevice::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3458,7 +3458,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::waitForBytesWritten(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::waitForBytesWritten")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForBytesWritten");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3491,7 +3491,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIODevice::waitForReadyRead(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::waitForReadyRead")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForReadyRead");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3524,7 +3524,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QIODevice::writeData(const char*  data0, qint64  len1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIODevice::writeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("writeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3809,7 +3809,7 @@ PythonQtShell_QIdentityProxyModel::~PythonQtShell_QIdentityProxyModel() {
 QModelIndex  PythonQtShell_QIdentityProxyModel::buddy(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::buddy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("buddy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3842,7 +3842,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::canDropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::canDropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canDropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3875,7 +3875,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::canFetchMore(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::canFetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canFetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3908,7 +3908,7 @@ if (_wrapper) {
 void PythonQtShell_QIdentityProxyModel::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3930,7 +3930,7 @@ if (_wrapper) {
 int  PythonQtShell_QIdentityProxyModel::columnCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::columnCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("columnCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3963,7 +3963,7 @@ if (_wrapper) {
 void PythonQtShell_QIdentityProxyModel::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3985,7 +3985,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QIdentityProxyModel::data(const QModelIndex&  proxyIndex0, int  role1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::data")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("data");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4018,7 +4018,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::dropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::dropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4051,7 +4051,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4084,7 +4084,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4117,7 +4117,7 @@ if (_wrapper) {
 void PythonQtShell_QIdentityProxyModel::fetchMore(const QModelIndex&  parent0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::fetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4139,7 +4139,7 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QIdentityProxyModel::flags(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::flags")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("flags");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4172,7 +4172,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::hasChildren(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::hasChildren")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasChildren");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4205,7 +4205,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QIdentityProxyModel::headerData(int  section0, Qt::Orientation  orientation1, int  role2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::headerData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("headerData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4238,7 +4238,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QIdentityProxyModel::index(int  row0, int  column1, const QModelIndex&  parent2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::index")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("index");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4271,7 +4271,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::insertColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::insertColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4304,7 +4304,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::insertRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::insertRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4337,7 +4337,7 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QIdentityProxyModel::itemData(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::itemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4370,7 +4370,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QIdentityProxyModel::mapFromSource(const QModelIndex&  sourceIndex0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::mapFromSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapFromSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4403,7 +4403,7 @@ if (_wrapper) {
 QItemSelection  PythonQtShell_QIdentityProxyModel::mapSelectionFromSource(const QItemSelection&  selection0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::mapSelectionFromSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapSelectionFromSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4436,7 +4436,7 @@ if (_wrapper) {
 QItemSelection  PythonQtShell_QIdentityProxyModel::mapSelectionToSource(const QItemSelection&  selection0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::mapSelectionToSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapSelectionToSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4469,7 +4469,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QIdentityProxyModel::mapToSource(const QModelIndex&  proxyIndex0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::mapToSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapToSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4502,7 +4502,7 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QIdentityProxyModel::match(const QModelIndex&  start0, int  role1, const QVariant&  value2, int  hits3, Qt::MatchFlags  flags4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::match")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("match");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4535,7 +4535,7 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QIdentityProxyModel::mimeData(const QList<QModelIndex >&  indexes0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::mimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4568,7 +4568,7 @@ if (_wrapper) {
 QStringList  PythonQtShell_QIdentityProxyModel::mimeTypes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::mimeTypes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeTypes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4601,7 +4601,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::moveColumns(const QModelIndex&  sourceParent0, int  sourceColumn1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::moveColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4634,7 +4634,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::moveRows(const QModelIndex&  sourceParent0, int  sourceRow1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::moveRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4667,7 +4667,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QIdentityProxyModel::parent(const QModelIndex&  child0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::parent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("parent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4700,7 +4700,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::removeColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::removeColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4733,7 +4733,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::removeRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::removeRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4766,7 +4766,7 @@ if (_wrapper) {
 void PythonQtShell_QIdentityProxyModel::revert()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::revert")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("revert");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4788,7 +4788,7 @@ if (_wrapper) {
 QHash<int , QByteArray >  PythonQtShell_QIdentityProxyModel::roleNames() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::roleNames")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("roleNames");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4821,7 +4821,7 @@ if (_wrapper) {
 int  PythonQtShell_QIdentityProxyModel::rowCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::rowCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4854,7 +4854,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::setData(const QModelIndex&  index0, const QVariant&  value1, int  role2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::setData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4887,7 +4887,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::setHeaderData(int  section0, Qt::Orientation  orientation1, const QVariant&  value2, int  role3)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::setHeaderData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setHeaderData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4920,7 +4920,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::setItemData(const QModelIndex&  index0, const QMap<int , QVariant >&  roles1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::setItemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setItemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4953,7 +4953,7 @@ if (_wrapper) {
 void PythonQtShell_QIdentityProxyModel::setSourceModel(QAbstractItemModel*  sourceModel0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::setSourceModel")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setSourceModel");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4975,7 +4975,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QIdentityProxyModel::sibling(int  row0, int  column1, const QModelIndex&  idx2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::sibling")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sibling");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5008,7 +5008,7 @@ if (_wrapper) {
 void PythonQtShell_QIdentityProxyModel::sort(int  column0, Qt::SortOrder  order1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::sort")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sort");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5030,7 +5030,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QIdentityProxyModel::span(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::span")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("span");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5063,7 +5063,7 @@ if (_wrapper) {
 bool  PythonQtShell_QIdentityProxyModel::submit()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::submit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("submit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5096,7 +5096,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QIdentityProxyModel::supportedDragActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::supportedDragActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDragActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5129,7 +5129,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QIdentityProxyModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::supportedDropActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDropActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5162,7 +5162,7 @@ if (_wrapper) {
 void PythonQtShell_QIdentityProxyModel::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QIdentityProxyModel::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5847,7 +5847,7 @@ PythonQtShell_QLibrary::~PythonQtShell_QLibrary() {
 void PythonQtShell_QLibrary::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QLibrary::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5869,7 +5869,7 @@ if (_wrapper) {
 void PythonQtShell_QLibrary::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QLibrary::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5891,7 +5891,7 @@ if (_wrapper) {
 bool  PythonQtShell_QLibrary::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QLibrary::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5924,7 +5924,7 @@ if (_wrapper) {
 bool  PythonQtShell_QLibrary::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QLibrary::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5957,7 +5957,7 @@ if (_wrapper) {
 void PythonQtShell_QLibrary::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QLibrary::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6887,7 +6887,7 @@ PythonQtShell_QMimeData::~PythonQtShell_QMimeData() {
 void PythonQtShell_QMimeData::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6909,7 +6909,7 @@ if (_wrapper) {
 void PythonQtShell_QMimeData::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6931,7 +6931,7 @@ if (_wrapper) {
 bool  PythonQtShell_QMimeData::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6964,7 +6964,7 @@ if (_wrapper) {
 bool  PythonQtShell_QMimeData::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6997,7 +6997,7 @@ if (_wrapper) {
 QStringList  PythonQtShell_QMimeData::formats() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::formats")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("formats");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7030,7 +7030,7 @@ if (_wrapper) {
 bool  PythonQtShell_QMimeData::hasFormat(const QString&  mimetype0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::hasFormat")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasFormat");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7063,7 +7063,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QMimeData::retrieveData(const QString&  mimetype0, QVariant::Type  preferredType1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::retrieveData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("retrieveData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7096,7 +7096,7 @@ if (_wrapper) {
 void PythonQtShell_QMimeData::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QMimeData::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -82,7 +82,7 @@ PythonQtShell_QObject::~PythonQtShell_QObject() {
 void PythonQtShell_QObject::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QObject::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -104,7 +104,7 @@ if (_wrapper) {
 void PythonQtShell_QObject::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QObject::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -126,7 +126,7 @@ if (_wrapper) {
 bool  PythonQtShell_QObject::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QObject::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -159,7 +159,7 @@ if (_wrapper) {
 bool  PythonQtShell_QObject::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QObject::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -192,7 +192,7 @@ if (_wrapper) {
 void PythonQtShell_QObject::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QObject::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -424,7 +424,7 @@ PythonQtShell_QParallelAnimationGroup::~PythonQtShell_QParallelAnimationGroup()
 void PythonQtShell_QParallelAnimationGroup::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -446,7 +446,7 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -468,7 +468,7 @@ if (_wrapper) {
 int  PythonQtShell_QParallelAnimationGroup::duration() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::duration")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("duration");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -501,7 +501,7 @@ if (_wrapper) {
 bool  PythonQtShell_QParallelAnimationGroup::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -534,7 +534,7 @@ if (_wrapper) {
 bool  PythonQtShell_QParallelAnimationGroup::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -567,7 +567,7 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -589,7 +589,7 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::updateCurrentTime(int  currentTime0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::updateCurrentTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -611,7 +611,7 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::updateDirection(QAbstractAnimation::Direction  direction0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::updateDirection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateDirection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -633,7 +633,7 @@ if (_wrapper) {
 void PythonQtShell_QParallelAnimationGroup::updateState(QAbstractAnimation::State  newState0, QAbstractAnimation::State  oldState1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QParallelAnimationGroup::updateState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -678,7 +678,7 @@ PythonQtShell_QPauseAnimation::~PythonQtShell_QPauseAnimation() {
 void PythonQtShell_QPauseAnimation::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -700,7 +700,7 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -722,7 +722,7 @@ if (_wrapper) {
 int  PythonQtShell_QPauseAnimation::duration() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::duration")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("duration");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -755,7 +755,7 @@ if (_wrapper) {
 bool  PythonQtShell_QPauseAnimation::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -788,7 +788,7 @@ if (_wrapper) {
 bool  PythonQtShell_QPauseAnimation::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -821,7 +821,7 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -843,7 +843,7 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::updateCurrentTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -865,7 +865,7 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::updateDirection(QAbstractAnimation::Direction  direction0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::updateDirection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateDirection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -887,7 +887,7 @@ if (_wrapper) {
 void PythonQtShell_QPauseAnimation::updateState(QAbstractAnimation::State  newState0, QAbstractAnimation::State  oldState1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPauseAnimation::updateState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1047,7 +1047,7 @@ PythonQtShell_QProcess::~PythonQtShell_QProcess() {
 bool  PythonQtShell_QProcess::atEnd() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::atEnd")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("atEnd");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1080,7 +1080,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::bytesAvailable() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::bytesAvailable")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesAvailable");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1113,7 +1113,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::bytesToWrite() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::bytesToWrite")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesToWrite");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1146,7 +1146,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::canReadLine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::canReadLine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canReadLine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1179,7 +1179,7 @@ if (_wrapper) {
 void PythonQtShell_QProcess::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1201,7 +1201,7 @@ if (_wrapper) {
 void PythonQtShell_QProcess::close()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::close")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("close");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1223,7 +1223,7 @@ if (_wrapper) {
 void PythonQtShell_QProcess::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1245,7 +1245,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1278,7 +1278,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1311,7 +1311,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::isSequential() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::isSequential")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isSequential");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1344,7 +1344,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::open(QIODevice::OpenMode  mode0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1377,7 +1377,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::pos() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::pos")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pos");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1410,7 +1410,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::readData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::readData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1443,7 +1443,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::readLineData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::readLineData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readLineData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1476,7 +1476,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1509,7 +1509,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::seek(qint64  pos0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::seek")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("seek");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1542,7 +1542,7 @@ if (_wrapper) {
 void PythonQtShell_QProcess::setupChildProcess()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::setupChildProcess")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setupChildProcess");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1564,7 +1564,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::size() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::size")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("size");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1597,7 +1597,7 @@ if (_wrapper) {
 void PythonQtShell_QProcess::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1619,7 +1619,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::waitForBytesWritten(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::waitForBytesWritten")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForBytesWritten");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1652,7 +1652,7 @@ if (_wrapper) {
 bool  PythonQtShell_QProcess::waitForReadyRead(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::waitForReadyRead")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForReadyRead");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1685,7 +1685,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QProcess::writeData(const char*  data0, qint64  len1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QProcess::writeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("writeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2041,7 +2041,7 @@ PythonQtShell_QPropertyAnimation::~PythonQtShell_QPropertyAnimation() {
 void PythonQtShell_QPropertyAnimation::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2063,7 +2063,7 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2085,7 +2085,7 @@ if (_wrapper) {
 int  PythonQtShell_QPropertyAnimation::duration() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::duration")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("duration");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2118,7 +2118,7 @@ if (_wrapper) {
 bool  PythonQtShell_QPropertyAnimation::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2151,7 +2151,7 @@ if (_wrapper) {
 bool  PythonQtShell_QPropertyAnimation::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2184,7 +2184,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QPropertyAnimation::interpolated(const QVariant&  from0, const QVariant&  to1, qreal  progress2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::interpolated")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("interpolated");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2217,7 +2217,7 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2239,7 +2239,7 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::updateCurrentTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2261,7 +2261,7 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateCurrentValue(const QVariant&  value0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::updateCurrentValue")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentValue");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2283,7 +2283,7 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateDirection(QAbstractAnimation::Direction  direction0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::updateDirection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateDirection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2305,7 +2305,7 @@ if (_wrapper) {
 void PythonQtShell_QPropertyAnimation::updateState(QAbstractAnimation::State  newState0, QAbstractAnimation::State  oldState1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QPropertyAnimation::updateState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2976,7 +2976,7 @@ PythonQtShell_QRunnable::~PythonQtShell_QRunnable() {
 void PythonQtShell_QRunnable::run()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QRunnable::run")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("run");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3023,7 +3023,7 @@ PythonQtShell_QSaveFile::~PythonQtShell_QSaveFile() {
 bool  PythonQtShell_QSaveFile::atEnd() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::atEnd")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("atEnd");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3056,7 +3056,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QSaveFile::bytesAvailable() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::bytesAvailable")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesAvailable");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3089,7 +3089,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QSaveFile::bytesToWrite() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::bytesToWrite")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesToWrite");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3122,7 +3122,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::canReadLine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::canReadLine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canReadLine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3155,7 +3155,7 @@ if (_wrapper) {
 void PythonQtShell_QSaveFile::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3177,7 +3177,7 @@ if (_wrapper) {
 void PythonQtShell_QSaveFile::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3199,7 +3199,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3232,7 +3232,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3265,7 +3265,7 @@ if (_wrapper) {
 QString  PythonQtShell_QSaveFile::fileName() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::fileName")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fileName");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3298,7 +3298,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::isSequential() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::isSequential")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isSequential");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3331,7 +3331,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::open(QIODevice::OpenMode  flags0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3364,7 +3364,7 @@ if (_wrapper) {
 QFileDevice::Permissions  PythonQtShell_QSaveFile::permissions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::permissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("permissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3397,7 +3397,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QSaveFile::pos() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::pos")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pos");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3430,7 +3430,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QSaveFile::readData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::readData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3463,7 +3463,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QSaveFile::readLineData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::readLineData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readLineData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3496,7 +3496,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3529,7 +3529,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::resize(qint64  sz0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::resize")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resize");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3562,7 +3562,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::seek(qint64  offset0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::seek")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("seek");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3595,7 +3595,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::setPermissions(QFileDevice::Permissions  permissionSpec0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::setPermissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setPermissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3628,7 +3628,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QSaveFile::size() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::size")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("size");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3661,7 +3661,7 @@ if (_wrapper) {
 void PythonQtShell_QSaveFile::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3683,7 +3683,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::waitForBytesWritten(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::waitForBytesWritten")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForBytesWritten");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3716,7 +3716,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSaveFile::waitForReadyRead(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::waitForReadyRead")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForReadyRead");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3749,7 +3749,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QSaveFile::writeData(const char*  data0, qint64  len1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSaveFile::writeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("writeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3869,7 +3869,7 @@ PythonQtShell_QSequentialAnimationGroup::~PythonQtShell_QSequentialAnimationGrou
 void PythonQtShell_QSequentialAnimationGroup::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3891,7 +3891,7 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3913,7 +3913,7 @@ if (_wrapper) {
 int  PythonQtShell_QSequentialAnimationGroup::duration() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::duration")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("duration");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3946,7 +3946,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSequentialAnimationGroup::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3979,7 +3979,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSequentialAnimationGroup::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4012,7 +4012,7 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4034,7 +4034,7 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::updateCurrentTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4056,7 +4056,7 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::updateDirection(QAbstractAnimation::Direction  direction0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::updateDirection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateDirection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4078,7 +4078,7 @@ if (_wrapper) {
 void PythonQtShell_QSequentialAnimationGroup::updateState(QAbstractAnimation::State  newState0, QAbstractAnimation::State  oldState1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSequentialAnimationGroup::updateState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4138,7 +4138,7 @@ PythonQtShell_QSettings::~PythonQtShell_QSettings() {
 void PythonQtShell_QSettings::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSettings::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4160,7 +4160,7 @@ if (_wrapper) {
 void PythonQtShell_QSettings::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSettings::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4182,7 +4182,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSettings::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSettings::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4215,7 +4215,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSettings::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSettings::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4248,7 +4248,7 @@ if (_wrapper) {
 void PythonQtShell_QSettings::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSettings::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4474,7 +4474,7 @@ PythonQtShell_QSharedMemory::~PythonQtShell_QSharedMemory() {
 void PythonQtShell_QSharedMemory::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSharedMemory::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4496,7 +4496,7 @@ if (_wrapper) {
 void PythonQtShell_QSharedMemory::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSharedMemory::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4518,7 +4518,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSharedMemory::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSharedMemory::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4551,7 +4551,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSharedMemory::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSharedMemory::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4584,7 +4584,7 @@ if (_wrapper) {
 void PythonQtShell_QSharedMemory::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSharedMemory::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4728,7 +4728,7 @@ PythonQtShell_QSignalMapper::~PythonQtShell_QSignalMapper() {
 void PythonQtShell_QSignalMapper::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalMapper::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4750,7 +4750,7 @@ if (_wrapper) {
 void PythonQtShell_QSignalMapper::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalMapper::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4772,7 +4772,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalMapper::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalMapper::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4805,7 +4805,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalMapper::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalMapper::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4838,7 +4838,7 @@ if (_wrapper) {
 void PythonQtShell_QSignalMapper::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalMapper::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4928,7 +4928,7 @@ PythonQtShell_QSignalTransition::~PythonQtShell_QSignalTransition() {
 void PythonQtShell_QSignalTransition::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalTransition::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4950,7 +4950,7 @@ if (_wrapper) {
 void PythonQtShell_QSignalTransition::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalTransition::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4972,7 +4972,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalTransition::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalTransition::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5005,7 +5005,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalTransition::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalTransition::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5038,7 +5038,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSignalTransition::eventTest(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalTransition::eventTest")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventTest");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5071,7 +5071,7 @@ if (_wrapper) {
 void PythonQtShell_QSignalTransition::onTransition(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalTransition::onTransition")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onTransition");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5093,7 +5093,7 @@ if (_wrapper) {
 void PythonQtShell_QSignalTransition::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSignalTransition::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5162,7 +5162,7 @@ PythonQtShell_QSocketNotifier::~PythonQtShell_QSocketNotifier() {
 void PythonQtShell_QSocketNotifier::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSocketNotifier::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5184,7 +5184,7 @@ if (_wrapper) {
 void PythonQtShell_QSocketNotifier::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSocketNotifier::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5206,7 +5206,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSocketNotifier::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSocketNotifier::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5239,7 +5239,7 @@ if (_wrapper) {
 bool  PythonQtShell_QSocketNotifier::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSocketNotifier::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5272,7 +5272,7 @@ if (_wrapper) {
 void PythonQtShell_QSocketNotifier::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QSocketNotifier::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5379,7 +5379,7 @@ PythonQtShell_QState::~PythonQtShell_QState() {
 void PythonQtShell_QState::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QState::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5401,7 +5401,7 @@ if (_wrapper) {
 void PythonQtShell_QState::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QState::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5423,7 +5423,7 @@ if (_wrapper) {
 bool  PythonQtShell_QState::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QState::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5456,7 +5456,7 @@ if (_wrapper) {
 bool  PythonQtShell_QState::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QState::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5489,7 +5489,7 @@ if (_wrapper) {
 void PythonQtShell_QState::onEntry(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QState::onEntry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onEntry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5511,7 +5511,7 @@ if (_wrapper) {
 void PythonQtShell_QState::onExit(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QState::onExit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onExit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5533,7 +5533,7 @@ if (_wrapper) {
 void PythonQtShell_QState::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QState::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5642,7 +5642,7 @@ PythonQtShell_QStateMachine::~PythonQtShell_QStateMachine() {
 void PythonQtShell_QStateMachine::beginMicrostep(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::beginMicrostep")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("beginMicrostep");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5664,7 +5664,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::beginSelectTransitions(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::beginSelectTransitions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("beginSelectTransitions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5686,7 +5686,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5708,7 +5708,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5730,7 +5730,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::endMicrostep(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::endMicrostep")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("endMicrostep");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5752,7 +5752,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::endSelectTransitions(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::endSelectTransitions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("endSelectTransitions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5774,7 +5774,7 @@ if (_wrapper) {
 bool  PythonQtShell_QStateMachine::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5807,7 +5807,7 @@ if (_wrapper) {
 bool  PythonQtShell_QStateMachine::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5840,7 +5840,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::onEntry(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::onEntry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onEntry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5862,7 +5862,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::onExit(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::onExit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("onExit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5884,7 +5884,7 @@ if (_wrapper) {
 void PythonQtShell_QStateMachine::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QStateMachine::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -380,7 +380,7 @@ PythonQtShell_QTemporaryFile::~PythonQtShell_QTemporaryFile() {
 bool  PythonQtShell_QTemporaryFile::atEnd() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::atEnd")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("atEnd");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -413,7 +413,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::bytesAvailable() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::bytesAvailable")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesAvailable");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -446,7 +446,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::bytesToWrite() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::bytesToWrite")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("bytesToWrite");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -479,7 +479,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::canReadLine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::canReadLine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canReadLine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -512,7 +512,7 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -534,7 +534,7 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::close()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::close")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("close");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -556,7 +556,7 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -578,7 +578,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -611,7 +611,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -644,7 +644,7 @@ if (_wrapper) {
 QString  PythonQtShell_QTemporaryFile::fileName() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::uniqueFilename")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("uniqueFilename");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -677,7 +677,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::isSequential() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::isSequential")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isSequential");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -710,7 +710,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::open(QIODevice::OpenMode  flags0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -743,7 +743,7 @@ if (_wrapper) {
 QFileDevice::Permissions  PythonQtShell_QTemporaryFile::permissions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::permissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("permissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -776,7 +776,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::pos() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::pos")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pos");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -809,7 +809,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::readData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::readData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -842,7 +842,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::readLineData(char*  data0, qint64  maxlen1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::readLineData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("readLineData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -875,7 +875,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -908,7 +908,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::resize(qint64  sz0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::resize")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resize");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -941,7 +941,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::seek(qint64  offset0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::seek")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("seek");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -974,7 +974,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::setPermissions(QFileDevice::Permissions  permissionSpec0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::setPermissions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setPermissions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1007,7 +1007,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::size() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::size")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("size");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1040,7 +1040,7 @@ if (_wrapper) {
 void PythonQtShell_QTemporaryFile::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1062,7 +1062,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::waitForBytesWritten(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::waitForBytesWritten")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForBytesWritten");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1095,7 +1095,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTemporaryFile::waitForReadyRead(int  msecs0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::waitForReadyRead")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("waitForReadyRead");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1128,7 +1128,7 @@ if (_wrapper) {
 qint64  PythonQtShell_QTemporaryFile::writeData(const char*  data0, qint64  len1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTemporaryFile::writeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("writeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1320,7 +1320,7 @@ PythonQtShell_QTextCodec::~PythonQtShell_QTextCodec() {
 QList<QByteArray >  PythonQtShell_QTextCodec::aliases() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTextCodec::aliases")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("aliases");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1353,7 +1353,7 @@ if (_wrapper) {
 QByteArray  PythonQtShell_QTextCodec::convertFromUnicode(const QChar*  in0, int  length1, QTextCodec::ConverterState*  state2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTextCodec::convertFromUnicode")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("convertFromUnicode");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1386,7 +1386,7 @@ if (_wrapper) {
 QString  PythonQtShell_QTextCodec::convertToUnicode(const char*  in0, int  length1, QTextCodec::ConverterState*  state2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTextCodec::convertToUnicode")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("convertToUnicode");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1419,7 +1419,7 @@ if (_wrapper) {
 int  PythonQtShell_QTextCodec::mibEnum() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTextCodec::mibEnum")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mibEnum");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1452,7 +1452,7 @@ if (_wrapper) {
 QByteArray  PythonQtShell_QTextCodec::name() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTextCodec::name")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("name");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1923,7 +1923,7 @@ PythonQtShell_QThreadPool::~PythonQtShell_QThreadPool() {
 void PythonQtShell_QThreadPool::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QThreadPool::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1945,7 +1945,7 @@ if (_wrapper) {
 void PythonQtShell_QThreadPool::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QThreadPool::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1967,7 +1967,7 @@ if (_wrapper) {
 bool  PythonQtShell_QThreadPool::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QThreadPool::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2000,7 +2000,7 @@ if (_wrapper) {
 bool  PythonQtShell_QThreadPool::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QThreadPool::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2033,7 +2033,7 @@ if (_wrapper) {
 void PythonQtShell_QThreadPool::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QThreadPool::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2158,7 +2158,7 @@ PythonQtShell_QTimeLine::~PythonQtShell_QTimeLine() {
 void PythonQtShell_QTimeLine::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimeLine::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2180,7 +2180,7 @@ if (_wrapper) {
 void PythonQtShell_QTimeLine::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimeLine::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2202,7 +2202,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTimeLine::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimeLine::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2235,7 +2235,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTimeLine::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimeLine::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2268,7 +2268,7 @@ if (_wrapper) {
 void PythonQtShell_QTimeLine::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimeLine::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2290,7 +2290,7 @@ if (_wrapper) {
 qreal  PythonQtShell_QTimeLine::valueForTime(int  msec0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimeLine::valueForTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("valueForTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2645,7 +2645,7 @@ PythonQtShell_QTimer::~PythonQtShell_QTimer() {
 void PythonQtShell_QTimer::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimer::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2667,7 +2667,7 @@ if (_wrapper) {
 void PythonQtShell_QTimer::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimer::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2689,7 +2689,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTimer::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimer::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2722,7 +2722,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTimer::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimer::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2755,7 +2755,7 @@ if (_wrapper) {
 void PythonQtShell_QTimer::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTimer::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2870,7 +2870,7 @@ PythonQtShell_QTranslator::~PythonQtShell_QTranslator() {
 void PythonQtShell_QTranslator::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTranslator::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2892,7 +2892,7 @@ if (_wrapper) {
 void PythonQtShell_QTranslator::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTranslator::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2914,7 +2914,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTranslator::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTranslator::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2947,7 +2947,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTranslator::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTranslator::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2980,7 +2980,7 @@ if (_wrapper) {
 bool  PythonQtShell_QTranslator::isEmpty() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTranslator::isEmpty")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isEmpty");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3013,7 +3013,7 @@ if (_wrapper) {
 void PythonQtShell_QTranslator::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTranslator::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3035,7 +3035,7 @@ if (_wrapper) {
 QString  PythonQtShell_QTranslator::translate(const char*  context0, const char*  sourceText1, const char*  disambiguation2, int  n3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QTranslator::translate")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("translate");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3383,7 +3383,7 @@ PythonQtShell_QVariantAnimation::~PythonQtShell_QVariantAnimation() {
 void PythonQtShell_QVariantAnimation::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3405,7 +3405,7 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3427,7 +3427,7 @@ if (_wrapper) {
 int  PythonQtShell_QVariantAnimation::duration() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::duration")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("duration");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3460,7 +3460,7 @@ if (_wrapper) {
 bool  PythonQtShell_QVariantAnimation::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3493,7 +3493,7 @@ if (_wrapper) {
 bool  PythonQtShell_QVariantAnimation::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3526,7 +3526,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QVariantAnimation::interpolated(const QVariant&  from0, const QVariant&  to1, qreal  progress2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::interpolated")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("interpolated");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3559,7 +3559,7 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3581,7 +3581,7 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateCurrentTime(int  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::updateCurrentTime")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentTime");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3603,7 +3603,7 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateCurrentValue(const QVariant&  value0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::updateCurrentValue")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateCurrentValue");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3625,7 +3625,7 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateDirection(QAbstractAnimation::Direction  direction0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::updateDirection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateDirection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3647,7 +3647,7 @@ if (_wrapper) {
 void PythonQtShell_QVariantAnimation::updateState(QAbstractAnimation::State  newState0, QAbstractAnimation::State  oldState1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QVariantAnimation::updateState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3798,7 +3798,7 @@ PythonQtShell_QXmlStreamEntityResolver::~PythonQtShell_QXmlStreamEntityResolver(
 QString  PythonQtShell_QXmlStreamEntityResolver::resolveEntity(const QString&  publicId0, const QString&  systemId1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QXmlStreamEntityResolver::resolveEntity")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resolveEntity");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3831,7 +3831,7 @@ if (_wrapper) {
 QString  PythonQtShell_QXmlStreamEntityResolver::resolveUndeclaredEntity(const QString&  name0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QXmlStreamEntityResolver::resolveUndeclaredEntity")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resolveUndeclaredEntity");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
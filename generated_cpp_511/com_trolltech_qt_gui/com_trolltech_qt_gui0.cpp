@@ -116,7 +116,7 @@ PythonQtShell_QAbstractButton::~PythonQtShell_QAbstractButton() {
 void PythonQtShell_QAbstractButton::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -138,7 +138,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::changeEvent(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -160,7 +160,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::checkStateSet()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::checkStateSet")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("checkStateSet");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -182,7 +182,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -204,7 +204,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -226,7 +226,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::contextMenuEvent(QContextMenuEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -248,7 +248,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -270,7 +270,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractButton::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -303,7 +303,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -325,7 +325,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -347,7 +347,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -369,7 +369,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -391,7 +391,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -413,7 +413,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -446,7 +446,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -479,7 +479,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::focusInEvent(QFocusEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -501,7 +501,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -534,7 +534,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::focusOutEvent(QFocusEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -556,7 +556,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -589,7 +589,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractButton::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -622,7 +622,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -644,7 +644,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::hitButton(const QPoint&  pos0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::hitButton")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hitButton");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -677,7 +677,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -699,7 +699,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -721,7 +721,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractButton::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -754,7 +754,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::keyPressEvent(QKeyEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -776,7 +776,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::keyReleaseEvent(QKeyEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -798,7 +798,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -820,7 +820,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractButton::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -853,7 +853,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractButton::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::getMinimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("getMinimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -886,7 +886,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -908,7 +908,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mouseMoveEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -930,7 +930,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mousePressEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -952,7 +952,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::mouseReleaseEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -974,7 +974,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -996,7 +996,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractButton::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1029,7 +1029,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::nextCheckState()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::nextCheckState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nextCheckState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1051,7 +1051,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractButton::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1084,7 +1084,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::paintEvent(QPaintEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1106,7 +1106,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QAbstractButton::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1139,7 +1139,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1161,7 +1161,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1183,7 +1183,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QAbstractButton::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1216,7 +1216,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1238,7 +1238,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractButton::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::getSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("getSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1271,7 +1271,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1293,7 +1293,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::timerEvent(QTimerEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1315,7 +1315,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractButton::wheelEvent(QWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractButton::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1480,7 +1480,7 @@ PythonQtShell_QAbstractGraphicsShapeItem::~PythonQtShell_QAbstractGraphicsShapeI
 void PythonQtShell_QAbstractGraphicsShapeItem::advance(int  phase0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::advance")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("advance");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1502,7 +1502,7 @@ if (_wrapper) {
 QRectF  PythonQtShell_QAbstractGraphicsShapeItem::boundingRect() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::boundingRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("boundingRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1535,7 +1535,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::collidesWithItem(const QGraphicsItem*  other0, Qt::ItemSelectionMode  mode1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::collidesWithItem")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("collidesWithItem");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1568,7 +1568,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::collidesWithPath(const QPainterPath&  path0, Qt::ItemSelectionMode  mode1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::collidesWithPath")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("collidesWithPath");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1601,7 +1601,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::contains(const QPointF&  point0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::contains")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contains");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1634,7 +1634,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::contextMenuEvent(QGraphicsSceneContextMenuEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1656,7 +1656,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dragEnterEvent(QGraphicsSceneDragDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1678,7 +1678,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dragLeaveEvent(QGraphicsSceneDragDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1700,7 +1700,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dragMoveEvent(QGraphicsSceneDragDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1722,7 +1722,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::dropEvent(QGraphicsSceneDragDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1744,7 +1744,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractGraphicsShapeItem::extension(const QVariant&  variant0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::extension")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("extension");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1777,7 +1777,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1799,7 +1799,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1821,7 +1821,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::hoverEnterEvent(QGraphicsSceneHoverEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::hoverEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hoverEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1843,7 +1843,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::hoverLeaveEvent(QGraphicsSceneHoverEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::hoverLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hoverLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1865,7 +1865,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::hoverMoveEvent(QGraphicsSceneHoverEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::hoverMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hoverMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1887,7 +1887,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::inputMethodEvent(QInputMethodEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1909,7 +1909,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractGraphicsShapeItem::inputMethodQuery(Qt::InputMethodQuery  query0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1942,7 +1942,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::isObscuredBy(const QGraphicsItem*  item0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::isObscuredBy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isObscuredBy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -1975,7 +1975,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractGraphicsShapeItem::itemChange(QGraphicsItem::GraphicsItemChange  change0, const QVariant&  value1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::itemChange")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemChange");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2011,7 +2011,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::keyPressEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2033,7 +2033,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2055,7 +2055,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2077,7 +2077,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mouseMoveEvent(QGraphicsSceneMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2099,7 +2099,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mousePressEvent(QGraphicsSceneMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2121,7 +2121,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::mouseReleaseEvent(QGraphicsSceneMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2143,7 +2143,7 @@ if (_wrapper) {
 QPainterPath  PythonQtShell_QAbstractGraphicsShapeItem::opaqueArea() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::opaqueArea")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("opaqueArea");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2176,7 +2176,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::paint(QPainter*  painter0, const QStyleOptionGraphicsItem*  option1, QWidget*  widget2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::paint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2198,7 +2198,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::sceneEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::sceneEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sceneEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2231,7 +2231,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::sceneEventFilter(QGraphicsItem*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::sceneEventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sceneEventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2264,7 +2264,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::setExtension(QGraphicsItem::Extension  extension0, const QVariant&  variant1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::setExtension")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setExtension");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2286,7 +2286,7 @@ if (_wrapper) {
 QPainterPath  PythonQtShell_QAbstractGraphicsShapeItem::shape() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::shape")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("shape");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2319,7 +2319,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractGraphicsShapeItem::supportsExtension(QGraphicsItem::Extension  extension0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::supportsExtension")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportsExtension");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2352,7 +2352,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractGraphicsShapeItem::type() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::type")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("type");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2385,7 +2385,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractGraphicsShapeItem::wheelEvent(QGraphicsSceneWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractGraphicsShapeItem::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2437,7 +2437,7 @@ PythonQtShell_QAbstractItemDelegate::~PythonQtShell_QAbstractItemDelegate() {
 void PythonQtShell_QAbstractItemDelegate::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2459,7 +2459,7 @@ if (_wrapper) {
 QWidget*  PythonQtShell_QAbstractItemDelegate::createEditor(QWidget*  parent0, const QStyleOptionViewItem&  option1, const QModelIndex&  index2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::createEditor")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("createEditor");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2492,7 +2492,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2514,7 +2514,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::destroyEditor(QWidget*  editor0, const QModelIndex&  index1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::destroyEditor")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("destroyEditor");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2536,7 +2536,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemDelegate::editorEvent(QEvent*  event0, QAbstractItemModel*  model1, const QStyleOptionViewItem&  option2, const QModelIndex&  index3)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::editorEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("editorEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2569,7 +2569,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemDelegate::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2602,7 +2602,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemDelegate::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2635,7 +2635,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemDelegate::helpEvent(QHelpEvent*  event0, QAbstractItemView*  view1, const QStyleOptionViewItem&  option2, const QModelIndex&  index3)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::helpEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("helpEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2668,7 +2668,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::paint(QPainter*  painter0, const QStyleOptionViewItem&  option1, const QModelIndex&  index2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::paint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2690,7 +2690,7 @@ if (_wrapper) {
 QVector<int >  PythonQtShell_QAbstractItemDelegate::paintingRoles() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::paintingRoles")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintingRoles");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2723,7 +2723,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::setEditorData(QWidget*  editor0, const QModelIndex&  index1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::setEditorData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setEditorData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2745,7 +2745,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::setModelData(QWidget*  editor0, QAbstractItemModel*  model1, const QModelIndex&  index2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::setModelData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setModelData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2767,7 +2767,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractItemDelegate::sizeHint(const QStyleOptionViewItem&  option0, const QModelIndex&  index1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2800,7 +2800,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2822,7 +2822,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemDelegate::updateEditorGeometry(QWidget*  editor0, const QStyleOptionViewItem&  option1, const QModelIndex&  index2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemDelegate::updateEditorGeometry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateEditorGeometry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2917,7 +2917,7 @@ PythonQtShell_QAbstractItemView::~PythonQtShell_QAbstractItemView() {
 void PythonQtShell_QAbstractItemView::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2939,7 +2939,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2961,7 +2961,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -2983,7 +2983,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::closeEditor(QWidget*  editor0, QAbstractItemDelegate::EndEditHint  hint1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::closeEditor")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEditor");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3005,7 +3005,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3027,7 +3027,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::commitData(QWidget*  editor0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::commitData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("commitData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3049,7 +3049,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3071,7 +3071,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::currentChanged(const QModelIndex&  current0, const QModelIndex&  previous1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::currentChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("currentChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3093,7 +3093,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3115,7 +3115,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dataChanged(const QModelIndex&  topLeft0, const QModelIndex&  bottomRight1, const QVector<int >&  roles2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::dataChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dataChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3137,7 +3137,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3170,7 +3170,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::doItemsLayout()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::doItemsLayout")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("doItemsLayout");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3192,7 +3192,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3214,7 +3214,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3236,7 +3236,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3258,7 +3258,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3280,7 +3280,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::edit(const QModelIndex&  index0, QAbstractItemView::EditTrigger  trigger1, QEvent*  event2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::edit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("edit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3313,7 +3313,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::editorDestroyed(QObject*  editor0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::editorDestroyed")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("editorDestroyed");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3335,7 +3335,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3357,7 +3357,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3390,7 +3390,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::eventFilter(QObject*  object0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3423,7 +3423,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3445,7 +3445,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3478,7 +3478,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3500,7 +3500,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3533,7 +3533,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3566,7 +3566,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3588,7 +3588,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::horizontalOffset() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::horizontalOffset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("horizontalOffset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3621,7 +3621,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::horizontalScrollbarAction(int  action0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::horizontalScrollbarAction")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("horizontalScrollbarAction");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3643,7 +3643,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::horizontalScrollbarValueChanged(int  value0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::horizontalScrollbarValueChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("horizontalScrollbarValueChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3665,7 +3665,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemView::indexAt(const QPoint&  point0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::indexAt")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("indexAt");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3698,7 +3698,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3720,7 +3720,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::inputMethodEvent(QInputMethodEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3742,7 +3742,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractItemView::inputMethodQuery(Qt::InputMethodQuery  query0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3775,7 +3775,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::isIndexHidden(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::isIndexHidden")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isIndexHidden");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3808,7 +3808,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::keyPressEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3830,7 +3830,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3852,7 +3852,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::keyboardSearch(const QString&  search0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::keyboardSearch")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyboardSearch");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3874,7 +3874,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3896,7 +3896,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3929,7 +3929,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractItemView::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3962,7 +3962,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -3984,7 +3984,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4006,7 +4006,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mousePressEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4028,7 +4028,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::mouseReleaseEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4050,7 +4050,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractItemView::moveCursor(QAbstractItemView::CursorAction  cursorAction0, Qt::KeyboardModifiers  modifiers1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::moveCursor")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveCursor");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4083,7 +4083,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4105,7 +4105,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4138,7 +4138,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractItemView::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4171,7 +4171,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4193,7 +4193,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QAbstractItemView::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4226,7 +4226,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4248,7 +4248,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4270,7 +4270,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::rowsAboutToBeRemoved(const QModelIndex&  parent0, int  start1, int  end2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::rowsAboutToBeRemoved")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowsAboutToBeRemoved");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4292,7 +4292,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::rowsInserted(const QModelIndex&  parent0, int  start1, int  end2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::rowsInserted")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowsInserted");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4314,7 +4314,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::scrollContentsBy(int  dx0, int  dy1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::scrollContentsBy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("scrollContentsBy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4336,7 +4336,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::scrollTo(const QModelIndex&  index0, QAbstractItemView::ScrollHint  hint1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::scrollTo")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("scrollTo");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4358,7 +4358,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::selectAll()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::selectAll")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectAll");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4380,7 +4380,7 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractItemView::selectedIndexes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::selectedIndexes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectedIndexes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4413,7 +4413,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::selectionChanged(const QItemSelection&  selected0, const QItemSelection&  deselected1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::selectionChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectionChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4435,7 +4435,7 @@ if (_wrapper) {
 QItemSelectionModel::SelectionFlags  PythonQtShell_QAbstractItemView::selectionCommand(const QModelIndex&  index0, const QEvent*  event1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::selectionCommand")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectionCommand");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4468,7 +4468,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setModel(QAbstractItemModel*  model0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::setModel")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setModel");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4490,7 +4490,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setRootIndex(const QModelIndex&  index0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::setRootIndex")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setRootIndex");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4512,7 +4512,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setSelection(const QRect&  rect0, QItemSelectionModel::SelectionFlags  command1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::setSelection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setSelection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4534,7 +4534,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setSelectionModel(QItemSelectionModel*  selectionModel0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::setSelectionModel")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setSelectionModel");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4556,7 +4556,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4578,7 +4578,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::setupViewport(QWidget*  viewport0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::setupViewport")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setupViewport");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4600,7 +4600,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QAbstractItemView::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4633,7 +4633,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4655,7 +4655,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractItemView::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4688,7 +4688,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::sizeHintForColumn(int  column0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::sizeHintForColumn")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHintForColumn");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4721,7 +4721,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::sizeHintForRow(int  row0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::sizeHintForRow")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHintForRow");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4754,7 +4754,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::startDrag(Qt::DropActions  supportedActions0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::startDrag")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("startDrag");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4776,7 +4776,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4798,7 +4798,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4820,7 +4820,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::updateEditorData()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::updateEditorData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateEditorData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4842,7 +4842,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::updateEditorGeometries()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::updateEditorGeometries")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateEditorGeometries");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4864,7 +4864,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::updateGeometries()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::updateGeometries")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateGeometries");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4886,7 +4886,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractItemView::verticalOffset() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::verticalOffset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("verticalOffset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4919,7 +4919,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::verticalScrollbarAction(int  action0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::verticalScrollbarAction")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("verticalScrollbarAction");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4941,7 +4941,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::verticalScrollbarValueChanged(int  value0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::verticalScrollbarValueChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("verticalScrollbarValueChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4963,7 +4963,7 @@ if (_wrapper) {
 QStyleOptionViewItem  PythonQtShell_QAbstractItemView::viewOptions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::viewOptions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewOptions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -4996,7 +4996,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractItemView::viewportEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::viewportEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewportEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5029,7 +5029,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractItemView::viewportSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::viewportSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewportSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5062,7 +5062,7 @@ if (_wrapper) {
 QRect  PythonQtShell_QAbstractItemView::visualRect(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::visualRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("visualRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5095,7 +5095,7 @@ if (_wrapper) {
 QRegion  PythonQtShell_QAbstractItemView::visualRegionForSelection(const QItemSelection&  selection0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::visualRegionForSelection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("visualRegionForSelection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5128,7 +5128,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractItemView::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractItemView::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5578,7 +5578,7 @@ PythonQtShell_QAbstractPrintDialog::~PythonQtShell_QAbstractPrintDialog() {
 void PythonQtShell_QAbstractPrintDialog::accept()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::accept")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("accept");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5600,7 +5600,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5622,7 +5622,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5644,7 +5644,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5666,7 +5666,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5688,7 +5688,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5710,7 +5710,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5732,7 +5732,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5765,7 +5765,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::done(int  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::done")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("done");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5787,7 +5787,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5809,7 +5809,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5831,7 +5831,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5853,7 +5853,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5875,7 +5875,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5897,7 +5897,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5930,7 +5930,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5963,7 +5963,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::exec()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::exec")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("exec");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -5996,7 +5996,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6018,7 +6018,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6051,7 +6051,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6073,7 +6073,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6106,7 +6106,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6139,7 +6139,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6161,7 +6161,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6183,7 +6183,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6205,7 +6205,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractPrintDialog::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6238,7 +6238,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6260,7 +6260,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6282,7 +6282,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6304,7 +6304,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractPrintDialog::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6337,7 +6337,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractPrintDialog::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6370,7 +6370,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6392,7 +6392,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6414,7 +6414,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mousePressEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6436,7 +6436,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::mouseReleaseEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6458,7 +6458,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6480,7 +6480,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractPrintDialog::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6513,7 +6513,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::open()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::open")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("open");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6535,7 +6535,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractPrintDialog::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6568,7 +6568,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::paintEvent(QPaintEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6590,7 +6590,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QAbstractPrintDialog::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6623,7 +6623,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::reject()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::reject")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reject");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6645,7 +6645,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6667,7 +6667,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6689,7 +6689,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QAbstractPrintDialog::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6722,7 +6722,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6744,7 +6744,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractPrintDialog::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6777,7 +6777,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6799,7 +6799,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6821,7 +6821,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractPrintDialog::wheelEvent(QWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractPrintDialog::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6936,7 +6936,7 @@ PythonQtShell_QAbstractProxyModel::~PythonQtShell_QAbstractProxyModel() {
 QModelIndex  PythonQtShell_QAbstractProxyModel::buddy(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::buddy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("buddy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -6969,7 +6969,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::canDropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::canDropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canDropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7002,7 +7002,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::canFetchMore(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::canFetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canFetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7035,7 +7035,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractProxyModel::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7057,7 +7057,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractProxyModel::columnCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::columnCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("columnCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7090,7 +7090,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractProxyModel::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7112,7 +7112,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractProxyModel::data(const QModelIndex&  proxyIndex0, int  role1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::data")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("data");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7145,7 +7145,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::dropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::dropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7178,7 +7178,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7211,7 +7211,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7244,7 +7244,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractProxyModel::fetchMore(const QModelIndex&  parent0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::fetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7266,7 +7266,7 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QAbstractProxyModel::flags(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::flags")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("flags");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7299,7 +7299,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::hasChildren(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::hasChildren")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasChildren");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7332,7 +7332,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractProxyModel::headerData(int  section0, Qt::Orientation  orientation1, int  role2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::headerData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("headerData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7365,7 +7365,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractProxyModel::index(int  row0, int  column1, const QModelIndex&  parent2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::index")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("index");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7398,7 +7398,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::insertColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::insertColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7431,7 +7431,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::insertRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::insertRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7464,7 +7464,7 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QAbstractProxyModel::itemData(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::itemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7497,7 +7497,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractProxyModel::mapFromSource(const QModelIndex&  sourceIndex0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::mapFromSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapFromSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7530,7 +7530,7 @@ if (_wrapper) {
 QItemSelection  PythonQtShell_QAbstractProxyModel::mapSelectionFromSource(const QItemSelection&  selection0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::mapSelectionFromSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapSelectionFromSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7563,7 +7563,7 @@ if (_wrapper) {
 QItemSelection  PythonQtShell_QAbstractProxyModel::mapSelectionToSource(const QItemSelection&  selection0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::mapSelectionToSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapSelectionToSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7596,7 +7596,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractProxyModel::mapToSource(const QModelIndex&  proxyIndex0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::mapToSource")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mapToSource");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7629,7 +7629,7 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractProxyModel::match(const QModelIndex&  start0, int  role1, const QVariant&  value2, int  hits3, Qt::MatchFlags  flags4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::match")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("match");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7662,7 +7662,7 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QAbstractProxyModel::mimeData(const QList<QModelIndex >&  indexes0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::mimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7695,7 +7695,7 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAbstractProxyModel::mimeTypes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::mimeTypes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeTypes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7728,7 +7728,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::moveColumns(const QModelIndex&  sourceParent0, int  sourceColumn1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::moveColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7761,7 +7761,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::moveRows(const QModelIndex&  sourceParent0, int  sourceRow1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::moveRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7794,7 +7794,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractProxyModel::parent(const QModelIndex&  child0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::parent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("parent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7827,7 +7827,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::removeColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::removeColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7860,7 +7860,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::removeRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::removeRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7893,7 +7893,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractProxyModel::revert()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::revert")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("revert");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7915,7 +7915,7 @@ if (_wrapper) {
 QHash<int , QByteArray >  PythonQtShell_QAbstractProxyModel::roleNames() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::roleNames")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("roleNames");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7948,7 +7948,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractProxyModel::rowCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::rowCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -7981,7 +7981,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::setData(const QModelIndex&  index0, const QVariant&  value1, int  role2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::setData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8014,7 +8014,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::setHeaderData(int  section0, Qt::Orientation  orientation1, const QVariant&  value2, int  role3)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::setHeaderData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setHeaderData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8047,7 +8047,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::setItemData(const QModelIndex&  index0, const QMap<int , QVariant >&  roles1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::setItemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setItemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8080,7 +8080,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractProxyModel::setSourceModel(QAbstractItemModel*  sourceModel0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::setSourceModel")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setSourceModel");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8102,7 +8102,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractProxyModel::sibling(int  row0, int  column1, const QModelIndex&  idx2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::sibling")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sibling");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8135,7 +8135,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractProxyModel::sort(int  column0, Qt::SortOrder  order1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::sort")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sort");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8157,7 +8157,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractProxyModel::span(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::span")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("span");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8190,7 +8190,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractProxyModel::submit()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::submit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("submit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8223,7 +8223,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractProxyModel::supportedDragActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::supportedDragActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDragActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8256,7 +8256,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractProxyModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::supportedDropActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDropActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8289,7 +8289,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractProxyModel::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractProxyModel::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8364,7 +8364,7 @@ PythonQtShell_QAbstractScrollArea::~PythonQtShell_QAbstractScrollArea() {
 void PythonQtShell_QAbstractScrollArea::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8386,7 +8386,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8408,7 +8408,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8430,7 +8430,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8452,7 +8452,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8474,7 +8474,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8496,7 +8496,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractScrollArea::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8529,7 +8529,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dragEnterEvent(QDragEnterEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8551,7 +8551,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dragLeaveEvent(QDragLeaveEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8573,7 +8573,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dragMoveEvent(QDragMoveEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8595,7 +8595,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::dropEvent(QDropEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8617,7 +8617,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8639,7 +8639,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8672,7 +8672,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8705,7 +8705,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8727,7 +8727,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8760,7 +8760,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8782,7 +8782,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8815,7 +8815,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractScrollArea::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8848,7 +8848,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8870,7 +8870,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8892,7 +8892,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8914,7 +8914,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractScrollArea::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8947,7 +8947,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8969,7 +8969,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -8991,7 +8991,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9013,7 +9013,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractScrollArea::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9046,7 +9046,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractScrollArea::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9079,7 +9079,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mouseDoubleClickEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9101,7 +9101,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9123,7 +9123,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mousePressEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9145,7 +9145,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::mouseReleaseEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9167,7 +9167,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9189,7 +9189,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9222,7 +9222,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractScrollArea::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9255,7 +9255,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9277,7 +9277,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QAbstractScrollArea::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9310,7 +9310,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9332,7 +9332,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::scrollContentsBy(int  dx0, int  dy1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::scrollContentsBy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("scrollContentsBy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9354,7 +9354,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9376,7 +9376,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::setupViewport(QWidget*  viewport0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::setupViewport")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setupViewport");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9398,7 +9398,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QAbstractScrollArea::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9431,7 +9431,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9453,7 +9453,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractScrollArea::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9486,7 +9486,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9508,7 +9508,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9530,7 +9530,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractScrollArea::viewportEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::viewportEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewportEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9563,7 +9563,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractScrollArea::viewportSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::viewportSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewportSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9596,7 +9596,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractScrollArea::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractScrollArea::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9766,7 +9766,7 @@ PythonQtShell_QAbstractSlider::~PythonQtShell_QAbstractSlider() {
 void PythonQtShell_QAbstractSlider::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9788,7 +9788,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::changeEvent(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9810,7 +9810,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9832,7 +9832,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9854,7 +9854,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::contextMenuEvent(QContextMenuEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9876,7 +9876,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9898,7 +9898,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSlider::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9931,7 +9931,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9953,7 +9953,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9975,7 +9975,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -9997,7 +9997,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10019,7 +10019,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10041,7 +10041,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10074,7 +10074,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10107,7 +10107,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10129,7 +10129,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10162,7 +10162,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10184,7 +10184,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10217,7 +10217,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSlider::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10250,7 +10250,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10272,7 +10272,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10294,7 +10294,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10316,7 +10316,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractSlider::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10349,7 +10349,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::keyPressEvent(QKeyEvent*  ev0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10371,7 +10371,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10393,7 +10393,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10415,7 +10415,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSlider::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10448,7 +10448,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractSlider::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::getMinimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("getMinimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10481,7 +10481,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10503,7 +10503,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10525,7 +10525,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mousePressEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10547,7 +10547,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::mouseReleaseEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10569,7 +10569,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10591,7 +10591,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSlider::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10624,7 +10624,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractSlider::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10657,7 +10657,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::paintEvent(QPaintEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10679,7 +10679,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QAbstractSlider::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10712,7 +10712,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10734,7 +10734,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10756,7 +10756,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QAbstractSlider::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10789,7 +10789,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10811,7 +10811,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractSlider::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::getSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("getSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10844,7 +10844,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::sliderChange(QAbstractSlider::SliderChange  change0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::sliderChange")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sliderChange");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10866,7 +10866,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10888,7 +10888,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::timerEvent(QTimerEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -10910,7 +10910,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSlider::wheelEvent(QWheelEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSlider::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11075,7 +11075,7 @@ PythonQtShell_QAbstractSpinBox::~PythonQtShell_QAbstractSpinBox() {
 void PythonQtShell_QAbstractSpinBox::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11097,7 +11097,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::changeEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11119,7 +11119,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11141,7 +11141,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::clear()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::clear")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("clear");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11163,7 +11163,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11185,7 +11185,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::contextMenuEvent(QContextMenuEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11207,7 +11207,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11229,7 +11229,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSpinBox::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11262,7 +11262,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11284,7 +11284,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11306,7 +11306,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11328,7 +11328,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11350,7 +11350,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11372,7 +11372,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11405,7 +11405,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11438,7 +11438,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::fixup(QString&  input0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::fixup")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fixup");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11460,7 +11460,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11482,7 +11482,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11515,7 +11515,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11537,7 +11537,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11570,7 +11570,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSpinBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11603,7 +11603,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11625,7 +11625,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11647,7 +11647,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11669,7 +11669,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractSpinBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11702,7 +11702,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::keyPressEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11724,7 +11724,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11746,7 +11746,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11768,7 +11768,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractSpinBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11801,7 +11801,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractSpinBox::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11834,7 +11834,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11856,7 +11856,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11878,7 +11878,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mousePressEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11900,7 +11900,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::mouseReleaseEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11922,7 +11922,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11944,7 +11944,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractSpinBox::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -11977,7 +11977,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QAbstractSpinBox::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12010,7 +12010,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::paintEvent(QPaintEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12032,7 +12032,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QAbstractSpinBox::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12065,7 +12065,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12087,7 +12087,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12109,7 +12109,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QAbstractSpinBox::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12142,7 +12142,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12164,7 +12164,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractSpinBox::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12197,7 +12197,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::stepBy(int  steps0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::stepBy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("stepBy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12219,7 +12219,7 @@ if (_wrapper) {
 QAbstractSpinBox::StepEnabled  PythonQtShell_QAbstractSpinBox::stepEnabled() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::stepEnabled")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("stepEnabled");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12252,7 +12252,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12274,7 +12274,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12296,7 +12296,7 @@ if (_wrapper) {
 QValidator::State  PythonQtShell_QAbstractSpinBox::validate(QString&  input0, int&  pos1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::validate")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("validate");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12329,7 +12329,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractSpinBox::wheelEvent(QWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractSpinBox::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12534,7 +12534,7 @@ PythonQtShell_QAbstractTableModel::~PythonQtShell_QAbstractTableModel() {
 QModelIndex  PythonQtShell_QAbstractTableModel::buddy(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::buddy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("buddy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12567,7 +12567,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::canDropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::canDropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canDropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12600,7 +12600,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::canFetchMore(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::canFetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("canFetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12633,7 +12633,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12655,7 +12655,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractTableModel::columnCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::columnCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("columnCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12688,7 +12688,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12710,7 +12710,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractTableModel::data(const QModelIndex&  index0, int  role1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::data")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("data");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12743,7 +12743,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::dropMimeData(const QMimeData*  data0, Qt::DropAction  action1, int  row2, int  column3, const QModelIndex&  parent4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::dropMimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropMimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12776,7 +12776,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12809,7 +12809,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12842,7 +12842,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::fetchMore(const QModelIndex&  parent0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::fetchMore")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("fetchMore");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12864,7 +12864,7 @@ if (_wrapper) {
 Qt::ItemFlags  PythonQtShell_QAbstractTableModel::flags(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::flags")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("flags");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12897,7 +12897,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QAbstractTableModel::headerData(int  section0, Qt::Orientation  orientation1, int  role2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::headerData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("headerData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12930,7 +12930,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractTableModel::index(int  row0, int  column1, const QModelIndex&  parent2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::index")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("index");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12963,7 +12963,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::insertColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::insertColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -12996,7 +12996,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::insertRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::insertRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("insertRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13029,7 +13029,7 @@ if (_wrapper) {
 QMap<int , QVariant >  PythonQtShell_QAbstractTableModel::itemData(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::itemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13062,7 +13062,7 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QAbstractTableModel::match(const QModelIndex&  start0, int  role1, const QVariant&  value2, int  hits3, Qt::MatchFlags  flags4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::match")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("match");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13095,7 +13095,7 @@ if (_wrapper) {
 QMimeData*  PythonQtShell_QAbstractTableModel::mimeData(const QList<QModelIndex >&  indexes0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::mimeData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13128,7 +13128,7 @@ if (_wrapper) {
 QStringList  PythonQtShell_QAbstractTableModel::mimeTypes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::mimeTypes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mimeTypes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13161,7 +13161,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::moveColumns(const QModelIndex&  sourceParent0, int  sourceColumn1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::moveColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13194,7 +13194,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::moveRows(const QModelIndex&  sourceParent0, int  sourceRow1, int  count2, const QModelIndex&  destinationParent3, int  destinationChild4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::moveRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13227,7 +13227,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::removeColumns(int  column0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::removeColumns")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeColumns");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13260,7 +13260,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::removeRows(int  row0, int  count1, const QModelIndex&  parent2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::removeRows")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("removeRows");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13293,7 +13293,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::revert()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::revert")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("revert");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13315,7 +13315,7 @@ if (_wrapper) {
 QHash<int , QByteArray >  PythonQtShell_QAbstractTableModel::roleNames() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::roleNames")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("roleNames");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13348,7 +13348,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractTableModel::rowCount(const QModelIndex&  parent0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::rowCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13381,7 +13381,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::setData(const QModelIndex&  index0, const QVariant&  value1, int  role2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::setData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13414,7 +13414,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::setHeaderData(int  section0, Qt::Orientation  orientation1, const QVariant&  value2, int  role3)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::setHeaderData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setHeaderData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13447,7 +13447,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::setItemData(const QModelIndex&  index0, const QMap<int , QVariant >&  roles1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::setItemData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setItemData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13480,7 +13480,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QAbstractTableModel::sibling(int  row0, int  column1, const QModelIndex&  idx2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::sibling")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sibling");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13513,7 +13513,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::sort(int  column0, Qt::SortOrder  order1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::sort")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sort");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13535,7 +13535,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QAbstractTableModel::span(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::span")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("span");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13568,7 +13568,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTableModel::submit()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::submit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("submit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13601,7 +13601,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractTableModel::supportedDragActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::supportedDragActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDragActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13634,7 +13634,7 @@ if (_wrapper) {
 Qt::DropActions  PythonQtShell_QAbstractTableModel::supportedDropActions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::supportedDropActions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("supportedDropActions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13667,7 +13667,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTableModel::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTableModel::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13712,7 +13712,7 @@ PythonQtShell_QAbstractTextDocumentLayout::~PythonQtShell_QAbstractTextDocumentL
 QRectF  PythonQtShell_QAbstractTextDocumentLayout::blockBoundingRect(const QTextBlock&  block0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::blockBoundingRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("blockBoundingRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13745,7 +13745,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13767,7 +13767,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13789,7 +13789,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::documentChanged(int  from0, int  charsRemoved1, int  charsAdded2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::documentChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("documentChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13811,7 +13811,7 @@ if (_wrapper) {
 QSizeF  PythonQtShell_QAbstractTextDocumentLayout::documentSize() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::documentSize")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("documentSize");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13844,7 +13844,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::draw(QPainter*  painter0, const QAbstractTextDocumentLayout::PaintContext&  context1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::draw")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("draw");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13866,7 +13866,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::drawInlineObject(QPainter*  painter0, const QRectF&  rect1, QTextInlineObject  object2, int  posInDocument3, const QTextFormat&  format4)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::drawInlineObject")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("drawInlineObject");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13888,7 +13888,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTextDocumentLayout::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13921,7 +13921,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAbstractTextDocumentLayout::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13954,7 +13954,7 @@ if (_wrapper) {
 QRectF  PythonQtShell_QAbstractTextDocumentLayout::frameBoundingRect(QTextFrame*  frame0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::frameBoundingRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("frameBoundingRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -13987,7 +13987,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractTextDocumentLayout::hitTest(const QPointF&  point0, Qt::HitTestAccuracy  accuracy1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::hitTest")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hitTest");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14020,7 +14020,7 @@ if (_wrapper) {
 int  PythonQtShell_QAbstractTextDocumentLayout::pageCount() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::pageCount")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pageCount");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14053,7 +14053,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::positionInlineObject(QTextInlineObject  item0, int  posInDocument1, const QTextFormat&  format2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::positionInlineObject")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("positionInlineObject");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14075,7 +14075,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::resizeInlineObject(QTextInlineObject  item0, int  posInDocument1, const QTextFormat&  format2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::resizeInlineObject")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeInlineObject");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14097,7 +14097,7 @@ if (_wrapper) {
 void PythonQtShell_QAbstractTextDocumentLayout::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAbstractTextDocumentLayout::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14299,7 +14299,7 @@ PythonQtShell_QAction::~PythonQtShell_QAction() {
 void PythonQtShell_QAction::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAction::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14321,7 +14321,7 @@ if (_wrapper) {
 void PythonQtShell_QAction::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAction::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14343,7 +14343,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAction::event(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAction::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14376,7 +14376,7 @@ if (_wrapper) {
 bool  PythonQtShell_QAction::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAction::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14409,7 +14409,7 @@ if (_wrapper) {
 void PythonQtShell_QAction::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QAction::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14730,7 +14730,7 @@ PythonQtShell_QActionGroup::~PythonQtShell_QActionGroup() {
 void PythonQtShell_QActionGroup::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QActionGroup::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14752,7 +14752,7 @@ if (_wrapper) {
 void PythonQtShell_QActionGroup::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QActionGroup::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14774,7 +14774,7 @@ if (_wrapper) {
 bool  PythonQtShell_QActionGroup::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QActionGroup::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14807,7 +14807,7 @@ if (_wrapper) {
 bool  PythonQtShell_QActionGroup::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QActionGroup::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -14840,7 +14840,7 @@ if (_wrapper) {
 void PythonQtShell_QActionGroup::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QActionGroup::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15218,7 +15218,7 @@ PythonQtShell_QBoxLayout::~PythonQtShell_QBoxLayout() {
 void PythonQtShell_QBoxLayout::addItem(QLayoutItem*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::addItem")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("addItem");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15240,7 +15240,7 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::childEvent(QChildEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15262,7 +15262,7 @@ if (_wrapper) {
 QSizePolicy::ControlTypes  PythonQtShell_QBoxLayout::controlTypes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::controlTypes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("controlTypes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15295,7 +15295,7 @@ if (_wrapper) {
 int  PythonQtShell_QBoxLayout::count() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::count")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("count");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15328,7 +15328,7 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15350,7 +15350,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBoxLayout::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15383,7 +15383,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBoxLayout::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15416,7 +15416,7 @@ if (_wrapper) {
 Qt::Orientations  PythonQtShell_QBoxLayout::expandingDirections() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::expandingDirections")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("expandingDirections");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15449,7 +15449,7 @@ if (_wrapper) {
 QRect  PythonQtShell_QBoxLayout::geometry() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::geometry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("geometry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15482,7 +15482,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBoxLayout::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15515,7 +15515,7 @@ if (_wrapper) {
 int  PythonQtShell_QBoxLayout::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15548,7 +15548,7 @@ if (_wrapper) {
 int  PythonQtShell_QBoxLayout::indexOf(QWidget*  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::indexOf")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("indexOf");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15581,7 +15581,7 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::invalidate()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::invalidate")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("invalidate");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15603,7 +15603,7 @@ if (_wrapper) {
 bool  PythonQtShell_QBoxLayout::isEmpty() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::isEmpty")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isEmpty");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15636,7 +15636,7 @@ if (_wrapper) {
 QLayoutItem*  PythonQtShell_QBoxLayout::itemAt(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::itemAt")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemAt");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15669,7 +15669,7 @@ if (_wrapper) {
 QLayout*  PythonQtShell_QBoxLayout::layout()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::layout")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("layout");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15702,7 +15702,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QBoxLayout::maximumSize() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::maximumSize")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("maximumSize");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15735,7 +15735,7 @@ if (_wrapper) {
 int  PythonQtShell_QBoxLayout::minimumHeightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::minimumHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15768,7 +15768,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QBoxLayout::minimumSize() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::minimumSize")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSize");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15801,7 +15801,7 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::setGeometry(const QRect&  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::setGeometry")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setGeometry");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15823,7 +15823,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QBoxLayout::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15856,7 +15856,7 @@ if (_wrapper) {
 QLayoutItem*  PythonQtShell_QBoxLayout::takeAt(int  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::takeAt")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("takeAt");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -15889,7 +15889,7 @@ if (_wrapper) {
 void PythonQtShell_QBoxLayout::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QBoxLayout::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16054,7 +16054,7 @@ PythonQtShell_QButtonGroup::~PythonQtShell_QButtonGroup() {
 void PythonQtShell_QButtonGroup::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QButtonGroup::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16076,7 +16076,7 @@ if (_wrapper) {
 void PythonQtShell_QButtonGroup::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QButtonGroup::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16098,7 +16098,7 @@ if (_wrapper) {
 bool  PythonQtShell_QButtonGroup::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QButtonGroup::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16131,7 +16131,7 @@ if (_wrapper) {
 bool  PythonQtShell_QButtonGroup::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QButtonGroup::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16164,7 +16164,7 @@ if (_wrapper) {
 void PythonQtShell_QButtonGroup::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QButtonGroup::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16259,7 +16259,7 @@ PythonQtShell_QCalendarWidget::~PythonQtShell_QCalendarWidget() {
 void PythonQtShell_QCalendarWidget::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16281,7 +16281,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16303,7 +16303,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16325,7 +16325,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16347,7 +16347,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::contextMenuEvent(QContextMenuEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16369,7 +16369,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16391,7 +16391,7 @@ if (_wrapper) {
 int  PythonQtShell_QCalendarWidget::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16424,7 +16424,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16446,7 +16446,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16468,7 +16468,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16490,7 +16490,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16512,7 +16512,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16534,7 +16534,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16567,7 +16567,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16600,7 +16600,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16622,7 +16622,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16655,7 +16655,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16677,7 +16677,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16710,7 +16710,7 @@ if (_wrapper) {
 int  PythonQtShell_QCalendarWidget::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16743,7 +16743,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16765,7 +16765,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16787,7 +16787,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16809,7 +16809,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QCalendarWidget::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16842,7 +16842,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::keyPressEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16864,7 +16864,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16886,7 +16886,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16908,7 +16908,7 @@ if (_wrapper) {
 int  PythonQtShell_QCalendarWidget::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16941,7 +16941,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QCalendarWidget::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::getMinimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("getMinimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16974,7 +16974,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -16996,7 +16996,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17018,7 +17018,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mousePressEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17040,7 +17040,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::mouseReleaseEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17062,7 +17062,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17084,7 +17084,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCalendarWidget::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17117,7 +17117,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::paintCell(QPainter*  painter0, const QRect&  rect1, const QDate&  date2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::paintCell")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintCell");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17139,7 +17139,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QCalendarWidget::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17172,7 +17172,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::paintEvent(QPaintEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17194,7 +17194,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QCalendarWidget::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17227,7 +17227,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17249,7 +17249,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17271,7 +17271,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QCalendarWidget::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17304,7 +17304,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17326,7 +17326,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QCalendarWidget::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::getSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("getSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17359,7 +17359,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17381,7 +17381,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17403,7 +17403,7 @@ if (_wrapper) {
 void PythonQtShell_QCalendarWidget::wheelEvent(QWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCalendarWidget::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17603,7 +17603,7 @@ PythonQtShell_QCheckBox::~PythonQtShell_QCheckBox() {
 void PythonQtShell_QCheckBox::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17625,7 +17625,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::changeEvent(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17647,7 +17647,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::checkStateSet()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::checkStateSet")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("checkStateSet");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17669,7 +17669,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17691,7 +17691,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17713,7 +17713,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::contextMenuEvent(QContextMenuEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17735,7 +17735,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17757,7 +17757,7 @@ if (_wrapper) {
 int  PythonQtShell_QCheckBox::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17790,7 +17790,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17812,7 +17812,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17834,7 +17834,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17856,7 +17856,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17878,7 +17878,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17900,7 +17900,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17933,7 +17933,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17966,7 +17966,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::focusInEvent(QFocusEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -17988,7 +17988,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18021,7 +18021,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::focusOutEvent(QFocusEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18043,7 +18043,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18076,7 +18076,7 @@ if (_wrapper) {
 int  PythonQtShell_QCheckBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18109,7 +18109,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18131,7 +18131,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::hitButton(const QPoint&  pos0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::hitButton")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hitButton");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18164,7 +18164,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18186,7 +18186,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18208,7 +18208,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QCheckBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18241,7 +18241,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::keyPressEvent(QKeyEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18263,7 +18263,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::keyReleaseEvent(QKeyEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18285,7 +18285,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18307,7 +18307,7 @@ if (_wrapper) {
 int  PythonQtShell_QCheckBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18340,7 +18340,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QCheckBox::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18373,7 +18373,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18395,7 +18395,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mouseMoveEvent(QMouseEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18417,7 +18417,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mousePressEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18439,7 +18439,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::mouseReleaseEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18461,7 +18461,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18483,7 +18483,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCheckBox::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18516,7 +18516,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::nextCheckState()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::nextCheckState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nextCheckState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18538,7 +18538,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QCheckBox::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18571,7 +18571,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18593,7 +18593,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QCheckBox::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18626,7 +18626,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18648,7 +18648,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18670,7 +18670,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QCheckBox::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18703,7 +18703,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18725,7 +18725,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QCheckBox::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18758,7 +18758,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18780,7 +18780,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::timerEvent(QTimerEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18802,7 +18802,7 @@ if (_wrapper) {
 void PythonQtShell_QCheckBox::wheelEvent(QWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCheckBox::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18969,7 +18969,7 @@ PythonQtShell_QColorDialog::~PythonQtShell_QColorDialog() {
 void PythonQtShell_QColorDialog::accept()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::accept")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("accept");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -18991,7 +18991,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19013,7 +19013,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::changeEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19035,7 +19035,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19057,7 +19057,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::closeEvent(QCloseEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19079,7 +19079,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19101,7 +19101,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19123,7 +19123,7 @@ if (_wrapper) {
 int  PythonQtShell_QColorDialog::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19156,7 +19156,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::done(int  result0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::done")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("done");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19178,7 +19178,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19200,7 +19200,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19222,7 +19222,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19244,7 +19244,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19266,7 +19266,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19288,7 +19288,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19321,7 +19321,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::eventFilter(QObject*  arg__1, QEvent*  arg__2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19354,7 +19354,7 @@ if (_wrapper) {
 int  PythonQtShell_QColorDialog::exec()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::exec")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("exec");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19387,7 +19387,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19409,7 +19409,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19442,7 +19442,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19464,7 +19464,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19497,7 +19497,7 @@ if (_wrapper) {
 int  PythonQtShell_QColorDialog::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19530,7 +19530,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19552,7 +19552,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19574,7 +19574,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19596,7 +19596,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QColorDialog::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19629,7 +19629,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19651,7 +19651,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19673,7 +19673,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19695,7 +19695,7 @@ if (_wrapper) {
 int  PythonQtShell_QColorDialog::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19728,7 +19728,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QColorDialog::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19761,7 +19761,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19783,7 +19783,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19805,7 +19805,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mousePressEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19827,7 +19827,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::mouseReleaseEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19849,7 +19849,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19871,7 +19871,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColorDialog::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19904,7 +19904,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QColorDialog::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19937,7 +19937,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::paintEvent(QPaintEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19959,7 +19959,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QColorDialog::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -19992,7 +19992,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::reject()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::reject")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reject");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20014,7 +20014,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::resizeEvent(QResizeEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20036,7 +20036,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20058,7 +20058,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QColorDialog::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20091,7 +20091,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::showEvent(QShowEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20113,7 +20113,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QColorDialog::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20146,7 +20146,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20168,7 +20168,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20190,7 +20190,7 @@ if (_wrapper) {
 void PythonQtShell_QColorDialog::wheelEvent(QWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColorDialog::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20314,7 +20314,7 @@ PythonQtShell_QColumnView::~PythonQtShell_QColumnView() {
 void PythonQtShell_QColumnView::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20336,7 +20336,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::changeEvent(QEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20358,7 +20358,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20380,7 +20380,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::closeEditor(QWidget*  editor0, QAbstractItemDelegate::EndEditHint  hint1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::closeEditor")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEditor");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20402,7 +20402,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20424,7 +20424,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::commitData(QWidget*  editor0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::commitData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("commitData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20446,7 +20446,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::contextMenuEvent(QContextMenuEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20468,7 +20468,7 @@ if (_wrapper) {
 QAbstractItemView*  PythonQtShell_QColumnView::createColumn(const QModelIndex&  rootIndex0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::createColumn")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("createColumn");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20501,7 +20501,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::currentChanged(const QModelIndex&  current0, const QModelIndex&  previous1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::currentChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("currentChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20523,7 +20523,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20545,7 +20545,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dataChanged(const QModelIndex&  topLeft0, const QModelIndex&  bottomRight1, const QVector<int >&  roles2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::dataChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dataChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20567,7 +20567,7 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20600,7 +20600,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::doItemsLayout()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::doItemsLayout")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("doItemsLayout");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20622,7 +20622,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20644,7 +20644,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20666,7 +20666,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20688,7 +20688,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20710,7 +20710,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::edit(const QModelIndex&  index0, QAbstractItemView::EditTrigger  trigger1, QEvent*  event2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::edit")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("edit");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20743,7 +20743,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::editorDestroyed(QObject*  editor0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::editorDestroyed")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("editorDestroyed");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20765,7 +20765,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20787,7 +20787,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20820,7 +20820,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::eventFilter(QObject*  object0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20853,7 +20853,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::focusInEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20875,7 +20875,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20908,7 +20908,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::focusOutEvent(QFocusEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20930,7 +20930,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20963,7 +20963,7 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -20996,7 +20996,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21018,7 +21018,7 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::horizontalOffset() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::horizontalOffset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("horizontalOffset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21051,7 +21051,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::horizontalScrollbarAction(int  action0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::horizontalScrollbarAction")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("horizontalScrollbarAction");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21073,7 +21073,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::horizontalScrollbarValueChanged(int  value0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::horizontalScrollbarValueChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("horizontalScrollbarValueChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21095,7 +21095,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QColumnView::indexAt(const QPoint&  point0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::indexAt")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("indexAt");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21128,7 +21128,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21150,7 +21150,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::inputMethodEvent(QInputMethodEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21172,7 +21172,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QColumnView::inputMethodQuery(Qt::InputMethodQuery  query0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21205,7 +21205,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::isIndexHidden(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::isIndexHidden")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("isIndexHidden");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21238,7 +21238,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::keyPressEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21260,7 +21260,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::keyReleaseEvent(QKeyEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21282,7 +21282,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::keyboardSearch(const QString&  search0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::keyboardSearch")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyboardSearch");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21304,7 +21304,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21326,7 +21326,7 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21359,7 +21359,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QColumnView::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21392,7 +21392,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21414,7 +21414,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21436,7 +21436,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mousePressEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21458,7 +21458,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::mouseReleaseEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21480,7 +21480,7 @@ if (_wrapper) {
 QModelIndex  PythonQtShell_QColumnView::moveCursor(QAbstractItemView::CursorAction  cursorAction0, Qt::KeyboardModifiers  modifiers1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::moveCursor")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveCursor");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21513,7 +21513,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21535,7 +21535,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21568,7 +21568,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QColumnView::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21601,7 +21601,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21623,7 +21623,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QColumnView::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21656,7 +21656,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::reset()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::reset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("reset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21678,7 +21678,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21700,7 +21700,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::rowsAboutToBeRemoved(const QModelIndex&  parent0, int  start1, int  end2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::rowsAboutToBeRemoved")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowsAboutToBeRemoved");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21722,7 +21722,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::rowsInserted(const QModelIndex&  parent0, int  start1, int  end2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::rowsInserted")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("rowsInserted");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21744,7 +21744,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::scrollContentsBy(int  dx0, int  dy1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::scrollContentsBy")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("scrollContentsBy");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21766,7 +21766,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::scrollTo(const QModelIndex&  index0, QAbstractItemView::ScrollHint  hint1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::scrollTo")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("scrollTo");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21788,7 +21788,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::selectAll()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::selectAll")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectAll");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21810,7 +21810,7 @@ if (_wrapper) {
 QList<QModelIndex >  PythonQtShell_QColumnView::selectedIndexes() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::selectedIndexes")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectedIndexes");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21843,7 +21843,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::selectionChanged(const QItemSelection&  selected0, const QItemSelection&  deselected1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::selectionChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectionChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21865,7 +21865,7 @@ if (_wrapper) {
 QItemSelectionModel::SelectionFlags  PythonQtShell_QColumnView::selectionCommand(const QModelIndex&  index0, const QEvent*  event1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::selectionCommand")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("selectionCommand");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21898,7 +21898,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setModel(QAbstractItemModel*  model0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::setModel")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setModel");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21920,7 +21920,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setRootIndex(const QModelIndex&  index0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::setRootIndex")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setRootIndex");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21942,7 +21942,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setSelection(const QRect&  rect0, QItemSelectionModel::SelectionFlags  command1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::setSelection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setSelection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21964,7 +21964,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setSelectionModel(QItemSelectionModel*  selectionModel0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::setSelectionModel")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setSelectionModel");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -21986,7 +21986,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22008,7 +22008,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::setupViewport(QWidget*  viewport0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::setupViewport")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setupViewport");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22030,7 +22030,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QColumnView::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22063,7 +22063,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22085,7 +22085,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QColumnView::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22118,7 +22118,7 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::sizeHintForColumn(int  column0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::sizeHintForColumn")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHintForColumn");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22151,7 +22151,7 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::sizeHintForRow(int  row0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::sizeHintForRow")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHintForRow");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22184,7 +22184,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::startDrag(Qt::DropActions  supportedActions0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::startDrag")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("startDrag");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22206,7 +22206,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22228,7 +22228,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22250,7 +22250,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::updateEditorData()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::updateEditorData")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateEditorData");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22272,7 +22272,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::updateEditorGeometries()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::updateEditorGeometries")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateEditorGeometries");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22294,7 +22294,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::updateGeometries()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::updateGeometries")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("updateGeometries");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22316,7 +22316,7 @@ if (_wrapper) {
 int  PythonQtShell_QColumnView::verticalOffset() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::verticalOffset")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("verticalOffset");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22349,7 +22349,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::verticalScrollbarAction(int  action0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::verticalScrollbarAction")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("verticalScrollbarAction");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22371,7 +22371,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::verticalScrollbarValueChanged(int  value0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::verticalScrollbarValueChanged")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("verticalScrollbarValueChanged");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22393,7 +22393,7 @@ if (_wrapper) {
 QStyleOptionViewItem  PythonQtShell_QColumnView::viewOptions() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::viewOptions")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewOptions");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22426,7 +22426,7 @@ if (_wrapper) {
 bool  PythonQtShell_QColumnView::viewportEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::viewportEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewportEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22459,7 +22459,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QColumnView::viewportSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::viewportSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("viewportSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22492,7 +22492,7 @@ if (_wrapper) {
 QRect  PythonQtShell_QColumnView::visualRect(const QModelIndex&  index0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::visualRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("visualRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22525,7 +22525,7 @@ if (_wrapper) {
 QRegion  PythonQtShell_QColumnView::visualRegionForSelection(const QItemSelection&  selection0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::visualRegionForSelection")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("visualRegionForSelection");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22558,7 +22558,7 @@ if (_wrapper) {
 void PythonQtShell_QColumnView::wheelEvent(QWheelEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QColumnView::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22643,7 +22643,7 @@ PythonQtShell_QComboBox::~PythonQtShell_QComboBox() {
 void PythonQtShell_QComboBox::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22665,7 +22665,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::changeEvent(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22687,7 +22687,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22709,7 +22709,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22731,7 +22731,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::contextMenuEvent(QContextMenuEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22753,7 +22753,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22775,7 +22775,7 @@ if (_wrapper) {
 int  PythonQtShell_QComboBox::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22808,7 +22808,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22830,7 +22830,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22852,7 +22852,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22874,7 +22874,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22896,7 +22896,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22918,7 +22918,7 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22951,7 +22951,7 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -22984,7 +22984,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::focusInEvent(QFocusEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23006,7 +23006,7 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23039,7 +23039,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::focusOutEvent(QFocusEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23061,7 +23061,7 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23094,7 +23094,7 @@ if (_wrapper) {
 int  PythonQtShell_QComboBox::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23127,7 +23127,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::hideEvent(QHideEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23149,7 +23149,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::hidePopup()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::hidePopup")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hidePopup");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23171,7 +23171,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23193,7 +23193,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23215,7 +23215,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QComboBox::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23248,7 +23248,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::keyPressEvent(QKeyEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23270,7 +23270,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::keyReleaseEvent(QKeyEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23292,7 +23292,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23314,7 +23314,7 @@ if (_wrapper) {
 int  PythonQtShell_QComboBox::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23347,7 +23347,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QComboBox::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23380,7 +23380,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23402,7 +23402,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mouseMoveEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23424,7 +23424,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mousePressEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23446,7 +23446,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::mouseReleaseEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23468,7 +23468,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23490,7 +23490,7 @@ if (_wrapper) {
 bool  PythonQtShell_QComboBox::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23523,7 +23523,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QComboBox::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23556,7 +23556,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::paintEvent(QPaintEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23578,7 +23578,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QComboBox::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23611,7 +23611,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::resizeEvent(QResizeEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23633,7 +23633,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23655,7 +23655,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QComboBox::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23688,7 +23688,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::showEvent(QShowEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23710,7 +23710,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::showPopup()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::showPopup")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showPopup");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23732,7 +23732,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QComboBox::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23765,7 +23765,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23787,7 +23787,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -23809,7 +23809,7 @@ if (_wrapper) {
 void PythonQtShell_QComboBox::wheelEvent(QWheelEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QComboBox::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24154,7 +24154,7 @@ PythonQtShell_QCommandLinkButton::~PythonQtShell_QCommandLinkButton() {
 void PythonQtShell_QCommandLinkButton::actionEvent(QActionEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::actionEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("actionEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24176,7 +24176,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::changeEvent(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::changeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("changeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24198,7 +24198,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::checkStateSet()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::checkStateSet")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("checkStateSet");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24220,7 +24220,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24242,7 +24242,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::closeEvent(QCloseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::closeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("closeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24264,7 +24264,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::contextMenuEvent(QContextMenuEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::contextMenuEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("contextMenuEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24286,7 +24286,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24308,7 +24308,7 @@ if (_wrapper) {
 int  PythonQtShell_QCommandLinkButton::devType() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::devType")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("devType");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24341,7 +24341,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dragEnterEvent(QDragEnterEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::dragEnterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragEnterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24363,7 +24363,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dragLeaveEvent(QDragLeaveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::dragLeaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragLeaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24385,7 +24385,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dragMoveEvent(QDragMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::dragMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dragMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24407,7 +24407,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::dropEvent(QDropEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::dropEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("dropEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24429,7 +24429,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::enterEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::enterEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("enterEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24451,7 +24451,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::event(QEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24484,7 +24484,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24517,7 +24517,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::focusInEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::focusInEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusInEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24539,7 +24539,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::focusNextPrevChild(bool  next0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::focusNextPrevChild")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusNextPrevChild");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24572,7 +24572,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::focusOutEvent(QFocusEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::focusOutEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("focusOutEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24594,7 +24594,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::hasHeightForWidth() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::hasHeightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hasHeightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24627,7 +24627,7 @@ if (_wrapper) {
 int  PythonQtShell_QCommandLinkButton::heightForWidth(int  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::heightForWidth")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("heightForWidth");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24660,7 +24660,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::hideEvent(QHideEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::hideEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hideEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24682,7 +24682,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::hitButton(const QPoint&  pos0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::hitButton")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hitButton");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24715,7 +24715,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::initPainter(QPainter*  painter0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::initPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("initPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24737,7 +24737,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::inputMethodEvent(QInputMethodEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::inputMethodEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24759,7 +24759,7 @@ if (_wrapper) {
 QVariant  PythonQtShell_QCommandLinkButton::inputMethodQuery(Qt::InputMethodQuery  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::inputMethodQuery")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("inputMethodQuery");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24792,7 +24792,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::keyPressEvent(QKeyEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::keyPressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyPressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24814,7 +24814,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::keyReleaseEvent(QKeyEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::keyReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("keyReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24836,7 +24836,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::leaveEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::leaveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("leaveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24858,7 +24858,7 @@ if (_wrapper) {
 int  PythonQtShell_QCommandLinkButton::metric(QPaintDevice::PaintDeviceMetric  arg__1) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::metric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("metric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24891,7 +24891,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QCommandLinkButton::minimumSizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::minimumSizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("minimumSizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24924,7 +24924,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mouseDoubleClickEvent(QMouseEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::mouseDoubleClickEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseDoubleClickEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24946,7 +24946,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mouseMoveEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::mouseMoveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseMoveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24968,7 +24968,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mousePressEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::mousePressEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mousePressEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -24990,7 +24990,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::mouseReleaseEvent(QMouseEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::mouseReleaseEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("mouseReleaseEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25012,7 +25012,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::moveEvent(QMoveEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::moveEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("moveEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25034,7 +25034,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommandLinkButton::nativeEvent(const QByteArray&  eventType0, void*  message1, long*  result2)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::nativeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nativeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25067,7 +25067,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::nextCheckState()
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::nextCheckState")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("nextCheckState");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25089,7 +25089,7 @@ if (_wrapper) {
 QPaintEngine*  PythonQtShell_QCommandLinkButton::paintEngine() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::paintEngine")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEngine");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25122,7 +25122,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::paintEvent(QPaintEvent*  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::paintEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("paintEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25144,7 +25144,7 @@ if (_wrapper) {
 QPaintDevice*  PythonQtShell_QCommandLinkButton::redirected(QPoint*  offset0) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::redirected")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("redirected");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25177,7 +25177,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::resizeEvent(QResizeEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::resizeEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("resizeEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25199,7 +25199,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::setVisible(bool  visible0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::setVisible")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("setVisible");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25221,7 +25221,7 @@ if (_wrapper) {
 QPainter*  PythonQtShell_QCommandLinkButton::sharedPainter() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::sharedPainter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sharedPainter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25254,7 +25254,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::showEvent(QShowEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::showEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("showEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25276,7 +25276,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QCommandLinkButton::sizeHint() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::sizeHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25309,7 +25309,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::tabletEvent(QTabletEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::tabletEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("tabletEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25331,7 +25331,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::timerEvent(QTimerEvent*  e0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25353,7 +25353,7 @@ if (_wrapper) {
 void PythonQtShell_QCommandLinkButton::wheelEvent(QWheelEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommandLinkButton::wheelEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("wheelEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25416,7 +25416,7 @@ PythonQtShell_QCommonStyle::~PythonQtShell_QCommonStyle() {
 void PythonQtShell_QCommonStyle::childEvent(QChildEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::childEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("childEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25438,7 +25438,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::customEvent(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::customEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("customEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25460,7 +25460,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawComplexControl(QStyle::ComplexControl  cc0, const QStyleOptionComplex*  opt1, QPainter*  p2, const QWidget*  w3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::drawComplexControl")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("drawComplexControl");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25482,7 +25482,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawControl(QStyle::ControlElement  element0, const QStyleOption*  opt1, QPainter*  p2, const QWidget*  w3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::drawControl")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("drawControl");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25504,7 +25504,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawItemPixmap(QPainter*  painter0, const QRect&  rect1, int  alignment2, const QPixmap&  pixmap3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::drawItemPixmap")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("drawItemPixmap");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25526,7 +25526,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawItemText(QPainter*  painter0, const QRect&  rect1, int  flags2, const QPalette&  pal3, bool  enabled4, const QString&  text5, QPalette::ColorRole  textRole6) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::drawItemText")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("drawItemText");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25548,7 +25548,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::drawPrimitive(QStyle::PrimitiveElement  pe0, const QStyleOption*  opt1, QPainter*  p2, const QWidget*  w3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::drawPrimitive")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("drawPrimitive");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25570,7 +25570,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommonStyle::event(QEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::event")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("event");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25603,7 +25603,7 @@ if (_wrapper) {
 bool  PythonQtShell_QCommonStyle::eventFilter(QObject*  watched0, QEvent*  event1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::eventFilter")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("eventFilter");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25636,7 +25636,7 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCommonStyle::generatedIconPixmap(QIcon::Mode  iconMode0, const QPixmap&  pixmap1, const QStyleOption*  opt2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::generatedIconPixmap")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("generatedIconPixmap");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25669,7 +25669,7 @@ if (_wrapper) {
 QStyle::SubControl  PythonQtShell_QCommonStyle::hitTestComplexControl(QStyle::ComplexControl  cc0, const QStyleOptionComplex*  opt1, const QPoint&  pt2, const QWidget*  w3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::hitTestComplexControl")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("hitTestComplexControl");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25702,7 +25702,7 @@ if (_wrapper) {
 QRect  PythonQtShell_QCommonStyle::itemPixmapRect(const QRect&  r0, int  flags1, const QPixmap&  pixmap2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::itemPixmapRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("itemPixmapRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25735,7 +25735,7 @@ if (_wrapper) {
 int  PythonQtShell_QCommonStyle::layoutSpacing(QSizePolicy::ControlType  control10, QSizePolicy::ControlType  control21, Qt::Orientation  orientation2, const QStyleOption*  option3, const QWidget*  widget4) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::layoutSpacing")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("layoutSpacing");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25768,7 +25768,7 @@ if (_wrapper) {
 int  PythonQtShell_QCommonStyle::pixelMetric(QStyle::PixelMetric  m0, const QStyleOption*  opt1, const QWidget*  widget2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::pixelMetric")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("pixelMetric");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25801,7 +25801,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::polish(QApplication*  app0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::polish")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("polish");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25823,7 +25823,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::polish(QPalette&  arg__1)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::polish")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("polish");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25845,7 +25845,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::polish(QWidget*  widget0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::polish")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("polish");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25867,7 +25867,7 @@ if (_wrapper) {
 QSize  PythonQtShell_QCommonStyle::sizeFromContents(QStyle::ContentsType  ct0, const QStyleOption*  opt1, const QSize&  contentsSize2, const QWidget*  widget3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::sizeFromContents")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("sizeFromContents");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25900,7 +25900,7 @@ if (_wrapper) {
 QIcon  PythonQtShell_QCommonStyle::standardIcon(QStyle::StandardPixmap  standardIcon0, const QStyleOption*  opt1, const QWidget*  widget2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::standardIcon")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("standardIcon");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25933,7 +25933,7 @@ if (_wrapper) {
 QPalette  PythonQtShell_QCommonStyle::standardPalette() const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::standardPalette")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("standardPalette");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25966,7 +25966,7 @@ if (_wrapper) {
 QPixmap  PythonQtShell_QCommonStyle::standardPixmap(QStyle::StandardPixmap  sp0, const QStyleOption*  opt1, const QWidget*  widget2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::standardPixmap")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("standardPixmap");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -25999,7 +25999,7 @@ if (_wrapper) {
 int  PythonQtShell_QCommonStyle::styleHint(QStyle::StyleHint  sh0, const QStyleOption*  opt1, const QWidget*  w2, QStyleHintReturn*  shret3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::styleHint")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("styleHint");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -26032,7 +26032,7 @@ if (_wrapper) {
 QRect  PythonQtShell_QCommonStyle::subControlRect(QStyle::ComplexControl  cc0, const QStyleOptionComplex*  opt1, QStyle::SubControl  sc2, const QWidget*  w3) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::subControlRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("subControlRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -26065,7 +26065,7 @@ if (_wrapper) {
 QRect  PythonQtShell_QCommonStyle::subElementRect(QStyle::SubElement  r0, const QStyleOption*  opt1, const QWidget*  widget2) const
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::subElementRect")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("subElementRect");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -26098,7 +26098,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::timerEvent(QTimerEvent*  event0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::timerEvent")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("timerEvent");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -26120,7 +26120,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::unpolish(QApplication*  application0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::unpolish")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("unpolish");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
@@ -26142,7 +26142,7 @@ if (_wrapper) {
 void PythonQtShell_QCommonStyle::unpolish(QWidget*  widget0)
 {
 if (_wrapper) {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("QCommonStyle::unpolish")
   if (Py_REFCNT((PyObject*)_wrapper) > 0) {
     static PyObject* name = PyString_FromString("unpolish");
     PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);
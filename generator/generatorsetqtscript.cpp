@@ -55,7 +55,8 @@ QString GeneratorSetQtScript::usage() {
     QString usage =
         "QtScript:\n" 
         "  --nothing-to-report-yet                   \n"
-        "  --max-classes-per-file=<n>                \n";
+        "  --max-classes-per-file=<n>                \n"
+        "  --slot-thunks                             \n";
 
     return usage;
 }
@@ -71,6 +72,9 @@ bool GeneratorSetQtScript::readParameters(const QMap<QString, QString> args) {
           printf("Invalid value for option --max-classes-per-file (must be number > 0)\n");
         }
     }
+    // direct call thunks for the wrapper slots, they are registered by the generated init code
+    // and called by PythonQt instead of qt_metacall
+    generateSlotThunks = args.contains("slot-thunks");
     return GeneratorSet::readParameters(args);
 }
 
@@ -96,16 +100,19 @@ QString GeneratorSetQtScript::generate() {
     setupGenerator.setOutputDirectory(outDir);
     setupGenerator.setQtMetaTypeDeclaredTypeNames(declaredTypeNames);
     setupGenerator.setClasses(classes);
+    setupGenerator.setGenerateSlotThunks(generateSlotThunks);
 
     ShellImplGenerator shellImplGenerator(&priGenerator);
     shellImplGenerator.setOutputDirectory(outDir);
     shellImplGenerator.setClasses(classes);
     shellImplGenerator.setQtMetaTypeDeclaredTypeNames(declaredTypeNames);
+    shellImplGenerator.setGenerateSlotThunks(generateSlotThunks);
     shellImplGenerator.generate();
 
     ShellHeaderGenerator shellHeaderGenerator(&priGenerator, &setupGenerator);
     shellHeaderGenerator.setOutputDirectory(outDir);
     shellHeaderGenerator.setClasses(classes);
+    shellHeaderGenerator.setGenerateSlotThunks(generateSlotThunks);
     shellHeaderGenerator.generate();
 
     priGenerator.generate();
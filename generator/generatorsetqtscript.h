@@ -63,6 +63,7 @@ public:
 private:
     MetaQtScriptBuilder builder;
     int maxClassesPerFile{30};
+    bool generateSlotThunks{};
   
 };
 
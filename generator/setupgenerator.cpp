@@ -343,6 +343,9 @@ void SetupGenerator::generate()
           QString baseName = cls->baseClass()?cls->baseClass()->qualifiedCppName():"";
           s << "PythonQt::priv()->registerCPPClass(\""<< cls->qualifiedCppName() << "\", \"" << baseName << "\", \"" << qtPackageName <<"\", PythonQtCreateObject<PythonQtWrapper_" << cls->name() << ">" << shellCreator << ", module, " << operatorCodes <<");" << endl;
         }
+        if (generateSlotThunks) {
+          s << "PythonQt::priv()->registerSlotThunks(&PythonQtWrapper_" << cls->name() << "::staticMetaObject, PythonQtWrapper_" << cls->name() << "::pythonQtSlotThunks());" << endl;
+        }
         for (AbstractMetaClass* interface :  cls->interfaces()) {
           // the interface might be our own class... (e.g. QPaintDevice)
           if (interface->qualifiedCppName() != cls->qualifiedCppName()) {
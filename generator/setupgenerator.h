@@ -59,6 +59,9 @@ class SetupGenerator : public Generator
    static void writeInclude(QTextStream &stream, const Include &inc);
   
    static bool isSpecialStreamingOperator(const AbstractMetaFunction *fun);
+
+   // register the direct call thunks of the wrappers (see --slot-thunks)
+   void setGenerateSlotThunks(bool flag) { generateSlotThunks = flag; }
   
  private:
    QStringList writePolymorphicHandler(QTextStream &s, const QString &package,
@@ -67,6 +70,7 @@ class SetupGenerator : public Generator
    QHash<QString, QList<const AbstractMetaClass*> > packHash;
 
    int maxClassesPerFile;
+   bool generateSlotThunks{};
 };
 #endif // SETUPGENERATOR_H
 
@@ -104,11 +104,17 @@ public:
     const AbstractMetaClass* setCurrentScope(const AbstractMetaClass* scope);
     const AbstractMetaClass* currentScope() const { return _currentScope; }
 
+    // generate direct call thunks for the wrapper slots (see --slot-thunks)
+    void setGenerateSlotThunks(bool flag) { _generateSlotThunks = flag; }
+    bool generateSlotThunks() const { return _generateSlotThunks; }
+
  protected:
     PriGenerator* priGenerator{};
 
     const AbstractMetaClass* _currentScope{};
 
+    bool _generateSlotThunks{};
+
 };
 
 
@@ -270,6 +270,9 @@ void ShellHeaderGenerator::write(QTextStream& s, const AbstractMetaClass* meta_c
     << "{ Q_OBJECT" << endl;
 
   s << "public:" << endl;
+  if (_generateSlotThunks) {
+    s << "static const PythonQtSlotThunkEntry* pythonQtSlotThunks();" << endl;
+  }
 
   AbstractMetaEnumList enums1 = meta_class->enums();
   std::sort(enums1.begin(), enums1.end(), enum_lessThan);
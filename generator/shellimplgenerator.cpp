@@ -136,7 +136,7 @@ void ShellImplGenerator::write(QTextStream &s, const AbstractMetaClass *meta_cla
       if (!hasReturnValue || !fun->type()->isReference()) {
 
         s << "if (_wrapper) {" << endl;
-        s << "  PYTHONQT_GIL_SCOPE" << endl;
+        s << "  PYTHONQT_GIL_SITE_SCOPE(\"" << meta_class->name() << "::" << fun->name() << "\")" << endl;
         s << "  if (Py_REFCNT((PyObject*)_wrapper) > 0) {" << endl;
         s << "    static PyObject* name = PyString_FromString(\"" << fun->name() << "\");" << endl;
         s << "    PyObject* obj = PyBaseObject_Type.tp_getattro((PyObject*)_wrapper, name);" << endl;
@@ -271,6 +271,14 @@ void ShellImplGenerator::write(QTextStream &s, const AbstractMetaClass *meta_cla
 
   }
 
+  QStringList thunkEntries;
+  if (_generateSlotThunks && (meta_class->generateShellClass() || !meta_class->isAbstract())) {
+    foreach (const AbstractMetaFunction *ctor, ctors) {
+      if (ctor->isAbstract() || (!meta_class->generateShellClass() && !ctor->isPublic())) { continue; }
+      writeSlotThunks(s, meta_class, ctor, "new_", Option(AddOwnershipTemplates | ShowStatic), thunkEntries);
+    }
+  }
+
   QString wrappedObject = " (*theWrappedObject)";
 
   // write member functions
@@ -356,6 +364,36 @@ void ShellImplGenerator::write(QTextStream &s, const AbstractMetaClass *meta_cla
     s << "}" << endl << endl;
   }
 
+  // write the direct call thunks of the wrapper slots
+  if (_generateSlotThunks) {
+    Option wrapperSlotOption = Option(AddOwnershipTemplates | ConvertReferenceToPtr | FirstArgIsWrappedObject | ShowStatic | UnderscoreSpaces | ProtectedEnumAsInts);
+    foreach (const AbstractMetaFunction *fun, functions) {
+      if (functionNeedsNormalWrapperSlot(fun, meta_class)) {
+        writeSlotThunks(s, meta_class, fun, QString(), wrapperSlotOption, thunkEntries);
+      }
+      if (fun->isVirtual() && meta_class->typeEntry()->shouldCreatePromoter()) {
+        writeSlotThunks(s, meta_class, fun, "py_q_", wrapperSlotOption, thunkEntries);
+      }
+    }
+    if (meta_class->hasPublicDestructor() && !meta_class->isNamespace()) {
+      QString thunkName = "PythonQtSlotThunk_" + meta_class->name() + "_delete";
+      s << "static void " << thunkName << "(QObject* o, void** a) { static_cast<" << wrapperClassName(meta_class) << "*>(o)->delete_"
+        << meta_class->name() << "(*reinterpret_cast<" << meta_class->qualifiedCppName() << "**>(a[1])); }" << endl << endl;
+      thunkEntries << "  { \"delete_" + meta_class->name() + "(" + meta_class->qualifiedCppName() + "*)\", " + thunkName + " },";
+    }
+
+    s << "const PythonQtSlotThunkEntry* " << wrapperClassName(meta_class) << "::pythonQtSlotThunks()" << endl;
+    s << "{" << endl;
+    s << "  static const PythonQtSlotThunkEntry thunks[] = {" << endl;
+    foreach (const QString &entry, thunkEntries) {
+      s << "  " << entry << endl;
+    }
+    s << "    { nullptr, nullptr }" << endl;
+    s << "  };" << endl;
+    s << "  return thunks;" << endl;
+    s << "}" << endl << endl;
+  }
+
   if (meta_class->hasDefaultToStringFunction()) {
     s << "QString PythonQtWrapper_" << meta_class->name() << "::py_toString(" << meta_class->qualifiedCppName() << "* obj) { return obj->toString(); }" << endl; 
   } else if (meta_class->hasToStringCapability()) {
@@ -388,3 +426,95 @@ void ShellImplGenerator::writeInjectedCode(QTextStream &s, const AbstractMetaCla
     }
   }
 }
+
+void ShellImplGenerator::writeSlotThunks(QTextStream &s, const AbstractMetaClass *meta_class, const AbstractMetaFunction *fun,
+                                         const QString &name_prefix, Option option, QStringList &thunkEntries)
+{
+  // moc creates an additional method index for each default argument, so we need a thunk for each of them
+  AbstractMetaArgumentList args = fun->arguments();
+  for (int numArguments = args.size(); numArguments >= 0; numArguments--) {
+    writeSlotThunk(s, meta_class, fun, name_prefix, option, numArguments, thunkEntries);
+    if (numArguments == 0 || args.at(numArguments - 1)->defaultValueExpression().isEmpty()) {
+      break;
+    }
+  }
+}
+
+void ShellImplGenerator::writeSlotThunk(QTextStream &s, const AbstractMetaClass *meta_class, const AbstractMetaFunction *fun,
+                                        const QString &name_prefix, Option option, int numArguments, QStringList &thunkEntries)
+{
+  AbstractMetaArgumentList args = fun->arguments();
+  for (int i = 0; i < numArguments; ++i) {
+    if (args.at(i)->type()->isArray()) {
+      // no thunk, the slot is called via qt_metacall
+      return;
+    }
+  }
+
+  // the signature is normalized and looked up in the meta object of the wrapper at runtime
+  QString signature;
+  {
+    QTextStream sig(&signature);
+    writeFunctionSignature(sig, fun, 0, name_prefix, Option(option | SkipReturnType | SkipName), QString(), QStringList(), numArguments);
+  }
+  if (!fun->exception().isEmpty()) {
+    signature.chop(fun->exception().length() + 1);
+  }
+  if (fun->isConstant()) {
+    signature.chop(QString(" const").length());
+  }
+  signature.replace(" theWrappedObject", "");
+  QString slotName = signature.left(signature.indexOf('('));
+
+  QString thunkName = "PythonQtSlotThunk_" + meta_class->name() + "_" + QString::number(thunkEntries.size());
+  bool hasReturnValue = fun->isConstructor() || fun->type();
+  s << "static void " << thunkName << "(QObject* o, void** a)" << endl;
+  s << "{" << endl;
+  s << "  ";
+  if (hasReturnValue) {
+    s << "auto _r = ";
+  }
+  s << "static_cast<" << wrapperClassName(meta_class) << "*>(o)->" << slotName << "(";
+  int argIndex = 1;
+  if ((option & FirstArgIsWrappedObject) && fun->ownerClass() && !fun->isConstructor() && !fun->isStatic()) {
+    s << "*reinterpret_cast<" << fun->ownerClass()->qualifiedCppName() << "**>(a[" << argIndex++ << "])";
+    if (numArguments > 0) {
+      s << ", ";
+    }
+  }
+  for (int i = 0; i < numArguments; ++i) {
+    if (i > 0) {
+      s << ", ";
+    }
+    s << "*reinterpret_cast<" << thunkArgumentType(fun, i, option) << "*>(a[" << argIndex++ << "])";
+  }
+  s << ");" << endl;
+  if (hasReturnValue) {
+    s << "  if (a[0]) { *reinterpret_cast<decltype(_r)*>(a[0]) = std::move(_r); }" << endl;
+  }
+  s << "}" << endl << endl;
+
+  thunkEntries << "  { \"" + signature + "\", " + thunkName + " },";
+}
+
+QString ShellImplGenerator::thunkArgumentType(const AbstractMetaFunction *fun, int argumentIndex, Option option)
+{
+  // the type that moc uses to store the argument, i.e. the declared type without top-level const and reference
+  QString result;
+  QTextStream t(&result);
+  TypeSystem::Ownership ownership = TypeSystem::InvalidOwnership;
+  if (option & AddOwnershipTemplates) {
+    ownership = writeOwnershipTemplate(t, fun, argumentIndex + 1);
+  }
+  AbstractMetaType::const_shared_pointer type = fun->arguments().at(argumentIndex)->type();
+  Option typeOption = Option((option & ~ConvertReferenceToPtr) | ExcludeReference | SkipName);
+  if (ownership == TypeSystem::InvalidOwnership && type->indirections() == 0) {
+    typeOption = Option(typeOption | ExcludeConst);
+  }
+  writeTypeInfo(t, type, typeOption, ownership);
+  if (ownership != TypeSystem::InvalidOwnership) {
+    t << "> ";
+  }
+  t.flush();
+  return result.trimmed();
+}
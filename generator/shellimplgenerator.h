@@ -60,6 +60,17 @@ public:
     void write(QTextStream &s, const AbstractMetaClass *meta_class);
     void writeInjectedCode(QTextStream &s, const AbstractMetaClass *meta_class);
 
+    // writes the direct call thunks for the given wrapper slot (and its default argument clones)
+    // and adds the table entries to thunkEntries
+    void writeSlotThunks(QTextStream &s, const AbstractMetaClass *meta_class, const AbstractMetaFunction *fun,
+                         const QString &name_prefix, Option option, QStringList &thunkEntries);
+
+private:
+    void writeSlotThunk(QTextStream &s, const AbstractMetaClass *meta_class, const AbstractMetaFunction *fun,
+                        const QString &name_prefix, Option option, int numArguments, QStringList &thunkEntries);
+
+    QString thunkArgumentType(const AbstractMetaFunction *fun, int argumentIndex, Option option);
+
 };
 
 #endif // SHELLIMPLGENERATOR_H
@@ -42,6 +42,7 @@
 #include "PythonQt.h"
 #include "PythonQtImporter.h"
 #include "PythonQtClassInfo.h"
+#include "PythonQtAsyncio.h"
 #include "PythonQtMethodInfo.h"
 #include "PythonQtSignal.h"
 #include "PythonQtSignalReceiver.h"
@@ -54,15 +55,24 @@
 #include "PythonQtStdDecorators.h"
 #include "PythonQtQFileImporter.h"
 #include "PythonQtBoolResult.h"
+#include "PythonQtContainerView.h"
+#include "PythonQtErrorMessage.h"
 #include "PythonQtSlotDecorator.h"
+#include "PythonQtTrace.h"
+#include "PythonQtStartupProfile.h"
 
 #include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QTimer>
+#include <QThread>
 
 #if PY_VERSION_HEX >= 0x030A0000
 #include <cpython/pydebug.h>
 #else
 #include <pydebug.h>
 #endif
+#include <frameobject.h>
 
 // .co_varnames was removed in 3.11, but the helper function was added
 #if PY_VERSION_HEX < 0x030B0000
@@ -73,6 +83,7 @@ static inline PyObject *PyCode_GetVarnames(PyCodeObject *o) {
 #endif
 
 #include <vector>
+#include <algorithm>
 
 PythonQt* PythonQt::_self = nullptr;
 int       PythonQt::_uniqueModuleCount = 0;
@@ -84,8 +95,10 @@ void PythonQt_init_QtCoreBuiltin(PyObject*);
 void PythonQt::init(int flags, const QByteArray& pythonQtModuleName)
 {
   if (!_self) {
+    PythonQtStartupPhaseScope initPhase("PythonQt::init");
     _self = new PythonQt(flags, pythonQtModuleName);
 
+    PythonQtStartupProfile::begin("converters");
     _self->_p->_PythonQtObjectPtr_metaId = qRegisterMetaType<PythonQtObjectPtr>("PythonQtObjectPtr");
     PythonQtConv::registerMetaTypeToPythonConverter(_self->_p->_PythonQtObjectPtr_metaId, PythonQtConv::convertFromPythonQtObjectPtr);
     PythonQtConv::registerPythonToMetaTypeConverter(_self->_p->_PythonQtObjectPtr_metaId, PythonQtConv::convertToPythonQtObjectPtr);
@@ -93,6 +106,9 @@ void PythonQt::init(int flags, const QByteArray& pythonQtModuleName)
     PythonQtConv::registerMetaTypeToPythonConverter(_self->_p->_PythonQtSafeObjectPtr_metaId, PythonQtConv::convertFromPythonQtSafeObjectPtr);
     PythonQtConv::registerPythonToMetaTypeConverter(_self->_p->_PythonQtSafeObjectPtr_metaId, PythonQtConv::convertToPythonQtSafeObjectPtr);
 
+    PythonQtStartupProfile::end();
+
+    PythonQtStartupProfile::begin("import importlib and asyncio");
     PythonQtObjectPtr importlib;
     importlib.setNewRef(PyImport_ImportModule("importlib.machinery"));
 
@@ -112,7 +128,9 @@ void PythonQt::init(int flags, const QByteArray& pythonQtModuleName)
 #endif
 
     PythonQt::priv()->setupSharedLibrarySuffixes();
+    PythonQtStartupProfile::end();
 
+    PythonQtStartupProfile::begin("template converters");
     PythonQtMethodInfo::addParameterTypeAlias("QObjectList", "QList<QObject*>");
     qRegisterMetaType<QList<QObject*> >("QList<void*>");
     qRegisterMetaType<QObjectList>("QObjectList");
@@ -218,10 +236,18 @@ void PythonQt::init(int flags, const QByteArray& pythonQtModuleName)
     PythonQtRegisterIntegerMapConverter(QHash, QVariant);
     PythonQtRegisterIntegerMapConverter(QHash, QString);
     PythonQtMethodInfo::addParameterTypeAlias("QHash<QNetworkRequest::Attribute,QVariant>", "QHash<int,QVariant>");
+    PythonQtStartupProfile::end();
 
-    PythonQt_init_QtCoreBuiltin(nullptr);
-    PythonQt_init_QtGuiBuiltin(nullptr);
+    {
+      PythonQtStartupPhaseScope phase("PythonQt_init_QtCoreBuiltin");
+      PythonQt_init_QtCoreBuiltin(nullptr);
+    }
+    {
+      PythonQtStartupPhaseScope phase("PythonQt_init_QtGuiBuiltin");
+      PythonQt_init_QtGuiBuiltin(nullptr);
+    }
 
+    PythonQtStartupProfile::begin("std decorators and known class converters");
     PythonQt::self()->addDecorators(new PythonQtStdDecorators());
     PythonQt::self()->registerCPPClass("QMetaObject",nullptr, "QtCore", PythonQtCreateObject<PythonQtWrapper_QMetaObject>);
 
@@ -260,7 +286,9 @@ void PythonQt::init(int flags, const QByteArray& pythonQtModuleName)
     PythonQtRegisterToolClassesTemplateConverterForKnownClass(QPen);
     PythonQtRegisterToolClassesTemplateConverterForKnownClass(QTextLength);
     PythonQtRegisterToolClassesTemplateConverterForKnownClass(QTextFormat);
+    PythonQtStartupProfile::end();
 
+    PythonQtStartupPhaseScope namespacePhase("Qt namespace and PythonQt objects");
     PyObject* pack = PythonQt::priv()->packageByName("QtCore");
     PyObject* pack2 = PythonQt::priv()->packageByName("Qt");
     PyObject* qtNamespace = PythonQt::priv()->getClassInfo("Qt")->pythonQtClassWrapper();
@@ -309,6 +337,7 @@ void PythonQt::init(int flags, const QByteArray& pythonQtModuleName)
 
     _self->priv()->pythonQtModule().addObject("Debug", _self->priv()->_debugAPI);
     _self->priv()->pythonQtModule().addObject("Config", _self->priv()->_configAPI);
+    _self->priv()->pythonQtModule().addObject("ThreadPool", _self->priv()->_threadPoolAPI);
 
     Py_INCREF((PyObject*)&PythonQtSlotDecorator_Type);
     Py_INCREF((PyObject*)&PythonQtSignalFunction_Type);
@@ -325,6 +354,13 @@ void PythonQt::cleanup()
   if (_self) {
     delete _self;
     _self = nullptr;
+#ifdef PYTHONQT_GIL_SUPPORT
+    if (Py_IsInitialized()) {
+      // do the decrefs that other threads deferred, including those of the objects released above
+      PYTHONQT_GIL_SCOPE
+      PythonQtDeferredDecref::drain();
+    }
+#endif
   }
 }
 
@@ -336,6 +372,7 @@ PythonQt::PythonQt(int flags, const QByteArray& pythonQtModuleName)
   _p->_initFlags = flags;
 
   if ((flags & PythonAlreadyInitialized) == 0) {
+    PythonQtStartupPhaseScope phase("Py_Initialize");
 #ifdef PY3K
     Py_SetProgramName(const_cast<wchar_t*>(L"PythonQt"));
 #else
@@ -348,6 +385,7 @@ PythonQt::PythonQt(int flags, const QByteArray& pythonQtModuleName)
     Py_Initialize();
   }
 
+  PythonQtStartupProfile::begin("PythonQt types");
   // add our own python object types for qt object slots
   if (PyType_Ready(&PythonQtSlotFunction_Type) < 0) {
     std::cerr << "could not initialize PythonQtSlotFunction_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
@@ -375,6 +413,21 @@ PythonQt::PythonQt(int flags, const QByteArray& pythonQtModuleName)
   }
   Py_INCREF(&PythonQtBoolResult_Type);
 
+  if (PyType_Ready(&PythonQtSequenceView_Type) < 0) {
+    std::cerr << "could not initialize PythonQtSequenceView_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
+  }
+  Py_INCREF(&PythonQtSequenceView_Type);
+
+  if (PyType_Ready(&PythonQtMappingView_Type) < 0) {
+    std::cerr << "could not initialize PythonQtMappingView_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
+  }
+  Py_INCREF(&PythonQtMappingView_Type);
+
+  if (PyType_Ready(&PythonQtErrorMessage_Type) < 0) {
+    std::cerr << "could not initialize PythonQtErrorMessage_Type" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
+  }
+  Py_INCREF(&PythonQtErrorMessage_Type);
+
   // according to Python docs, set the type late here, since it can not safely be stored in the struct when declaring it
   PythonQtClassWrapper_Type.tp_base = &PyType_Type;
   // add our own python object types for classes
@@ -401,11 +454,17 @@ PythonQt::PythonQt(int flags, const QByteArray& pythonQtModuleName)
     std::cerr << "could not initialize PythonQtStdInRedirectType" << ", in " << __FILE__ << ":" << __LINE__ << std::endl;
   }
   Py_INCREF(&PythonQtStdInRedirectType);
+  PythonQtStartupProfile::end();
 
+  PythonQtStartupPhaseScope phase("PythonQt module and redirects");
   initPythonQtModule(flags & RedirectStdOut, pythonQtModuleName);
 }
 
 PythonQt::~PythonQt() {
+  if (Py_IsInitialized()) {
+    // don't lose buffered output
+    flushRedirectedOutput();
+  }
   delete _p;
   _p = nullptr;
 }
@@ -418,6 +477,11 @@ PythonQtPrivate::~PythonQtPrivate() {
     qDeleteAll(_knownClassInfos);
   }
 
+  if (!_methodInfoCacheFile.isEmpty()) {
+    if (!PythonQtMethodInfo::savePersistentCache(_methodInfoCacheFile, _methodInfoCacheBuildId)) {
+      std::cerr << "PythonQt: could not write method info cache " << _methodInfoCacheFile.toLocal8Bit().constData() << std::endl;
+    }
+  }
   PythonQtMethodInfo::cleanupCachedMethodInfos();
   PythonQtArgumentFrame::cleanupFreeList();
 }
@@ -545,6 +609,9 @@ void PythonQt::registerClass(const QMetaObject* metaobject, const char* package,
 
 void PythonQtPrivate::registerClass(const QMetaObject* metaobject, const char* package, PythonQtQObjectCreatorFunctionCB* wrapperCreator, PythonQtShellSetInstanceWrapperCB* shell, PyObject* module, int typeSlots)
 {
+  if (deferRegistration(metaobject->className(), metaobject, nullptr, package, wrapperCreator, shell, module, typeSlots)) {
+    return;
+  }
   // we register all classes in the hierarchy
   const QMetaObject* m = metaobject;
   bool first = true;
@@ -865,14 +932,46 @@ PyObject* PythonQtPrivate::createNewPythonQtEnumWrapper(const char* enumName, Py
   return result;
 }
 
-PythonQtSignalReceiver* PythonQt::getSignalReceiver(QObject* obj)
+PythonQtSignalDispatcher* PythonQt::getSignalDispatcher(QObject* obj)
 {
-  PythonQtSignalReceiver* r = _p->_signalReceivers[obj];
-  if (!r) {
-    r = new PythonQtSignalReceiver(obj);
-    _p->_signalReceivers.insert(obj, r);
+  QThread* thread = obj->thread();
+  Q_FOREACH(PythonQtSignalDispatcher* d, _p->_signalDispatchers) {
+    if (d->thread() == thread && !d->isExhausted()) {
+      return d;
+    }
+  }
+  PythonQtSignalDispatcher* d = new PythonQtSignalDispatcher();
+  if (thread != d->thread()) {
+    d->moveToThread(thread);
+  }
+  _p->_signalDispatchers.append(d);
+  QObject::connect(d, &QObject::destroyed, _p, [this, d]() {
+    _p->_signalDispatchers.removeOne(d);
+  }, Qt::DirectConnection);
+  // signals can not be delivered to a dispatcher of a deleted thread, so delete it with the thread,
+  // but keep the handlers of the QObjects that were moved to other threads
+  QObject::connect(thread, &QObject::destroyed, d, [this, d, thread]() {
+    Q_FOREACH(QObject* sender, d->senders()) {
+      if (sender->thread() != thread) {
+        moveSignalHandlersToThreadOf(sender);
+      }
+    }
+    delete d;
+  }, Qt::DirectConnection);
+  return d;
+}
+
+void PythonQt::moveSignalHandlersToThreadOf(QObject* obj)
+{
+  PYTHONQT_GIL_SCOPE;
+  // iterates over a copy, getSignalDispatcher() may add a dispatcher
+  Q_FOREACH(PythonQtSignalDispatcher* d, _p->_signalDispatchers) {
+    if (d->thread() != obj->thread() && d->hasSender(obj)) {
+      Q_FOREACH(const PythonQtSignalTarget& target, d->takeSignalHandlers(obj)) {
+        getSignalDispatcher(obj)->addSignalHandler(obj, target);
+      }
+    }
   }
-  return r;
 }
 
 bool PythonQt::addSignalHandler(QObject* obj, const char* signal, PyObject* module, const QString& objectname)
@@ -880,8 +979,7 @@ bool PythonQt::addSignalHandler(QObject* obj, const char* signal, PyObject* modu
   bool flag = false;
   PythonQtObjectPtr callable = lookupCallable(module, objectname);
   if (callable) {
-    PythonQtSignalReceiver* r = getSignalReceiver(obj);
-    flag = r->addSignalHandler(signal, callable);
+    flag = addSignalHandler(obj, signal, callable.object());
     if (!flag) {
       // signal not found
     }
@@ -893,12 +991,9 @@ bool PythonQt::addSignalHandler(QObject* obj, const char* signal, PyObject* modu
 
 bool PythonQt::addSignalHandler(QObject* obj, const char* signal, PyObject* receiver)
 {
-  bool flag = false;
-  PythonQtSignalReceiver* r = getSignalReceiver(obj);
-  if (r) {
-    flag = r->addSignalHandler(signal, receiver);
-  }
-  return flag;
+  moveSignalHandlersToThreadOf(obj);
+  PythonQtSignalDispatcher* d = getSignalDispatcher(obj);
+  return d->addSignalHandler(obj, signal, receiver);
 }
 
 bool PythonQt::removeSignalHandler(QObject* obj, const char* signal, PyObject* module, const QString& objectname)
@@ -906,10 +1001,7 @@ bool PythonQt::removeSignalHandler(QObject* obj, const char* signal, PyObject* m
   bool flag = false;
   PythonQtObjectPtr callable = lookupCallable(module, objectname);
   if (callable) {
-    PythonQtSignalReceiver* r = _p->_signalReceivers[obj];
-    if (r) {
-      flag = r->removeSignalHandler(signal, callable);
-    }
+    flag = removeSignalHandler(obj, signal, callable.object());
   } else {
     // callable not found
   }
@@ -918,10 +1010,16 @@ bool PythonQt::removeSignalHandler(QObject* obj, const char* signal, PyObject* m
 
 bool PythonQt::removeSignalHandler(QObject* obj, const char* signal, PyObject* receiver)
 {
+  PYTHONQT_GIL_SCOPE;
   bool flag = false;
-  PythonQtSignalReceiver* r = _p->_signalReceivers[obj];
-  if (r) {
-    flag = r->removeSignalHandler(signal, receiver);
+  // the handlers are searched by sender, the object may have been moved to another thread since they were added
+  Q_FOREACH(PythonQtSignalDispatcher* d, _p->_signalDispatchers) {
+    if (d->hasSender(obj) && d->removeSignalHandler(obj, signal, receiver)) {
+      flag = true;
+      if (receiver) {
+        break;
+      }
+    }
   }
   return flag;
 }
@@ -1463,6 +1561,81 @@ PyObject* PythonQt::callAndReturnPyObject(PyObject* callable, const QVariantList
   return result;
 }
 
+int PythonQt::callBatch(PyObject* callable, const QVector<QVariantList>& argsList, QVector<QVariant>& results, QStringList* errors, int yieldInterval)
+{
+  int count = argsList.size();
+  results.fill(QVariant(), count);
+  if (errors) {
+    errors->clear();
+    errors->reserve(count);
+  }
+  if (!callable) {
+    if (errors) {
+      for (int i = 0; i < count; i++) {
+        errors->append("RuntimeError: no callable");
+      }
+    }
+    return 0;
+  }
+  PYTHONQT_GIL_SCOPE
+  int succeeded = 0;
+  PythonQtObjectPtr result;
+  for (int i = 0; i < count; i++) {
+    const QVariantList& args = argsList.at(i);
+    bool ok = true;
+    PythonQtObjectPtr pargs;
+    pargs.setNewRef(PyTuple_New(args.size()));
+    for (int j = 0; j < args.size(); j++) {
+      PyObject* arg = PythonQtConv::QVariantToPyObject(args.at(j));
+      if (!arg) {
+        ok = false;
+        break;
+      }
+      PyTuple_SET_ITEM(pargs.object(), j, arg);
+    }
+    if (ok) {
+      result.setNewRef(PyObject_Call(callable, pargs, nullptr));
+      ok = !result.isNull();
+      if (ok) {
+        results[i] = PythonQtConv::PyObjToQVariant(result);
+        succeeded++;
+      }
+      result = nullptr;
+    }
+    if (errors) {
+      QString error;
+      if (!ok) {
+        PyObject* type;
+        PyObject* value;
+        PyObject* traceback;
+        PyErr_Fetch(&type, &value, &traceback);
+        if (type) {
+          error = QString(((PyTypeObject*)type)->tp_name);
+          if (value) {
+            error += ": " + PythonQtConv::PyObjGetString(value);
+          }
+        } else {
+          error = "Unknown error";
+        }
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(traceback);
+      }
+      errors->append(error);
+    }
+    PyErr_Clear();
+#ifdef PYTHONQT_GIL_SUPPORT
+    if (yieldInterval > 0 && (i + 1) % yieldInterval == 0 && i + 1 < count && PythonQtGILScope::isGILScopeEnabled()) {
+      // give other Python threads a chance to run
+      PYTHONQT_ALLOW_THREADS_SCOPE
+    }
+#else
+    Q_UNUSED(yieldInterval);
+#endif
+  }
+  return succeeded;
+}
+
 void PythonQt::addInstanceDecorators(QObject* o)
 {
   _p->addDecorators(o, PythonQtPrivate::InstanceDecorator);
@@ -1519,10 +1692,16 @@ PythonQtPrivate::PythonQtPrivate()
   _qObjectMissingAttribCB = nullptr;
   _currentClassInfoForClassWrapperCreation = nullptr;
   _profilingCB = nullptr;
+  _wrapperSamplingRate = 0;
+  _wrapperSamplingCounter = 0;
+  _deferClassRegistration = false;
+  _deferredRegistrationDepth = 0;
   _hadError = false;
   _systemExitExceptionHandlerEnabled = false;
   _debugAPI = new PythonQtDebugAPI(this);
   _configAPI = new PythonQtConfigAPI(this);
+  _threadPoolAPI = new PythonQtThreadPoolAPI(this);
+  _redirectFlushTimer = nullptr;
 }
 
 void PythonQtPrivate::setupSharedLibrarySuffixes()
@@ -1575,6 +1754,7 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
           nameOfClass.replace("__", "::");
           PythonQtClassInfo* classInfo = lookupClassInfoAndCreateIfNotPresent(nameOfClass);
           PythonQtSlotInfo* newSlot = new PythonQtSlotInfo(nullptr, m, i, o, PythonQtSlotInfo::ClassDecorator);
+          newSlot->setThunk(slotThunk(o->metaObject(), i));
           classInfo->addConstructor(newSlot);
         }
       } else if (signature.startsWith("delete_")) {
@@ -1583,6 +1763,7 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
         nameOfClass.replace("__", "::");
         PythonQtClassInfo* classInfo = lookupClassInfoAndCreateIfNotPresent(nameOfClass);
         PythonQtSlotInfo* newSlot = new PythonQtSlotInfo(nullptr, m, i, o, PythonQtSlotInfo::ClassDecorator);
+        newSlot->setThunk(slotThunk(o->metaObject(), i));
         classInfo->setDestructor(newSlot);
       } else if (signature.startsWith("static_")) {
         if ((decoTypes & StaticDecorator) == 0) continue;
@@ -1590,6 +1771,7 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
         nameOfClass = nameOfClass.mid(0, nameOfClass.indexOf('_'));
         PythonQtClassInfo* classInfo = lookupClassInfoAndCreateIfNotPresent(nameOfClass);
         PythonQtSlotInfo* newSlot = new PythonQtSlotInfo(nullptr, m, i, o, PythonQtSlotInfo::ClassDecorator);
+        newSlot->setThunk(slotThunk(o->metaObject(), i));
         classInfo->addDecoratorSlot(newSlot);
       } else {
         if ((decoTypes & InstanceDecorator) == 0) continue;
@@ -1599,6 +1781,7 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
           if (p.pointerCount==1) {
             PythonQtClassInfo* classInfo = lookupClassInfoAndCreateIfNotPresent(p.name);
             PythonQtSlotInfo* newSlot = new PythonQtSlotInfo(nullptr, m, i, o, PythonQtSlotInfo::InstanceDecorator);
+            newSlot->setThunk(slotThunk(o->metaObject(), i));
             classInfo->addDecoratorSlot(newSlot);
           }
         }
@@ -1607,28 +1790,54 @@ void PythonQtPrivate::addDecorators(QObject* o, int decoTypes)
   }
 }
 
-void PythonQtPrivate::registerQObjectClassNames(const QStringList& names)
+void PythonQtPrivate::registerSlotThunks(const QMetaObject* wrapperMetaObject, const PythonQtSlotThunkEntry* thunks)
 {
-  Q_FOREACH(QString name, names) {
-    _knownQObjectClassNames.insert(name.toUtf8(), true);
+  _slotThunkTables.insert(wrapperMetaObject, thunks);
+  _resolvedSlotThunks.remove(wrapperMetaObject);
+}
+
+PythonQtSlotThunkCB* PythonQtPrivate::slotThunk(const QMetaObject* wrapperMetaObject, int methodIndex)
+{
+  QHash<const QMetaObject*, QVector<PythonQtSlotThunkCB*> >::const_iterator it = _resolvedSlotThunks.constFind(wrapperMetaObject);
+  if (it == _resolvedSlotThunks.constEnd()) {
+    const PythonQtSlotThunkEntry* entry = _slotThunkTables.take(wrapperMetaObject);
+    if (!entry) {
+      return nullptr;
+    }
+    // map the signatures to the method indices of the moc generated meta object,
+    // entries that can't be found (e.g. because of #ifdefs) are ignored
+    QVector<PythonQtSlotThunkCB*> thunks(wrapperMetaObject->methodCount() - wrapperMetaObject->methodOffset(), nullptr);
+    for (; entry->signature; entry++) {
+      int idx = wrapperMetaObject->indexOfMethod(QMetaObject::normalizedSignature(entry->signature).constData());
+      if (idx >= wrapperMetaObject->methodOffset()) {
+        thunks[idx - wrapperMetaObject->methodOffset()] = entry->thunk;
+      }
+    }
+    it = _resolvedSlotThunks.insert(wrapperMetaObject, thunks);
+  }
+  int idx = methodIndex - wrapperMetaObject->methodOffset();
+  if (idx >= 0 && idx < it->size()) {
+    return it->at(idx);
   }
+  return nullptr;
 }
 
-void PythonQtPrivate::removeSignalEmitter(QObject* obj)
+void PythonQtPrivate::registerQObjectClassNames(const QStringList& names)
 {
-  _signalReceivers.remove(obj);
+  Q_FOREACH(QString name, names) {
+    _knownQObjectClassNames.insert(name.toUtf8(), true);
+  }
 }
 
 void PythonQt::removeSignalHandlers()
 {
-  QList<PythonQtSignalReceiver*> signalReceivers = _p->_signalReceivers.values();
+  QList<PythonQtSignalDispatcher*> signalDispatchers = _p->_signalDispatchers;
+  _p->_signalDispatchers.clear();
 
-  // just delete all signal receivers, they will remove themselves via removeSignalEmitter()
-  foreach(PythonQtSignalReceiver* receiver, signalReceivers) {
-    delete receiver;
+  // deleting the dispatchers disconnects all Python signal handlers
+  foreach(PythonQtSignalDispatcher* dispatcher, signalDispatchers) {
+    delete dispatcher;
   }
-  // just to be sure, clear the receiver map as well
-  _p->_signalReceivers.clear();
 }
 
 namespace
@@ -1794,6 +2003,61 @@ void PythonQt::stdOutRedirectCB(const QString& str)
   Q_EMIT PythonQt::self()->pythonStdOut(str);
 }
 
+void PythonQt::setRedirectFlushPolicy(int policy, int maxBufferSize, int flushInterval)
+{
+  PYTHONQT_GIL_SCOPE;
+  // pass on what was buffered with the old policy
+  flushRedirectedOutput();
+  PythonQtObjectPtr redirects[2] = { _p->_stdOutRedirect, _p->_stdErrRedirect };
+  for (int i = 0; i < 2; i++) {
+    PythonQtStdOutRedirect* redirect = (PythonQtStdOutRedirect*)redirects[i].object();
+    if (!redirect) {
+      continue;
+    }
+    if (policy == RedirectUnbuffered) {
+      delete redirect->_buffer;
+      redirect->_buffer = nullptr;
+    } else {
+      if (!redirect->_buffer) {
+        redirect->_buffer = new PythonQtStdOutBuffer;
+      }
+      redirect->_buffer->setPolicy(policy, maxBufferSize, flushInterval);
+    }
+  }
+
+  if (policy & RedirectFlushOnInterval) {
+    if (!_p->_redirectFlushTimer) {
+      _p->_redirectFlushTimer = new QTimer(this);
+      connect(_p->_redirectFlushTimer, &QTimer::timeout, this, [this]() {
+        PYTHONQT_GIL_SCOPE;
+        int interval = _p->_redirectFlushTimer->interval();
+        PythonQtObjectPtr redirects[2] = { _p->_stdOutRedirect, _p->_stdErrRedirect };
+        for (int i = 0; i < 2; i++) {
+          PythonQtStdOutRedirect* redirect = (PythonQtStdOutRedirect*)redirects[i].object();
+          if (redirect && redirect->_buffer) {
+            redirect->_buffer->flushAll(redirect->_cb, interval);
+          }
+        }
+      });
+    }
+    _p->_redirectFlushTimer->start(qMax(1, flushInterval));
+  } else if (_p->_redirectFlushTimer) {
+    _p->_redirectFlushTimer->stop();
+  }
+}
+
+void PythonQt::flushRedirectedOutput()
+{
+  PYTHONQT_GIL_SCOPE;
+  PythonQtObjectPtr redirects[2] = { _p->_stdOutRedirect, _p->_stdErrRedirect };
+  for (int i = 0; i < 2; i++) {
+    PythonQtStdOutRedirect* redirect = (PythonQtStdOutRedirect*)redirects[i].object();
+    if (redirect && redirect->_buffer) {
+      redirect->_buffer->flushAll(redirect->_cb);
+    }
+  }
+}
+
 void PythonQt::stdErrRedirectCB(const QString& str)
 {
   if (!PythonQt::self()) {
@@ -1818,6 +2082,121 @@ void PythonQt::setProfilingCallback(ProfilingCB* cb)
   _p->_profilingCB = cb;
 }
 
+bool PythonQt::setMethodInfoCacheFile(const QString& fileName, const QByteArray& applicationBuildId)
+{
+  _p->_methodInfoCacheFile = fileName;
+  _p->_methodInfoCacheBuildId = PythonQtMethodInfo::persistentCacheBuildId(applicationBuildId);
+  if (fileName.isEmpty()) {
+    return false;
+  }
+  return PythonQtMethodInfo::loadPersistentCache(fileName, _p->_methodInfoCacheBuildId);
+}
+
+bool PythonQt::setBytecodeCacheDirectory(const QString& path)
+{
+  return PythonQtImport::setBytecodeCacheDirectory(path);
+}
+
+QString PythonQt::bytecodeCacheDirectory() const
+{
+  return PythonQtImport::bytecodeCacheDirectory();
+}
+
+int PythonQt::populateBytecodeCache(const QStringList& paths)
+{
+  PYTHONQT_GIL_SCOPE
+  return PythonQtImport::populateBytecodeCache(paths);
+}
+
+qint64 PythonQt::metadataMemoryUsage()
+{
+  qint64 size = PythonQtMethodInfo::cachedMethodInfosMemoryUsage();
+  Q_FOREACH(PythonQtClassInfo* info, _p->_knownClassInfos) {
+    size += info->metadataMemoryUsage();
+  }
+  return size;
+}
+
+void PythonQt::setDeferredClassRegistration(bool flag, const QSet<QByteArray>& eagerClasses)
+{
+  PYTHONQT_GIL_SCOPE
+  _p->setDeferredClassRegistration(flag, eagerClasses);
+}
+
+bool PythonQt::loadStartupSnapshot(const QString& fileName)
+{
+  QFile file(fileName);
+  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    return false;
+  }
+  QSet<QByteArray> classes;
+  Q_FOREACH(const QByteArray& line, file.readAll().split('\n')) {
+    QByteArray name = line.trimmed();
+    if (!name.isEmpty() && !name.startsWith('#')) {
+      classes.insert(name);
+    }
+  }
+  setDeferredClassRegistration(true, classes);
+  return true;
+}
+
+bool PythonQt::saveStartupSnapshot(const QString& fileName)
+{
+  QSaveFile file(fileName);
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+    return false;
+  }
+  file.write("# classes that were used by a previous run, see PythonQt::loadStartupSnapshot()\n");
+  Q_FOREACH(const QByteArray& name, usedClasses()) {
+    file.write(name + "\n");
+  }
+  return file.commit();
+}
+
+QList<QByteArray> PythonQt::usedClasses()
+{
+  return _p->usedClasses();
+}
+
+int PythonQt::deferredClassCount()
+{
+  return _p->deferredClassCount();
+}
+
+PythonQtCensus PythonQt::census()
+{
+  PYTHONQT_GIL_SCOPE
+  return _p->census();
+}
+
+void PythonQt::setWrapperAllocationSampling(int n)
+{
+  PYTHONQT_GIL_SCOPE
+  _p->setWrapperAllocationSampling(n);
+}
+
+PythonQtObjectPtr PythonQt::installAsyncioEventLoop()
+{
+  if (_p->_pyAsyncioLoop) {
+    return _p->_pyAsyncioLoop;
+  }
+  PYTHONQT_GIL_SCOPE
+  PythonQtObjectPtr loop = PythonQtAsyncioDriver::createEventLoop(this);
+  if (loop) {
+    PythonQtObjectPtr result;
+    result.setNewRef(PyObject_CallMethod(loop, const_cast<char*>("install"), nullptr));
+    if (result) {
+      _p->_pyAsyncioLoop = loop;
+    } else {
+      loop = PythonQtObjectPtr();
+    }
+  }
+  if (!loop) {
+    handleError();
+  }
+  return loop;
+}
+
 
 void PythonQt::setEnableThreadSupport(bool flag)
 {
@@ -1861,6 +2240,19 @@ void PythonQt::initPythonQtModule(bool redirectStdOut, const QByteArray& pythonQ
 
   Py_INCREF((PyObject*)&PythonQtBoolResult_Type);
   PyModule_AddObject(_p->pythonQtModule().object(), "BoolResult", (PyObject*)&PythonQtBoolResult_Type);
+  Py_INCREF((PyObject*)&PythonQtSequenceView_Type);
+  PyModule_AddObject(_p->pythonQtModule().object(), "SequenceView", (PyObject*)&PythonQtSequenceView_Type);
+  Py_INCREF((PyObject*)&PythonQtMappingView_Type);
+  PyModule_AddObject(_p->pythonQtModule().object(), "MappingView", (PyObject*)&PythonQtMappingView_Type);
+
+  // exceptions for failed slot calls and missing attributes, their messages are only rendered when needed
+  _p->_pyOverloadError.setNewRef(PythonQtErrorMessage_NewExceptionType((name + ".OverloadError").constData(), PyExc_ValueError));
+  _p->_pyConversionError.setNewRef(PythonQtErrorMessage_NewExceptionType((name + ".ConversionError").constData(), PyExc_ValueError));
+  _p->_pyAttributeError.setNewRef(PythonQtErrorMessage_NewExceptionType((name + ".AttributeError").constData(), PyExc_AttributeError));
+  Py_INCREF(_p->_pyOverloadError.object());
+  PyModule_AddObject(_p->pythonQtModule().object(), "OverloadError", _p->_pyOverloadError.object());
+  Py_INCREF(_p->_pyConversionError.object());
+  PyModule_AddObject(_p->pythonQtModule().object(), "ConversionError", _p->_pyConversionError.object());
   PythonQtObjectPtr sys;
   sys.setNewRef(PyImport_ImportModule("sys"));
 
@@ -1872,6 +2264,8 @@ void PythonQt::initPythonQtModule(bool redirectStdOut, const QByteArray& pythonQ
     ((PythonQtStdOutRedirect*)out.object())->_cb = stdOutRedirectCB;
     err = PythonQtStdOutRedirectType.tp_new(&PythonQtStdOutRedirectType,nullptr, nullptr);
     ((PythonQtStdOutRedirect*)err.object())->_cb = stdErrRedirectCB;
+    _p->_stdOutRedirect = out;
+    _p->_stdErrRedirect = err;
     // replace the built in file objects with our own objects
     PyModule_AddObject(sys, "stdout", out);
     PyModule_AddObject(sys, "stderr", err);
@@ -1978,6 +2372,9 @@ void PythonQt::registerCPPClass(const char* typeName, const char* parentTypeName
 PythonQtClassInfo* PythonQtPrivate::lookupClassInfoAndCreateIfNotPresent(const char* typeName)
 {
   PythonQtClassInfo* info = _knownClassInfos.value(typeName);
+  if (!info && registerDeferredClass(typeName)) {
+    info = _knownClassInfos.value(typeName);
+  }
   if (!info) {
     info = new PythonQtClassInfo();
     info->setupCPPObject(typeName);
@@ -2009,13 +2406,21 @@ bool PythonQtPrivate::addParentClass(const char* typeName, const char* parentTyp
     PythonQtClassInfo* parentInfo = lookupClassInfoAndCreateIfNotPresent(parentTypeName);
     info->addParentClass(PythonQtClassInfo::ParentClassInfo(parentInfo, upcastingOffset));
     return true;
-  } else {
-    return false;
   }
+  QHash<QByteArray, DeferredClass>::iterator deferred = _deferredClasses.find(typeName);
+  if (deferred != _deferredClasses.end()) {
+    // added when the class is registered
+    deferred->parentClasses << qMakePair(QByteArray(parentTypeName), upcastingOffset);
+    return true;
+  }
+  return false;
 }
 
 void PythonQtPrivate::registerCPPClass(const char* typeName, const char* parentTypeName, const char* package, PythonQtQObjectCreatorFunctionCB* wrapperCreator,  PythonQtShellSetInstanceWrapperCB* shell, PyObject* module, int typeSlots)
 {
+  if (deferRegistration(typeName, nullptr, parentTypeName, package, wrapperCreator, shell, module, typeSlots)) {
+    return;
+  }
   PythonQtClassInfo* info = lookupClassInfoAndCreateIfNotPresent(typeName);
   if (!info->pythonQtClassWrapper()) {
     info->setTypeSlots(typeSlots);
@@ -2351,15 +2756,54 @@ const QMetaObject* PythonQtPrivate::buildDynamicMetaObject(PythonQtClassWrapper*
     }
     // TODO: handle enums, classinfo, ...
   }
+  PythonQtDynamicClassInfo* info = type->_dynamicClassInfo;
+  // start with the dispatch tables of a dynamic base class (if there is one),
+  // so that we can dispatch the methods/properties of the whole dynamic chain
+  PythonQtClassWrapper* superType = (PythonQtClassWrapper*)((PyTypeObject*)type)->tp_base;
+  if (superType->_dynamicClassInfo && superType->_dynamicClassInfo->_dynamicMetaObject == prototypeMetaObject) {
+    info->_slotOffset = superType->_dynamicClassInfo->_slotOffset;
+    info->_propertyOffset = superType->_dynamicClassInfo->_propertyOffset;
+    info->_slots = superType->_dynamicClassInfo->_slots;
+    info->_properties = superType->_dynamicClassInfo->_properties;
+  } else {
+    info->_slotOffset = prototypeMetaObject->methodCount();
+    info->_propertyOffset = prototypeMetaObject->propertyCount();
+  }
   if (needsMetaObject) {
-    type->_dynamicClassInfo->_dynamicMetaObject = builder.toMetaObject();
-    type->_dynamicClassInfo->_classInfo = new PythonQtClassInfo();
-    type->_dynamicClassInfo->_classInfo->setupQObject(type->_dynamicClassInfo->_dynamicMetaObject);
+    const QMetaObject* meta = builder.toMetaObject();
+    info->_dynamicMetaObject = meta;
+    info->_classInfo = new PythonQtClassInfo();
+    info->_classInfo->setupQObject(meta);
+    buildDynamicDispatchTables(info, dict);
   } else {
     // we don't need an own meta object, just use the one from our base class
-    type->_dynamicClassInfo->_dynamicMetaObject = prototypeMetaObject;
+    info->_dynamicMetaObject = prototypeMetaObject;
+  }
+  return info->_dynamicMetaObject;
+}
+
+void PythonQtPrivate::buildDynamicDispatchTables(PythonQtDynamicClassInfo* info, PyObject* dict)
+{
+  const QMetaObject* meta = info->_dynamicMetaObject;
+  info->_slots.resize(meta->methodCount() - info->_slotOffset);
+  for (int i = meta->methodOffset(); i < meta->methodCount(); i++) {
+    QMetaMethod method = meta->method(i);
+    if (method.methodType() == QMetaMethod::Signal) {
+      // signals are emitted directly, they have no Python code
+      continue;
+    }
+    PythonQtDynamicSlotEntry& entry = info->_slots[i - info->_slotOffset];
+    entry._name.setNewRef(PyString_InternFromString(method.name().constData()));
+    entry._methodInfo = PythonQtMethodInfo::getCachedMethodInfo(method, nullptr);
+  }
+  info->_properties.resize(meta->propertyCount() - info->_propertyOffset);
+  for (int i = meta->propertyOffset(); i < meta->propertyCount(); i++) {
+    // borrowed reference, the PythonQtObjectPtr keeps it alive
+    PyObject* prop = PyDict_GetItemString(dict, meta->property(i).name());
+    if (prop && PythonQtProperty_Check(prop)) {
+      info->_properties[i - info->_propertyOffset] = prop;
+    }
   }
-  return type->_dynamicClassInfo->_dynamicMetaObject;
 }
 
 
@@ -2367,14 +2811,21 @@ int PythonQtPrivate::handleMetaCall(QObject* object, PythonQtInstanceWrapper* wr
 {
   const QMetaObject* meta = object->metaObject();
   int methodCount = meta->methodCount();
+  PythonQtDynamicClassInfo* dynamicInfo = wrapper->dynamicClassInfo();
   if (call == QMetaObject::InvokeMetaMethod) {
-    QMetaMethod method = meta->method(id);
-    if (method.methodType() == QMetaMethod::Signal) {
-      // just emit the signal, there is no Python code
-      QMetaObject::activate(object, id, args);
-    } else {
+    const PythonQtDynamicSlotEntry* entry = dynamicInfo ? dynamicInfo->slotEntry(id) : nullptr;
+    if (entry) {
       PYTHONQT_GIL_SCOPE
-      callMethodInPython(method, wrapper, args);
+      callMethodInPython(*entry, wrapper, args);
+    } else {
+      QMetaMethod method = meta->method(id);
+      if (method.methodType() == QMetaMethod::Signal) {
+        // just emit the signal, there is no Python code
+        QMetaObject::activate(object, id, args);
+      } else {
+        PYTHONQT_GIL_SCOPE
+        callMethodInPython(method, wrapper, args);
+      }
     }
   } else {
     PYTHONQT_GIL_SCOPE
@@ -2382,11 +2833,19 @@ int PythonQtPrivate::handleMetaCall(QObject* object, PythonQtInstanceWrapper* wr
     if (!metaProp.isValid()) {
       return id - methodCount;
     }
+    PythonQtObjectPtr maybeProp = dynamicInfo ? dynamicInfo->property(id) : nullptr;
+    if (!maybeProp) {
+      // Get directly from the Python class, since we don't want to get the value of the property
+      PythonQtObjectPtr name;
+      name.setNewRef(PyString_FromString(metaProp.name()));
+      maybeProp.setNewRef(PyBaseObject_Type.tp_getattro((PyObject*)wrapper, name));
+      if (!maybeProp) {
+        PyErr_Clear();
+      }
+    }
     PythonQtProperty* prop = nullptr;
-    // Get directly from the Python class, since we don't want to get the value of the property
-    PyObject* maybeProp = PyBaseObject_Type.tp_getattro((PyObject*)wrapper, PyString_FromString(metaProp.name()));
-    if (maybeProp && PythonQtProperty_Check(maybeProp)) {
-      prop = (PythonQtProperty*)maybeProp;
+    if (maybeProp && PythonQtProperty_Check(maybeProp.object())) {
+      prop = (PythonQtProperty*)maybeProp.object();
     } else {
       return id - methodCount;
     }
@@ -2417,11 +2876,151 @@ int PythonQtPrivate::handleMetaCall(QObject* object, PythonQtInstanceWrapper* wr
   return id - methodCount;
 }
 
+void PythonQtPrivate::setWrapperAllocationSampling(int n)
+{
+  _wrapperSamplingRate = qMax(n, 0);
+  _wrapperSamplingCounter = 0;
+  if (!_wrapperSamplingRate) {
+    _sampledWrappers.clear();
+  }
+}
+
+void PythonQtPrivate::sampleWrapperAllocation(PythonQtInstanceWrapper* wrapper)
+{
+  QByteArray site("<C++>");
+  PyFrameObject* frame = PyEval_GetFrame();
+  if (frame) {
+#if PY_VERSION_HEX >= 0x03090000
+    PyCodeObject* code = PyFrame_GetCode(frame);
+#else
+    PyCodeObject* code = frame->f_code;
+    Py_XINCREF(code);
+#endif
+    if (code) {
+      site = PythonQtConv::PyObjGetString(code->co_filename).toUtf8() + ":" + QByteArray::number(PyFrame_GetLineNumber(frame));
+      Py_DECREF(code);
+    }
+  }
+  _sampledWrappers.insert(wrapper, site);
+}
+
+PythonQtCensus PythonQtPrivate::census() const
+{
+  PythonQtCensus census;
+
+  QHash<PythonQtClassInfo*, PythonQtClassCensus> classes;
+  for (QHash<void*, PythonQtInstanceWrapper*>::const_iterator it = _wrappedObjects.constBegin(); it != _wrappedObjects.constEnd(); ++it) {
+    PythonQtInstanceWrapper* wrapper = it.value();
+    PythonQtClassInfo* info = wrapper->classInfo();
+    PythonQtClassCensus& entry = classes[info];
+    entry.wrappers++;
+    if (wrapper->_ownedByPythonQt) {
+      entry.ownedByPython++;
+    } else {
+      entry.ownedByCPP++;
+    }
+    if (wrapper->_isShellInstance) {
+      entry.shellInstances++;
+    }
+    if (!wrapper->_wrappedPtr && !wrapper->_obj) {
+      entry.deletedObjects++;
+    }
+    entry.approximateBytes += Py_TYPE(wrapper)->tp_basicsize;
+    if (wrapper->_wrappedPtr && wrapper->_ownedByPythonQt && info->metaTypeId() >= 0) {
+      entry.approximateBytes += QMetaType(info->metaTypeId()).sizeOf();
+    }
+  }
+  for (QHash<PythonQtClassInfo*, PythonQtClassCensus>::iterator it = classes.begin(); it != classes.end(); ++it) {
+    it->className = it.key()->className();
+    census.wrappers += it->wrappers;
+    census.ownedByPython += it->ownedByPython;
+    census.ownedByCPP += it->ownedByCPP;
+    census.wrapperBytes += it->approximateBytes;
+  }
+  census.classes = classes.values();
+  std::sort(census.classes.begin(), census.classes.end(), [](const PythonQtClassCensus& a, const PythonQtClassCensus& b) {
+    return a.wrappers > b.wrappers;
+  });
+
+  census.signalDispatchers = _signalDispatchers.size();
+  Q_FOREACH(PythonQtSignalDispatcher* dispatcher, _signalDispatchers) {
+    census.signalHandlers += dispatcher->connectionCount();
+  }
+
+  census.classInfos = _knownClassInfos.size();
+  Q_FOREACH(PythonQtClassInfo* info, _knownClassInfos) {
+    census.cachedMembers += info->cachedMemberCount();
+    census.classInfoBytes += info->metadataMemoryUsage();
+  }
+  census.cachedSignatures = PythonQtMethodInfo::cachedSignatureCount();
+  census.cachedParameterInfos = PythonQtMethodInfo::cachedParameterInfoCount();
+  census.methodInfoBytes = PythonQtMethodInfo::cachedMethodInfosMemoryUsage();
+
+  QHash<QByteArray, int> sites;
+  Q_FOREACH(const QByteArray& site, _sampledWrappers) {
+    sites[site]++;
+  }
+  for (QHash<QByteArray, int>::const_iterator it = sites.constBegin(); it != sites.constEnd(); ++it) {
+    census.allocationSites << qMakePair(it.key(), it.value());
+  }
+  std::sort(census.allocationSites.begin(), census.allocationSites.end(), [](const QPair<QByteArray, int>& a, const QPair<QByteArray, int>& b) {
+    return a.second > b.second;
+  });
+  return census;
+}
+
 void PythonQtPrivate::callMethodInPython(QMetaMethod &method, PythonQtInstanceWrapper* wrapper, void** args)
 {
-  PyObject* func = PyObject_GetAttrString((PyObject*)wrapper, method.name());
+  PythonQtDynamicSlotEntry entry;
+  entry._name.setNewRef(PyString_FromString(method.name().constData()));
+  entry._methodInfo = PythonQtMethodInfo::getCachedMethodInfo(method, nullptr);
+  callMethodInPython(entry, wrapper, args);
+}
+
+//! returns a new reference to the bound method of the slot entry on the wrapper (or nullptr with a Python error set)
+static PyObject* PythonQtPrivate_getSlotMethod(const PythonQtDynamicSlotEntry& entry, PythonQtInstanceWrapper* wrapper)
+{
+  PyObject* self = (PyObject*)wrapper;
+  // an attribute in the instance dict hides the function of the class
+  PyObject** dictPtr = _PyObject_GetDictPtr(self);
+  if (dictPtr && *dictPtr && PyDict_GetItem(*dictPtr, entry._name)) {
+    return PyObject_GetAttr(self, entry._name);
+  }
+  PyTypeObject* type = Py_TYPE(self);
+  if (entry._functionType != type || entry._functionTypeVersion != type->tp_version_tag
+    || !PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)) {
+    // _PyType_Lookup() assigns a new version tag to the type if it has none
+    PyObject* function = _PyType_Lookup(type, entry._name);
+    if (function && PyFunction_Check(function) && PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)) {
+      entry._function = function;
+      entry._functionType = type;
+      entry._functionTypeVersion = type->tp_version_tag;
+    } else {
+      entry._function = nullptr;
+      entry._functionType = nullptr;
+    }
+  }
+  if (entry._function) {
+    // binding the function is the same as what the generic attribute lookup does for a plain Python function
+#ifdef PY3K
+    return PyMethod_New(entry._function, self);
+#else
+    return PyMethod_New(entry._function, self, (PyObject*)type);
+#endif
+  }
+  // properties, descriptors, callable objects etc. are handled by the normal attribute lookup
+  return PyObject_GetAttr(self, entry._name);
+}
+
+void PythonQtPrivate::callMethodInPython(const PythonQtDynamicSlotEntry& entry, PythonQtInstanceWrapper* wrapper, void** args)
+{
+  PythonQtTraceScope trace(PythonQtTrace::Virtuals);
+  if (trace.isEnabled()) {
+    trace.begin(Py_TYPE(wrapper)->tp_name, PythonQtConv::PyObjGetString(entry._name).toUtf8().constData());
+  }
+  const PythonQtMethodInfo* methodInfo = entry._methodInfo;
+  PyObject* func = PythonQtPrivate_getSlotMethod(entry, wrapper);
   if (func) {
-    const PythonQtMethodInfo* methodInfo = PythonQtMethodInfo::getCachedMethodInfo(method, nullptr);
     PyObject* result = PythonQtSignalTarget::call(func, methodInfo, args, false);
     if (result) {
       PythonQtConv::ConvertPythonToQt(methodInfo->parameters().at(0), result, false, nullptr, args[0]);
@@ -2620,6 +3219,9 @@ PythonQtClassInfo* PythonQtPrivate::getClassInfo( const QMetaObject* meta )
 PythonQtClassInfo* PythonQtPrivate::getClassInfo( const QByteArray& className )
 {
   PythonQtClassInfo* result = _knownClassInfos.value(className);
+  if (!result && registerDeferredClass(className)) {
+    result = _knownClassInfos.value(className);
+  }
   if (!result) {
     static bool recursion = false;
     if (!recursion) {
@@ -2642,3 +3244,121 @@ void PythonQtPrivate::registerLazyClass( const QByteArray& name, const QByteArra
 {
   _knownLazyClasses.insert(name, moduleToImport);
 }
+
+//! module __getattr__ of packages with deferred classes, self is the package name
+static PyObject* PythonQtPrivate_packageGetAttr(PyObject* self, PyObject* name)
+{
+  QByteArray package = PythonQtConv::PyObjGetString(self).toUtf8();
+  QByteArray className = PythonQtConv::PyObjGetString(name).toUtf8();
+  PyObject* result = PythonQt::self() ? PythonQt::priv()->lookupDeferredClass(package, className) : nullptr;
+  if (!result) {
+    QByteArray error = "module '" + package + "' has no attribute '" + className + "'";
+    PyErr_SetString(PyExc_AttributeError, error.constData());
+  }
+  return result;
+}
+
+static PyMethodDef PythonQtPrivate_packageGetAttrDef = {
+  "__getattr__", (PyCFunction)PythonQtPrivate_packageGetAttr, METH_O, "Registers deferred PythonQt classes on first access."
+};
+
+bool PythonQtPrivate::deferRegistration(const char* typeName, const QMetaObject* metaObject, const char* parentTypeName, const char* package,
+  PythonQtQObjectCreatorFunctionCB* wrapperCreator, PythonQtShellSetInstanceWrapperCB* shell, PyObject* module, int typeSlots)
+{
+  // explicit modules and nested classes (which are added to their outer class) are registered eagerly
+  if (!_deferClassRegistration || _deferredRegistrationDepth <= 0 || module || !package || !package[0] || strstr(typeName, "::")) {
+    return false;
+  }
+  if (_eagerClasses.contains(typeName) || _knownClassInfos.contains(typeName)) {
+    // classes that are already referenced by other classes are needed as well
+    _usedClasses.insert(typeName);
+    return false;
+  }
+  DeferredClass& entry = _deferredClasses[typeName];
+  entry.metaObject = metaObject;
+  entry.parentTypeName = parentTypeName;
+  entry.package = package;
+  entry.wrapperCreator = wrapperCreator;
+  entry.shell = shell;
+  entry.typeSlots = typeSlots;
+  entry.parentClasses.clear();
+
+  // the Qt packages are mirrored into the "Qt" package by createPythonQtClassWrapper()
+  QList<QByteArray> packages;
+  packages << entry.package;
+  if (entry.package.startsWith("Qt")) {
+    packages << "Qt";
+  }
+  Q_FOREACH(const QByteArray& name, packages) {
+    if (!_packagesWithDeferredClasses.contains(name)) {
+      _packagesWithDeferredClasses.insert(name);
+      PyObject* packageName = PyString_FromString(name.constData());
+      PyObject* getattr = PyCFunction_New(&PythonQtPrivate_packageGetAttrDef, packageName);
+      Py_DECREF(packageName);
+      if (PyModule_AddObject(packageByName(name.constData()), "__getattr__", getattr) < 0) {
+        Py_DECREF(getattr);
+      }
+    }
+  }
+  return true;
+}
+
+bool PythonQtPrivate::registerDeferredClass(const QByteArray& name)
+{
+  if (_deferredClasses.isEmpty()) {
+    return false;
+  }
+  QHash<QByteArray, DeferredClass>::iterator it = _deferredClasses.find(name);
+  if (it == _deferredClasses.end()) {
+    return false;
+  }
+  DeferredClass entry = it.value();
+  _deferredClasses.erase(it);
+  _usedClasses.insert(name);
+
+  // the class may be needed inside of a block of deferred registrations, but it has to be registered now
+  int depth = _deferredRegistrationDepth;
+  _deferredRegistrationDepth = 0;
+  if (entry.metaObject) {
+    registerClass(entry.metaObject, entry.package.constData(), entry.wrapperCreator, entry.shell, nullptr, entry.typeSlots);
+  } else {
+    registerCPPClass(name.constData(), entry.parentTypeName.constData(), entry.package.constData(), entry.wrapperCreator, entry.shell, nullptr, entry.typeSlots);
+  }
+  for (int i = 0; i < entry.parentClasses.size(); i++) {
+    addParentClass(name.constData(), entry.parentClasses.at(i).first.constData(), entry.parentClasses.at(i).second);
+  }
+  _deferredRegistrationDepth = depth;
+  return true;
+}
+
+PyObject* PythonQtPrivate::lookupDeferredClass(const QByteArray& package, const QByteArray& name)
+{
+  QHash<QByteArray, DeferredClass>::const_iterator it = _deferredClasses.constFind(name);
+  if (it == _deferredClasses.constEnd() || (it->package != package && !(package == "Qt" && it->package.startsWith("Qt")))) {
+    return nullptr;
+  }
+  registerDeferredClass(name);
+  PythonQtClassInfo* info = _knownClassInfos.value(name);
+  PyObject* result = info ? info->pythonQtClassWrapper() : nullptr;
+  Py_XINCREF(result);
+  return result;
+}
+
+void PythonQtPrivate::setDeferredClassRegistration(bool flag, const QSet<QByteArray>& eagerClasses)
+{
+  // deferred classes are found by a module __getattr__, which needs Python 3.7
+  _deferClassRegistration = flag && PY_VERSION_HEX >= 0x03070000;
+  _eagerClasses = eagerClasses;
+  if (!_deferClassRegistration) {
+    Q_FOREACH(const QByteArray& name, _deferredClasses.keys()) {
+      registerDeferredClass(name);
+    }
+  }
+}
+
+QList<QByteArray> PythonQtPrivate::usedClasses() const
+{
+  QList<QByteArray> classes = _usedClasses.values();
+  std::sort(classes.begin(), classes.end());
+  return classes;
+}
@@ -48,6 +48,7 @@
 #include "PythonQtInstanceWrapper.h"
 #include "PythonQtClassWrapper.h"
 #include "PythonQtSlot.h"
+#include "PythonQtMethodInfo.h"
 #include "PythonQtObjectPtr.h"
 #include "PythonQtStdIn.h"
 #include "PythonQtThreadSupport.h"
@@ -55,7 +56,10 @@
 #include <QVariant>
 #include <QList>
 #include <QHash>
+#include <QVector>
 #include <QByteArray>
+#include <QPair>
+#include <QSet>
 #include <QStringList>
 #include <QtDebug>
 #include <iostream>
@@ -63,12 +67,15 @@
 
 class PythonQtClassInfo;
 class PythonQtPrivate;
+class QTimer;
+class QThread;
 class PythonQtMethodInfo;
-class PythonQtSignalReceiver;
+class PythonQtSignalDispatcher;
 class PythonQtImportFileInterface;
 class PythonQtCppWrapperFactory;
 class PythonQtForeignWrapperFactory;
 class PythonQtQFileImporter;
+struct PythonQtDynamicSlotEntry;
 
 typedef void  PythonQtVoidPtrCB(void* object);
 typedef void  PythonQtQObjectWrappedCB(QObject* object);
@@ -157,6 +164,59 @@ template<class T> QObject* PythonQtCreateObject() { return new T(); }
 #define QStringToPythonEncoding(arg) ((arg).toLatin1())
 #endif
 
+//! The live instance wrappers of one class, see PythonQtCensus
+struct PYTHONQT_EXPORT PythonQtClassCensus
+{
+  PythonQtClassCensus():wrappers(0),ownedByPython(0),ownedByCPP(0),shellInstances(0),deletedObjects(0),approximateBytes(0) {}
+
+  QByteArray className;
+  //! number of live wrappers
+  int wrappers;
+  //! wrappers that delete their object when they are deleted
+  int ownedByPython;
+  //! wrappers of objects that are owned by C++
+  int ownedByCPP;
+  //! wrappers of instances of Python classes that derive from the class
+  int shellInstances;
+  //! wrappers whose QObject was already deleted by C++
+  int deletedObjects;
+  //! size of the wrappers and of the value objects owned by them
+  qint64 approximateBytes;
+};
+
+//! Counts and approximate sizes of the objects and caches held by PythonQt, see PythonQt::census()
+struct PYTHONQT_EXPORT PythonQtCensus
+{
+  PythonQtCensus():wrappers(0),ownedByPython(0),ownedByCPP(0),wrapperBytes(0),signalDispatchers(0),signalHandlers(0),
+    classInfos(0),cachedMembers(0),classInfoBytes(0),cachedSignatures(0),cachedParameterInfos(0),methodInfoBytes(0) {}
+
+  //! the classes with live wrappers, sorted by the number of wrappers
+  QList<PythonQtClassCensus> classes;
+  //! totals of the classes
+  int wrappers;
+  int ownedByPython;
+  int ownedByCPP;
+  qint64 wrapperBytes;
+
+  //! number of signal dispatchers (usually one per thread with Python signal handlers)
+  int signalDispatchers;
+  //! number of connected Python signal handlers
+  int signalHandlers;
+
+  //! number of class infos and their cached member lookups
+  int classInfos;
+  int cachedMembers;
+  qint64 classInfoBytes;
+  //! number of parsed method signatures and parameter infos
+  int cachedSignatures;
+  int cachedParameterInfos;
+  qint64 methodInfoBytes;
+
+  //! the sampled allocation sites ("file:line") of the live wrappers with their counts,
+  //! sorted by count, see PythonQt::setWrapperAllocationSampling()
+  QList<QPair<QByteArray, int> > allocationSites;
+};
+
 //! The main interface to the Python Qt binding, realized as a singleton
 /*!
  Use PythonQt::init() to initialize the singleton and PythonQt::self() to access it.
@@ -180,6 +240,14 @@ public:
     PythonAlreadyInitialized = 8 //!<< sets that PythonQt should not can PyInitialize, since it is already done
   };
 
+  //! flags that define when the redirected stdout/stderr is passed to pythonStdOut() and pythonStdErr()
+  enum RedirectFlushPolicy {
+    RedirectUnbuffered = 0,      //!<< every write() is passed on directly (default)
+    RedirectFlushOnNewline = 1,  //!<< complete lines are passed on, incomplete lines stay in the buffer
+    RedirectFlushOnSize = 2,     //!<< the buffer is passed on when it reaches the maximum size
+    RedirectFlushOnInterval = 4  //!<< buffered text is passed on after the flush interval
+  };
+
   //! flags that tell PythonQt which operators to expect on the registered type
   enum TypeSlots {
     Type_Add = 1,
@@ -344,6 +412,29 @@ public:
   //! add a handler for polymorphic downcasting
   void addPolymorphicHandler(const char* typeName, PythonQtPolymorphicHandlerCB* cb);
 
+  //! Defers the registration of the classes of generated wrapper packages (see PythonQt_QtAll::init()) until
+  //! they are first used, except for the given \c eagerClasses. A deferred class is registered when C++ looks it up
+  //! (e.g. as a parameter type or for wrapping an object) or when Python accesses it as a package attribute.
+  //! Deferred classes are missing from dir() and "from package import *" until then. Requires Python 3.7
+  //! (for module __getattr__), all classes are registered eagerly with older versions.
+  //! Has to be called before the packages are initialized.
+  void setDeferredClassRegistration(bool flag, const QSet<QByteArray>& eagerClasses = QSet<QByteArray>());
+
+  //! Enables the deferred class registration with the classes of the given snapshot (written by saveStartupSnapshot())
+  //! as eager classes. Returns false if the file can't be read, the registration is not deferred then.
+  bool loadStartupSnapshot(const QString& fileName);
+
+  //! Writes the names of the classes that were used in this run (the eager classes of a loaded snapshot and all
+  //! deferred classes that were registered on use) to the given file. To record a snapshot, enable the
+  //! deferred registration without eager classes, exercise the application and save the snapshot at exit.
+  bool saveStartupSnapshot(const QString& fileName);
+
+  //! Returns the classes that were used in this run, see saveStartupSnapshot()
+  QList<QByteArray> usedClasses();
+
+  //! Returns the number of classes whose registration is still deferred
+  int deferredClassCount();
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -447,6 +538,13 @@ public:
   //! call the given python object, returns the result as new PyObject
   PyObject* callAndReturnPyObject(PyObject* callable, const QVariantList& args = QVariantList(), const QVariantMap& kwargs = QVariantMap());
 
+  //! Calls the given python object once for each entry of \c argsList, holding the GIL for the whole batch.
+  //! \c results is resized to the number of calls and receives the converted results. Failed calls store an invalid
+  //! QVariant, and their error message ("ExceptionType: message") is stored in \c errors at the same index, if given.
+  //! Errors are not printed. If \c yieldInterval is > 0, the GIL is released after every \c yieldInterval calls,
+  //! so that other Python threads can run during long batches. Returns the number of successful calls.
+  int callBatch(PyObject* callable, const QVector<QVariantList>& argsList, QVector<QVariant>& results, QStringList* errors = nullptr, int yieldInterval = 0);
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -603,6 +701,58 @@ public:
   //! sets a callback that is called before and after function calls for profiling
   void setProfilingCallback(ProfilingCB* cb);
 
+  //! Sets a file that caches the parsed method signatures between sessions, so that warm starts don't need
+  //! to parse them again. The cache is read immediately if it was written with the same Qt/Python/PythonQt versions
+  //! and the same \c applicationBuildId, and it is written back on cleanup() if new signatures have been parsed.
+  //! Pass an \c applicationBuildId that changes with the application build, since the versions alone
+  //! do not change when the registered classes do.
+  //! Returns true if an existing cache was loaded. Pass an empty file name to disable the cache.
+  bool setMethodInfoCacheFile(const QString& fileName, const QByteArray& applicationBuildId = QByteArray());
+
+  //! Sets a directory that caches the compiled code of imported sources that can't get a *.pyc file next to them,
+  //! e.g. modules in Qt resources or in read-only install locations. The cache files are named by a hash of the
+  //! source path and content. Pass an empty path to disable the cache. Returns false if the directory can't be created.
+  bool setBytecodeCacheDirectory(const QString& path);
+
+  //! Returns the directory set with setBytecodeCacheDirectory()
+  QString bytecodeCacheDirectory() const;
+
+  //! Compiles all *.py files below the given directories (e.g. ":/scripts") into the bytecode cache
+  //! (or into *.pyc files where they can be written), e.g. at install time. Returns the number of compiled files.
+  int populateBytecodeCache(const QStringList& paths);
+
+  //! Returns the approximate number of bytes held by the class and method metadata (cached members, slot infos,
+  //! lookup tables and parsed signatures), to monitor its growth in long running sessions.
+  qint64 metadataMemoryUsage();
+
+  //! Returns the number of live instance wrappers per class and their ownership, the number of signal handlers and
+  //! the sizes of the class and method info caches. This only walks PythonQt's own tables (not the Python heap), so it
+  //! is cheap enough to be called periodically. Wrappers of NULL pointers are not counted.
+  PythonQtCensus census();
+
+  //! Records the Python source location ("file:line") that creates every n-th instance wrapper, the sites of the live
+  //! sampled wrappers are reported by census(). Pass 0 to disable the sampling (the default).
+  void setWrapperAllocationSampling(int n);
+
+  //! Creates an asyncio event loop that is driven by the Qt event loop and installs it as the event
+  //! loop of the current thread, so that tasks and futures make progress while the Qt event loop runs,
+  //! without polling. The loop is only reported as running while it runs an iteration, so run_until_complete()
+  //! can still be used (asyncio.run() works as well, but it resets the event loop of the thread when it is done).
+  //! Calling it again returns the already installed loop. Only supported with Python 3.7 or newer.
+  //! Returns the loop or NULL on error.
+  PythonQtObjectPtr installAsyncioEventLoop();
+
+  //! Buffers the redirected stdout/stderr per thread and passes it to pythonStdOut()/pythonStdErr() according to
+  //! the \c policy (a combination of RedirectFlushPolicy flags), so that a print() from a worker thread causes one
+  //! signal per line or chunk instead of one per fragment. \c maxBufferSize is the number of characters for
+  //! RedirectFlushOnSize (without it, a long incomplete line stays in the buffer until it is completed or flushed),
+  //! \c flushInterval is the time in ms for RedirectFlushOnInterval.
+  //! sys.stdout.flush() passes the text of the calling thread on. Only has an effect with RedirectStdOut.
+  void setRedirectFlushPolicy(int policy, int maxBufferSize = 4096, int flushInterval = 100);
+
+  //! passes all text that is buffered in the stdout/stderr redirection on
+  void flushRedirectedOutput();
+
   //! Enable GIL and thread state handling (turned off by default).
   //! If you want to use Python threading, you have to call this
   //! with true early in your main thread, before you launch
@@ -638,8 +788,13 @@ private:
   //! callback for stderr redirection, emits pythonStdErr signal
   static void stdErrRedirectCB(const QString& str);
 
-  //! get (and create if not available) the signal receiver of that QObject, signal receiver is made child of the passed \c obj
-  PythonQtSignalReceiver* getSignalReceiver(QObject* obj);
+  //! get (and create if not available) the signal dispatcher of the thread the QObject lives in
+  PythonQtSignalDispatcher* getSignalDispatcher(QObject* obj);
+
+  //! moves the signal handlers of the QObject from the dispatchers of other threads to the dispatcher of its
+  //! current thread, the dispatchers call this when one of their senders was moved to another thread
+  void moveSignalHandlersToThreadOf(QObject* obj);
+  friend class PythonQtSignalDispatcher;
 
   PythonQt(int flags, const QByteArray& pythonQtModuleName);
   ~PythonQt() override;
@@ -652,6 +807,7 @@ private:
 
 class PythonQtDebugAPI;
 class PythonQtConfigAPI;
+class PythonQtThreadPoolAPI;
 
 //! internal PythonQt details
 class PYTHONQT_EXPORT PythonQtPrivate : public QObject {
@@ -698,6 +854,25 @@ public:
   //! called by destructor of shells to allow invalidation of the Python wrapper
   void shellClassDeleted(void* shellClass);
 
+  //! called for each new instance wrapper, samples its allocation site if enabled
+  void wrapperCreated(PythonQtInstanceWrapper* wrapper) {
+    if (_wrapperSamplingRate && ++_wrapperSamplingCounter >= _wrapperSamplingRate) {
+      _wrapperSamplingCounter = 0;
+      sampleWrapperAllocation(wrapper);
+    }
+  }
+  //! called when an instance wrapper is deleted
+  void wrapperDeleted(PythonQtInstanceWrapper* wrapper) {
+    if (!_sampledWrappers.isEmpty()) {
+      _sampledWrappers.remove(wrapper);
+    }
+  }
+  //! see PythonQt::setWrapperAllocationSampling()
+  void setWrapperAllocationSampling(int n);
+
+  //! see PythonQt::census(), the caller has to hold the GIL
+  PythonQtCensus census() const;
+
   //! try to unwrap the given object to a C++ pointer using the foreign wrapper factories
   void* unwrapForeignWrapper(const QByteArray& classname, PyObject* obj);
 
@@ -710,9 +885,6 @@ public:
   //! lookup existing classinfo and return new if not yet present
   PythonQtClassInfo* lookupClassInfoAndCreateIfNotPresent(const char* typeName);
 
-  //! called when a signal emitting QObject is destroyed to remove the signal handler from the hash map
-  void removeSignalEmitter(QObject* obj);
-
   //! wrap the given QObject into a Python object (or return existing wrapper!)
   PyObject* wrapQObject(QObject* obj);
 
@@ -752,6 +924,13 @@ public:
   //! add a decorator object
   void addDecorators(QObject* o, int decoTypes);
 
+  //! registers a (generated) table of direct call thunks for the slots of the given wrapper meta object.
+  //! The table is resolved lazily, when the first slot of the wrapper is looked up.
+  void registerSlotThunks(const QMetaObject* wrapperMetaObject, const PythonQtSlotThunkEntry* thunks);
+
+  //! returns the direct call thunk for the given method index of a wrapper meta object, or nullptr if there is none
+  PythonQtSlotThunkCB* slotThunk(const QMetaObject* wrapperMetaObject, int methodIndex);
+
   //! helper method that creates a PythonQtClassWrapper object  (returns a new reference)
   PythonQtClassWrapper* createNewPythonQtClassWrapper(PythonQtClassInfo* info, PyObject* module, const QByteArray& pythonClassName);
 
@@ -774,6 +953,24 @@ public:
   //! PythonQt encounters the type
   void registerLazyClass(const QByteArray& name, const QByteArray& moduleToImport);
 
+  //! starts a block of class registrations that may be deferred, see PythonQt::setDeferredClassRegistration()
+  void beginDeferredRegistration() { _deferredRegistrationDepth++; }
+  //! ends a block that was started with beginDeferredRegistration()
+  void endDeferredRegistration() { _deferredRegistrationDepth--; }
+
+  //! registers the given class if its registration was deferred, returns false if it was not deferred
+  bool registerDeferredClass(const QByteArray& name);
+  //! registers the deferred class with the given name if it belongs to the package and returns its class wrapper
+  //! (new reference), returns NULL if there is no such deferred class
+  PyObject* lookupDeferredClass(const QByteArray& package, const QByteArray& name);
+
+  //! see PythonQt::setDeferredClassRegistration()
+  void setDeferredClassRegistration(bool flag, const QSet<QByteArray>& eagerClasses);
+  //! see PythonQt::usedClasses()
+  QList<QByteArray> usedClasses() const;
+  //! see PythonQt::deferredClassCount()
+  int deferredClassCount() const { return _deferredClasses.size(); }
+
   //! creates the new module from the given pycode
   PythonQtObjectPtr createModule(const QString& name, PyObject* pycode);
 
@@ -792,6 +989,16 @@ public:
   //! returns the profiling callback, which may be NULL
   PythonQt::ProfilingCB* profilingCB() const { return _profilingCB; }
 
+  //! exception type for slot calls where no overload matches the arguments (PythonQt.OverloadError, derived from ValueError)
+  PyObject* overloadErrorType() const { return _pyOverloadError ? _pyOverloadError.object() : PyExc_ValueError; }
+
+  //! exception type for slot calls with arguments that can not be converted (PythonQt.ConversionError, derived from ValueError)
+  PyObject* conversionErrorType() const { return _pyConversionError ? _pyConversionError.object() : PyExc_ValueError; }
+
+  //! exception type for missing attributes of wrapped objects (derived from AttributeError, but not added to the
+  //! PythonQt module, so that it does not hide the builtin AttributeError)
+  PyObject* attributeErrorType() const { return _pyAttributeError ? _pyAttributeError.object() : PyExc_AttributeError; }
+
   //! determines the signature of the given callable object (similar as pydoc)
   QString getSignature(PyObject* object);
 
@@ -813,7 +1020,33 @@ public:
   //! calls the given method on Python function with same name.
   void callMethodInPython(QMetaMethod &method, PythonQtInstanceWrapper* wrapper, void** args);
 
+  //! calls the Python function of the given slot entry, the function found on the wrapper's class is cached in the entry.
+  void callMethodInPython(const PythonQtDynamicSlotEntry& entry, PythonQtInstanceWrapper* wrapper, void** args);
+
 private:
+  //! the arguments of a class registration that was deferred
+  struct DeferredClass {
+    //! NULL for classes that were registered with registerCPPClass()
+    const QMetaObject* metaObject;
+    QByteArray parentTypeName;
+    QByteArray package;
+    PythonQtQObjectCreatorFunctionCB* wrapperCreator;
+    PythonQtShellSetInstanceWrapperCB* shell;
+    int typeSlots;
+    //! parent classes that were added with addParentClass() and their upcasting offsets
+    QList<QPair<QByteArray, int> > parentClasses;
+  };
+
+  //! stores the registration instead of doing it, returns false if the class has to be registered now
+  bool deferRegistration(const char* typeName, const QMetaObject* metaObject, const char* parentTypeName, const char* package,
+    PythonQtQObjectCreatorFunctionCB* wrapperCreator, PythonQtShellSetInstanceWrapperCB* shell, PyObject* module, int typeSlots);
+
+  //! records the current Python source location as allocation site of the wrapper
+  void sampleWrapperAllocation(PythonQtInstanceWrapper* wrapper);
+
+  //! fills the slot/property dispatch tables of the given dynamic class info from its meta object and the class dict
+  void buildDynamicDispatchTables(PythonQtDynamicClassInfo* info, PyObject* dict);
+
   //! Setup the shared library suffixes by getting them from the "imp" module.
   void setupSharedLibrarySuffixes();
 
@@ -838,8 +1071,34 @@ private:
   //! lazy classes that cause PythonQt to trigger an import if they are encountered.
   QHash<QByteArray, QByteArray> _knownLazyClasses;
 
-  //! stores signal receivers for QObjects
-  QHash<QObject* , PythonQtSignalReceiver *> _signalReceivers;
+  //! set by setDeferredClassRegistration()
+  bool _deferClassRegistration;
+  //! the nesting of beginDeferredRegistration(), registrations are only deferred inside of such a block
+  int _deferredRegistrationDepth;
+  //! the classes that are registered eagerly when deferring
+  QSet<QByteArray> _eagerClasses;
+  //! the eager classes that have been registered and the deferred classes that were registered on use
+  QSet<QByteArray> _usedClasses;
+  //! the registrations that were deferred, by class name
+  QHash<QByteArray, DeferredClass> _deferredClasses;
+  //! the packages that got a __getattr__ for their deferred classes
+  QSet<QByteArray> _packagesWithDeferredClasses;
+
+  //! stores the signal dispatchers, they are shared by all QObjects of their thread. There is at most one
+  //! dispatcher per thread that is not exhausted, see PythonQtSignalDispatcher
+  QList<PythonQtSignalDispatcher*> _signalDispatchers;
+
+  //! records the allocation site of every n-th instance wrapper, 0 disables the sampling
+  int _wrapperSamplingRate;
+  int _wrapperSamplingCounter;
+  //! the allocation sites of the live sampled wrappers
+  QHash<PythonQtInstanceWrapper*, QByteArray> _sampledWrappers;
+
+  //! registered slot thunk tables that have not been resolved yet
+  QHash<const QMetaObject*, const PythonQtSlotThunkEntry*> _slotThunkTables;
+
+  //! resolved slot thunks per wrapper meta object, indexed by method index - methodOffset
+  QHash<const QMetaObject*, QVector<PythonQtSlotThunkCB*> > _resolvedSlotThunks;
 
   //! the PythonQt python module
   PythonQtObjectPtr _pythonQtModule;
@@ -866,6 +1125,18 @@ private:
   PythonQtObjectPtr _pyFutureClass;
 
   PythonQtObjectPtr _pyTaskDoneCallback;
+  //! the asyncio loop installed by PythonQt::installAsyncioEventLoop()
+  PythonQtObjectPtr _pyAsyncioLoop;
+
+  PythonQtObjectPtr _pyOverloadError;
+  PythonQtObjectPtr _pyConversionError;
+  PythonQtObjectPtr _pyAttributeError;
+
+  //! the stdout/stderr redirection objects (if RedirectStdOut is used)
+  PythonQtObjectPtr _stdOutRedirect;
+  PythonQtObjectPtr _stdErrRedirect;
+  //! flushes the redirection buffers with RedirectFlushOnInterval
+  QTimer* _redirectFlushTimer;
 
   //! the cpp object wrapper factories
   QList<PythonQtCppWrapperFactory*> _cppWrapperFactories;
@@ -878,8 +1149,13 @@ private:
 
   PythonQt::ProfilingCB* _profilingCB;
 
+  //! the persistent method info cache file and its build id (see PythonQt::setMethodInfoCacheFile())
+  QString _methodInfoCacheFile;
+  QByteArray _methodInfoCacheBuildId;
+
   PythonQtDebugAPI* _debugAPI;
   PythonQtConfigAPI* _configAPI;
+  PythonQtThreadPoolAPI* _threadPoolAPI;
 
   int _initFlags;
   int _PythonQtObjectPtr_metaId;
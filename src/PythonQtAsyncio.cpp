@@ -0,0 +1,382 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtAsyncio.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtAsyncio.h"
+#include "PythonQt.h"
+
+#include <QEventLoop>
+#include <QSocketNotifier>
+
+#include <limits>
+
+namespace {
+
+// The Python part of the event loop, the actual waiting is done by the Qt event loop via PythonQtAsyncioDriver.
+// Only the public asyncio and selectors APIs are used: one iteration is run by calling run_forever() with a
+// pending stop(), the selector waits for file descriptors and timers in a nested Qt event loop.
+const char* eventLoopCode =
+  "import asyncio, heapq, itertools, selectors\n"
+  "\n"
+  "def _fileobj_to_fd(fileobj):\n"
+  "  if isinstance(fileobj, int):\n"
+  "    fd = fileobj\n"
+  "  else:\n"
+  "    try:\n"
+  "      fd = int(fileobj.fileno())\n"
+  "    except (AttributeError, TypeError, ValueError):\n"
+  "      raise ValueError('Invalid file object: %r' % (fileobj,)) from None\n"
+  "  if fd < 0:\n"
+  "    raise ValueError('Invalid file descriptor: %d' % fd)\n"
+  "  return fd\n"
+  "\n"
+  "class PythonQtSelector(selectors.BaseSelector):\n"
+  "  def __init__(self, driver):\n"
+  "    self._driver = driver\n"
+  "    self._keys = {}\n"
+  "  def _fd(self, fileobj):\n"
+  "    try:\n"
+  "      return _fileobj_to_fd(fileobj)\n"
+  "    except ValueError:\n"
+  "      for key in self._keys.values():\n"
+  "        if key.fileobj is fileobj:\n"
+  "          return key.fd\n"
+  "      raise\n"
+  "  def register(self, fileobj, events, data=None):\n"
+  "    if (not events) or (events & ~(selectors.EVENT_READ | selectors.EVENT_WRITE)):\n"
+  "      raise ValueError('Invalid events: %r' % events)\n"
+  "    key = selectors.SelectorKey(fileobj, self._fd(fileobj), events, data)\n"
+  "    if key.fd in self._keys:\n"
+  "      raise KeyError('%r (FD %d) is already registered' % (fileobj, key.fd))\n"
+  "    self._keys[key.fd] = key\n"
+  "    self._driver.watchFd(key.fd, events)\n"
+  "    return key\n"
+  "  def unregister(self, fileobj):\n"
+  "    try:\n"
+  "      key = self._keys.pop(self._fd(fileobj))\n"
+  "    except KeyError:\n"
+  "      raise KeyError('%r is not registered' % fileobj) from None\n"
+  "    self._driver.unwatchFd(key.fd)\n"
+  "    return key\n"
+  "  def modify(self, fileobj, events, data=None):\n"
+  "    key = self.get_key(fileobj)\n"
+  "    if events != key.events:\n"
+  "      self.unregister(fileobj)\n"
+  "      return self.register(fileobj, events, data)\n"
+  "    if data != key.data:\n"
+  "      key = key._replace(data=data)\n"
+  "      self._keys[key.fd] = key\n"
+  "    return key\n"
+  "  def select(self, timeout=None):\n"
+  "    # waiting runs the Qt event loop, so that Qt keeps working while asyncio blocks (e.g. in run_until_complete())\n"
+  "    if timeout is None or timeout > 0:\n"
+  "      self._driver.waitForEvents(-1 if timeout is None else timeout)\n"
+  "    ready = []\n"
+  "    for fd, events in self._driver.takeReadyEvents():\n"
+  "      key = self._keys.get(fd)\n"
+  "      if key and (events & key.events):\n"
+  "        ready.append((key, events & key.events))\n"
+  "    return ready\n"
+  "  def get_key(self, fileobj):\n"
+  "    try:\n"
+  "      return self._keys[self._fd(fileobj)]\n"
+  "    except KeyError:\n"
+  "      raise KeyError('%r is not registered' % fileobj) from None\n"
+  "  def get_map(self):\n"
+  "    return dict((key.fileobj, key) for key in self._keys.values())\n"
+  "  def close(self):\n"
+  "    for fd in self._keys:\n"
+  "      self._driver.unwatchFd(fd)\n"
+  "    self._keys.clear()\n"
+  "\n"
+  "class PythonQtEventLoop(asyncio.SelectorEventLoop):\n"
+  "  def __init__(self, driver):\n"
+  "    self._pythonqt_driver = driver\n"
+  "    # (when, id, handle) of the timers, since the loop does not tell when its next timer is due\n"
+  "    self._pythonqt_timers = []\n"
+  "    self._pythonqt_timer_ids = itertools.count()\n"
+  "    self._pythonqt_soon = False\n"
+  "    super().__init__(PythonQtSelector(driver))\n"
+  "    driver.setRunOnceCallback(self._pythonqt_run_once)\n"
+  "  def _pythonqt_run_once(self):\n"
+  "    if self.is_closed():\n"
+  "      return\n"
+  "    try:\n"
+  "      running = asyncio.get_running_loop()\n"
+  "    except RuntimeError:\n"
+  "      running = None\n"
+  "    if running is self:\n"
+  "      # run_until_complete() is waiting in select(), it runs the callbacks itself\n"
+  "      return\n"
+  "    if running is not None:\n"
+  "      # another loop is running in this thread, try again later\n"
+  "      self._pythonqt_driver.scheduleRunOnce(0.05)\n"
+  "      return\n"
+  "    start = self.time()\n"
+  "    self._pythonqt_soon = False\n"
+  "    # the loop is only running during the iteration, so that run_until_complete() and\n"
+  "    # asyncio.run() can be used in between, run_forever() returns after the iteration that calls stop()\n"
+  "    asyncio.SelectorEventLoop.call_soon(self, self.stop)\n"
+  "    asyncio.SelectorEventLoop.run_forever(self)\n"
+  "    timers = self._pythonqt_timers\n"
+  "    while timers and timers[0][0] <= start:\n"
+  "      heapq.heappop(timers)\n"
+  "    self._pythonqt_schedule()\n"
+  "  def _pythonqt_schedule(self):\n"
+  "    if self.is_closed():\n"
+  "      return\n"
+  "    timers = self._pythonqt_timers\n"
+  "    while timers and timers[0][2].cancelled():\n"
+  "      heapq.heappop(timers)\n"
+  "    if self._pythonqt_soon:\n"
+  "      timeout = 0\n"
+  "    elif timers:\n"
+  "      timeout = max(0, timers[0][0] - self.time())\n"
+  "    else:\n"
+  "      timeout = -1\n"
+  "    self._pythonqt_driver.scheduleRunOnce(timeout)\n"
+  "  def call_soon(self, *args, **kwargs):\n"
+  "    handle = super().call_soon(*args, **kwargs)\n"
+  "    self._pythonqt_soon = True\n"
+  "    self._pythonqt_driver.scheduleRunOnce(0)\n"
+  "    return handle\n"
+  "  def call_at(self, *args, **kwargs):\n"
+  "    handle = super().call_at(*args, **kwargs)\n"
+  "    heapq.heappush(self._pythonqt_timers, (handle.when(), next(self._pythonqt_timer_ids), handle))\n"
+  "    self._pythonqt_schedule()\n"
+  "    return handle\n"
+  "  def run_forever(self):\n"
+  "    try:\n"
+  "      super().run_forever()\n"
+  "    finally:\n"
+  "      # the callbacks that are left are run by the Qt event loop again\n"
+  "      self._pythonqt_soon = True\n"
+  "      self._pythonqt_schedule()\n"
+  "  def install(self):\n"
+  "    # make this the event loop of the current (GUI) thread, it is driven by the Qt event loop from now on\n"
+  "    asyncio.set_event_loop(self)\n"
+  "    self._pythonqt_soon = True\n"
+  "    self._pythonqt_schedule()\n";
+
+}
+
+PythonQtAsyncioDriver::PythonQtAsyncioDriver(QObject* parent)
+  : QObject(parent)
+{
+  _timer.setSingleShot(true);
+  connect(&_timer, SIGNAL(timeout()), this, SLOT(runOnce()));
+}
+
+PythonQtAsyncioDriver::~PythonQtAsyncioDriver()
+{
+  for (QHash<int, Notifiers>::iterator it = _notifiers.begin(); it != _notifiers.end(); ++it) {
+    delete it->read;
+    delete it->write;
+  }
+}
+
+PythonQtObjectPtr PythonQtAsyncioDriver::createEventLoop(QObject* parent)
+{
+#if defined(PY3K) && PY_VERSION_HEX >= 0x03070000
+  PythonQtObjectPtr dict;
+  dict.setNewRef(PyDict_New());
+  PyDict_SetItemString(dict, "__builtins__", PyEval_GetBuiltins());
+  PythonQtObjectPtr result;
+  result.setNewRef(PyRun_String(eventLoopCode, Py_file_input, dict, dict));
+  if (!result) {
+    return PythonQtObjectPtr();
+  }
+  PythonQtAsyncioDriver* driver = new PythonQtAsyncioDriver(parent);
+  PythonQtObjectPtr wrappedDriver;
+  wrappedDriver.setNewRef(PythonQt::priv()->wrapQObject(driver));
+  PythonQtObjectPtr loopClass = PyDict_GetItemString(dict, "PythonQtEventLoop");
+  PythonQtObjectPtr loop;
+  loop.setNewRef(PyObject_CallFunctionObjArgs(loopClass, wrappedDriver.object(), NULL));
+  if (!loop) {
+    delete driver;
+  }
+  return loop;
+#else
+  Q_UNUSED(parent);
+  PyErr_SetString(PyExc_RuntimeError, "asyncio is only supported with Python 3.7 or newer");
+  return PythonQtObjectPtr();
+#endif
+}
+
+void PythonQtAsyncioDriver::setRunOnceCallback(PyObject* callable)
+{
+  _runOnce = callable;
+}
+
+void PythonQtAsyncioDriver::watchFd(int fd, int events)
+{
+  Notifiers& notifiers = _notifiers[fd];
+  if ((events & 1) && !notifiers.read) {
+    notifiers.read = new QSocketNotifier(fd, QSocketNotifier::Read);
+    connect(notifiers.read, SIGNAL(activated(int)), this, SLOT(readActivated(int)));
+  } else if (!(events & 1) && notifiers.read) {
+    delete notifiers.read;
+    notifiers.read = nullptr;
+  }
+  if ((events & 2) && !notifiers.write) {
+    notifiers.write = new QSocketNotifier(fd, QSocketNotifier::Write);
+    connect(notifiers.write, SIGNAL(activated(int)), this, SLOT(writeActivated(int)));
+  } else if (!(events & 2) && notifiers.write) {
+    delete notifiers.write;
+    notifiers.write = nullptr;
+  }
+}
+
+void PythonQtAsyncioDriver::unwatchFd(int fd)
+{
+  QHash<int, Notifiers>::iterator it = _notifiers.find(fd);
+  if (it != _notifiers.end()) {
+    // deleteLater, since we might be called from a slot connected to the notifier
+    if (it->read) { it->read->setEnabled(false); it->read->deleteLater(); }
+    if (it->write) { it->write->setEnabled(false); it->write->deleteLater(); }
+    _notifiers.erase(it);
+  }
+  _readyEvents.remove(fd);
+}
+
+PythonQtObjectPtr PythonQtAsyncioDriver::takeReadyEvents()
+{
+  PythonQtObjectPtr result;
+  result.setNewRef(PyList_New(_readyEvents.size()));
+  Py_ssize_t i = 0;
+  for (QHash<int, int>::const_iterator it = _readyEvents.constBegin(); it != _readyEvents.constEnd(); ++it, ++i) {
+    PyList_SET_ITEM(result.object(), i, Py_BuildValue("(ii)", it.key(), it.value()));
+  }
+  _readyEvents.clear();
+  // the notifiers are disabled while their event is pending, reenable them now that asyncio has seen the event
+  for (QHash<int, Notifiers>::iterator it = _notifiers.begin(); it != _notifiers.end(); ++it) {
+    if (it->read) { it->read->setEnabled(true); }
+    if (it->write) { it->write->setEnabled(true); }
+  }
+  return result;
+}
+
+static int PythonQtAsyncioDriver_msec(double timeout)
+{
+  // QTimer takes int milliseconds, a timer that fires too early just reschedules the iteration
+  const double maxTimeout = std::numeric_limits<int>::max() / 1000.;
+  return timeout < maxTimeout ? static_cast<int>(timeout * 1000. + 0.999) : std::numeric_limits<int>::max();
+}
+
+void PythonQtAsyncioDriver::scheduleRunOnce(double timeout)
+{
+  if (timeout < 0) {
+    if (_readyEvents.isEmpty()) {
+      _timer.stop();
+    }
+    return;
+  }
+  int msec = PythonQtAsyncioDriver_msec(timeout);
+  if (!_readyEvents.isEmpty()) {
+    msec = 0;
+  }
+  if (_timer.isActive() && _timer.remainingTime() <= msec) {
+    // already scheduled early enough
+    return;
+  }
+  _timer.start(msec);
+}
+
+void PythonQtAsyncioDriver::waitForEvents(double timeout)
+{
+  if (!_readyEvents.isEmpty()) {
+    return;
+  }
+  QEventLoop loop;
+  QTimer timeoutTimer;
+  timeoutTimer.setSingleShot(true);
+  connect(&timeoutTimer, SIGNAL(timeout()), &loop, SLOT(quit()));
+  if (timeout >= 0) {
+    timeoutTimer.start(PythonQtAsyncioDriver_msec(timeout));
+  }
+  _waitLoops.append(&loop);
+  loop.exec();
+  _waitLoops.removeAll(&loop);
+}
+
+void PythonQtAsyncioDriver::readActivated(int fd)
+{
+  fdReady(fd, 1);
+}
+
+void PythonQtAsyncioDriver::writeActivated(int fd)
+{
+  fdReady(fd, 2);
+}
+
+void PythonQtAsyncioDriver::fdReady(int fd, int event)
+{
+  QHash<int, Notifiers>::iterator it = _notifiers.find(fd);
+  if (it != _notifiers.end()) {
+    // disable until asyncio has handled the event, otherwise level triggered notifiers would fire continuously
+    QSocketNotifier* notifier = (event == 1) ? it->read : it->write;
+    if (notifier) {
+      notifier->setEnabled(false);
+    }
+  }
+  _readyEvents[fd] |= event;
+  // coalesce multiple ready file descriptors into one loop iteration
+  _timer.start(0);
+}
+
+void PythonQtAsyncioDriver::runOnce()
+{
+  if (!_waitLoops.isEmpty()) {
+    // the loop is waiting in select(), a file descriptor became ready or a callback was scheduled
+    if (_waitLoops.last()) {
+      _waitLoops.last()->quit();
+    }
+    return;
+  }
+  if (!_runOnce) {
+    return;
+  }
+  PYTHONQT_GIL_SCOPE
+  PythonQtObjectPtr result;
+  result.setNewRef(PyObject_CallObject(_runOnce, nullptr));
+  if (!result) {
+    PythonQt::self()->handleError();
+  }
+}
@@ -0,0 +1,117 @@
+#ifndef _PYTHONQTASYNCIO_H
+#define _PYTHONQTASYNCIO_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtAsyncio.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+#include "PythonQtSystem.h"
+#include "PythonQtObjectPtr.h"
+
+#include <QObject>
+#include <QHash>
+#include <QTimer>
+#include <QPointer>
+
+class QSocketNotifier;
+class QEventLoop;
+
+//! Drives an asyncio event loop from the Qt event loop.
+//! The Python side of the loop is a SelectorEventLoop with a selector that waits in a nested Qt event loop,
+//! file descriptors are watched with QSocketNotifiers and the loop iteration is scheduled with a single QTimer,
+//! so that the loop only runs when a callback, timer or socket is actually due.
+//! Only the public asyncio API is used, which requires Python 3.7.
+//! Use PythonQt::installAsyncioEventLoop() to create and install the loop.
+class PYTHONQT_EXPORT PythonQtAsyncioDriver : public QObject
+{
+  Q_OBJECT
+
+public:
+  PythonQtAsyncioDriver(QObject* parent = nullptr);
+  ~PythonQtAsyncioDriver() override;
+
+  //! creates the driver and the Python event loop, returns the loop (or NULL with an error on failure)
+  static PythonQtObjectPtr createEventLoop(QObject* parent);
+
+public Q_SLOTS:
+  //! sets the callable that runs one iteration of the asyncio loop
+  void setRunOnceCallback(PyObject* callable);
+
+  //! watch the given file descriptor, events is a mask of selectors.EVENT_READ (1) and selectors.EVENT_WRITE (2)
+  void watchFd(int fd, int events);
+  //! stop watching the given file descriptor
+  void unwatchFd(int fd);
+
+  //! returns a list of (fd, events) tuples that became ready since the last call
+  PythonQtObjectPtr takeReadyEvents();
+
+  //! schedules the next loop iteration in timeout seconds, a negative timeout
+  //! means that the loop only runs when a file descriptor becomes ready or a new callback is scheduled
+  void scheduleRunOnce(double timeout);
+
+  //! runs a nested Qt event loop until a file descriptor becomes ready, an iteration is scheduled
+  //! or the timeout (in seconds, negative for none) expires (used by the selector while the loop runs)
+  void waitForEvents(double timeout);
+
+private Q_SLOTS:
+  void readActivated(int fd);
+  void writeActivated(int fd);
+  void runOnce();
+
+private:
+  struct Notifiers {
+    Notifiers():read(nullptr), write(nullptr) {}
+    QSocketNotifier* read;
+    QSocketNotifier* write;
+  };
+
+  void fdReady(int fd, int event);
+
+  QHash<int, Notifiers> _notifiers;
+  //! ready events per file descriptor, collected until the next select()
+  QHash<int, int> _readyEvents;
+  QTimer _timer;
+  PythonQtSafeObjectPtr _runOnce;
+  //! the nested event loops of waitForEvents()
+  QList<QPointer<QEventLoop> > _waitLoops;
+};
+
+#endif
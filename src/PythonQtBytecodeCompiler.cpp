@@ -0,0 +1,216 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtBytecodeCompiler.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtBytecodeCompiler.h"
+#include "PythonQt.h"
+#include "PythonQtConversion.h"
+#include "PythonQtImporter.h"
+#include "PythonQtImportFileInterface.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QThread>
+#include <QThreadPool>
+
+namespace {
+
+class PythonQtCompileTask : public QRunnable
+{
+public:
+  PythonQtCompileTask(const QString& sourcePath, PythonQtCompiledFile* result)
+    :_sourcePath(sourcePath), _result(result) {}
+
+  void run() override
+  {
+    *_result = PythonQtBytecodeCompiler::compileFile(_sourcePath);
+  }
+
+private:
+  QString _sourcePath;
+  PythonQtCompiledFile* _result;
+};
+
+}
+
+static QString PythonQtBytecodeCompiler_fetchError()
+{
+  PyObject* type;
+  PyObject* value;
+  PyObject* traceback;
+  PyErr_Fetch(&type, &value, &traceback);
+  PyErr_NormalizeException(&type, &value, &traceback);
+  QString error = value ? PythonQtConv::PyObjGetString(value) : QString("unknown error");
+  Py_XDECREF(type);
+  Py_XDECREF(value);
+  Py_XDECREF(traceback);
+  return error;
+}
+
+static bool PythonQtBytecodeCompiler_writeFile(const QString& filename, const QByteArray& data, QString& error)
+{
+  // QSaveFile writes to a temporary file and renames it on commit()
+  QSaveFile file(filename);
+  if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+    error = filename + ": " + file.errorString();
+    return false;
+  }
+  return true;
+}
+
+QStringList PythonQtBytecodeCompiler::findSources(const QStringList& paths)
+{
+  QStringList sources;
+  Q_FOREACH(const QString& path, paths) {
+    QString cleanPath = QDir::cleanPath(path);
+    if (QFileInfo(cleanPath).isFile()) {
+      sources << cleanPath;
+      continue;
+    }
+    QDirIterator it(cleanPath, QStringList() << "*.py", QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+      sources << it.next();
+    }
+  }
+  return sources;
+}
+
+PythonQtCompiledFile PythonQtBytecodeCompiler::compileFile(const QString& sourcePath)
+{
+  QElapsedTimer timer;
+  timer.start();
+
+  PythonQtCompiledFile result;
+  result.sourcePath = sourcePath;
+
+  bool ok;
+  QByteArray source = PythonQt::importInterface()->readSourceFile(sourcePath, ok);
+  if (!ok) {
+    result.error = "could not read " + sourcePath;
+    result.milliseconds = timer.nsecsElapsed() / 1000000.;
+    return result;
+  }
+  if (source == " ") {
+    source.clear();
+  }
+
+  // the importer never writes pyc files into resources, their time stamp is not stored either
+  const bool isResource = sourcePath.startsWith(":");
+  const QString pycFilename = PythonQtImport::getCacheFilename(sourcePath, /*isOptimizedFilename=*/false);
+  long mtime = isResource ? 0 : (long)PythonQtImport::getMTimeOfSource(pycFilename);
+
+  QByteArray data;
+  {
+    PYTHONQT_GIL_SCOPE
+    PyObject* code = PythonQtImport::compileSource(sourcePath, source);
+    if (code) {
+      data = PythonQtImport::compiledModuleData((PyCodeObject*)code, mtime, source.length());
+      Py_DECREF(code);
+    }
+    if (data.isEmpty()) {
+      result.error = PythonQtBytecodeCompiler_fetchError();
+    }
+  }
+
+  if (!data.isEmpty()) {
+    if (!isResource && PythonQtBytecodeCompiler_writeFile(pycFilename, data, result.error)) {
+      result.cachePath = pycFilename;
+    } else {
+      QString cacheFilename = PythonQtImport::getBytecodeCacheFilename(sourcePath, source);
+      if (!cacheFilename.isEmpty()) {
+        // the cache file name depends on the content, so it does not need a time stamp
+        for (int i = 4; i < 8; i++) {
+          data[i] = 0;
+        }
+        if (PythonQtBytecodeCompiler_writeFile(cacheFilename, data, result.error)) {
+          result.cachePath = cacheFilename;
+          result.error.clear();
+        }
+      } else if (isResource) {
+        result.error = "no bytecode cache directory set for resource " + sourcePath;
+      }
+    }
+    result.ok = !result.cachePath.isEmpty();
+  }
+  result.milliseconds = timer.nsecsElapsed() / 1000000.;
+  return result;
+}
+
+QList<PythonQtCompiledFile> PythonQtBytecodeCompiler::compileTree(const QStringList& paths, int numThreads)
+{
+  const QStringList sources = findSources(paths);
+  QList<PythonQtCompiledFile> results;
+  results.reserve(sources.size());
+  for (int i = 0; i < sources.size(); i++) {
+    results.append(PythonQtCompiledFile());
+  }
+
+  bool useThreads = false;
+#if defined(PY3K) && defined(PYTHONQT_GIL_SUPPORT)
+  useThreads = PythonQtGILScope::isGILScopeEnabled() && sources.size() > 1;
+#endif
+  if (!useThreads) {
+    for (int i = 0; i < sources.size(); i++) {
+      results[i] = compileFile(sources.at(i));
+    }
+    return results;
+  }
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(numThreads > 0 ? numThreads : QThread::idealThreadCount());
+  for (int i = 0; i < sources.size(); i++) {
+    // each task writes into its own preallocated result
+    pool.start(new PythonQtCompileTask(sources.at(i), &results[i]));
+  }
+#ifdef PY3K
+  if (PyGILState_Check()) {
+    // the tasks need the GIL to compile
+    PYTHONQT_ALLOW_THREADS_SCOPE
+    pool.waitForDone();
+    return results;
+  }
+#endif
+  pool.waitForDone();
+  return results;
+}
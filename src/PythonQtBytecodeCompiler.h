@@ -0,0 +1,95 @@
+#ifndef _PYTHONQTBYTECODECOMPILER_H
+#define _PYTHONQTBYTECODECOMPILER_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtBytecodeCompiler.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtSystem.h"
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+//! the result of compiling one Python source file with PythonQtBytecodeCompiler
+struct PYTHONQT_EXPORT PythonQtCompiledFile
+{
+  PythonQtCompiledFile():milliseconds(0),ok(false) {}
+
+  //! the compiled source file
+  QString sourcePath;
+  //! the written pyc file, empty if nothing could be written
+  QString cachePath;
+  //! the syntax error or the reason why no pyc file was written
+  QString error;
+  //! the time needed for reading, compiling and writing the file
+  double milliseconds;
+  //! true if the file was compiled and a pyc file was written
+  bool ok;
+};
+
+//! Compiles Python source trees ahead of time, so that the first import does not need to compile them.
+/*! The sources are read via the PythonQtImportFileInterface, like the PythonQt importer does, so
+    Qt resource paths (":/...") are supported as well.
+    The pyc file is written next to the source if possible, otherwise into the
+    bytecode cache directory (see PythonQt::setBytecodeCacheDirectory()), where the
+    importer looks for sources that can't have a pyc file next to them.
+    Files are written atomically, so that a concurrently running importer never sees a partial file.
+*/
+class PYTHONQT_EXPORT PythonQtBytecodeCompiler
+{
+public:
+  //! returns all *.py files in the given files and directories (recursively)
+  static QStringList findSources(const QStringList& paths);
+
+  //! compiles a single source file and writes its pyc file
+  static PythonQtCompiledFile compileFile(const QString& sourcePath);
+
+  //! compiles all *.py files in the given paths, using numThreads worker threads
+  //! (0 uses QThread::idealThreadCount()). The results are in the order of findSources().
+  /*! Worker threads are only used if thread support is enabled (see PythonQt::setEnableThreadSupport()),
+      otherwise the files are compiled in the calling thread.
+      Note that compiling and marshalling holds the GIL, only reading and writing the files runs in parallel.
+      The import interface has to be thread-safe when worker threads are used.
+  */
+  static QList<PythonQtCompiledFile> compileTree(const QStringList& paths, int numThreads = 0);
+};
+
+#endif
@@ -0,0 +1,453 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtCallRecorder.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQt.h"
+#include "PythonQtCallRecorder.h"
+#include "PythonQtConversion.h"
+#include "PythonQtMethodInfo.h"
+#include "PythonQtMisc.h"
+#include "PythonQtSignalReceiver.h"
+#include "PythonQtSlot.h"
+
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include <QSaveFile>
+
+// We need this for the stub meta object of the replay:
+#include <private/qmetaobjectbuilder_p.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+std::atomic<bool> PythonQtCallRecorder::_recording(false);
+
+namespace {
+
+QMutex pythonQtCallRecorderMutex;
+QList<PythonQtRecordedCall> pythonQtRecordedCalls;
+int pythonQtCallRecorderMaxCalls = 0;
+
+const quint32 pythonQtCallRecordingMagic = 0x50514352; // "PQCR"
+const quint32 pythonQtCallRecordingVersion = 1;
+
+}
+
+QByteArray PythonQtRecordedCall::signature() const
+{
+  QByteArray result = name + "(";
+  for (int i = 0; i < argumentTypes.size(); i++) {
+    if (i > 0) {
+      result += ",";
+    }
+    result += argumentTypes.at(i);
+  }
+  return result + ")";
+}
+
+//----------------------------------------------------------------------------------
+
+static QByteArray PythonQtCallRecorder_typeName(const PythonQtMethodInfo::ParameterInfo& param)
+{
+  return param.name + QByteArray(param.pointerCount, '*');
+}
+
+static QVariant PythonQtCallRecorder_variantFromType(int typeId, const void* copy)
+{
+#if QT_VERSION >= 0x060000
+  return QVariant(QMetaType(typeId), copy);
+#else
+  return QVariant(typeId, copy);
+#endif
+}
+
+//! returns if the value can be written to a QDataStream without registered stream operators
+static bool PythonQtCallRecorder_isSerializable(const QVariant& value)
+{
+  int type = value.userType();
+  if (type == QMetaType::QVariantList) {
+    Q_FOREACH(const QVariant& v, value.toList()) {
+      if (!PythonQtCallRecorder_isSerializable(v)) {
+        return false;
+      }
+    }
+    return true;
+  } else if (type == QMetaType::QVariantMap) {
+    Q_FOREACH(const QVariant& v, value.toMap()) {
+      if (!PythonQtCallRecorder_isSerializable(v)) {
+        return false;
+      }
+    }
+    return true;
+  } else if (type == QMetaType::QVariantHash) {
+    Q_FOREACH(const QVariant& v, value.toHash()) {
+      if (!PythonQtCallRecorder_isSerializable(v)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return type > QMetaType::UnknownType && type < QMetaType::User &&
+    type != QMetaType::VoidStar && type != QMetaType::QObjectStar && type != QMetaType::Nullptr;
+}
+
+static QVariant PythonQtCallRecorder_value(const PythonQtMethodInfo::ParameterInfo& param, void* argument)
+{
+  QVariant value;
+  if (!argument || param.pointerCount > 0) {
+    return value;
+  }
+  if (param.typeId == PythonQtMethodInfo::Variant) {
+    value = *(QVariant*)argument;
+  } else if (param.typeId > 0) {
+    value = PythonQtCallRecorder_variantFromType(param.typeId, argument);
+  }
+  return PythonQtCallRecorder_isSerializable(value) ? value : QVariant();
+}
+
+void PythonQtCallRecorder::start(int maxCalls)
+{
+  QMutexLocker locker(&pythonQtCallRecorderMutex);
+  pythonQtCallRecorderMaxCalls = qMax(maxCalls, 1);
+  _recording.store(pythonQtRecordedCalls.size() < pythonQtCallRecorderMaxCalls, std::memory_order_relaxed);
+}
+
+void PythonQtCallRecorder::stop()
+{
+  _recording.store(false, std::memory_order_relaxed);
+}
+
+void PythonQtCallRecorder::clear()
+{
+  QMutexLocker locker(&pythonQtCallRecorderMutex);
+  pythonQtRecordedCalls.clear();
+}
+
+QList<PythonQtRecordedCall> PythonQtCallRecorder::calls()
+{
+  QMutexLocker locker(&pythonQtCallRecorderMutex);
+  return pythonQtRecordedCalls;
+}
+
+void PythonQtCallRecorder::record(PythonQtRecordedCall::Kind kind, const QByteArray& className, const QByteArray& name,
+  const PythonQtMethodInfo* methodInfo, void** arguments, int firstArgument)
+{
+  PythonQtRecordedCall call;
+  call.kind = kind;
+  call.className = className;
+  call.name = name;
+  const QList<PythonQtMethodInfo::ParameterInfo>& params = methodInfo->parameters();
+  call.returnType = PythonQtCallRecorder_typeName(params.at(0));
+  for (int i = firstArgument; i < params.size(); i++) {
+    const PythonQtMethodInfo::ParameterInfo& param = params.at(i);
+    call.argumentTypes << PythonQtCallRecorder_typeName(param);
+    call.arguments << PythonQtCallRecorder_value(param, arguments[i]);
+  }
+
+  QMutexLocker locker(&pythonQtCallRecorderMutex);
+  // recording may have been stopped by another thread in the meantime
+  if (isRecording()) {
+    pythonQtRecordedCalls << call;
+    if (pythonQtRecordedCalls.size() >= pythonQtCallRecorderMaxCalls) {
+      _recording.store(false, std::memory_order_relaxed);
+    }
+  }
+}
+
+bool PythonQtCallRecorder::save(const QString& fileName)
+{
+  QList<PythonQtRecordedCall> recorded = calls();
+  QSaveFile file(fileName);
+  if (!file.open(QIODevice::WriteOnly)) {
+    return false;
+  }
+  QDataStream stream(&file);
+  stream.setVersion(QDataStream::Qt_5_0);
+  stream << pythonQtCallRecordingMagic << pythonQtCallRecordingVersion << qint32(recorded.size());
+  Q_FOREACH(const PythonQtRecordedCall& call, recorded) {
+    stream << qint32(call.kind) << call.className << call.name << call.returnType << call.argumentTypes << call.arguments;
+  }
+  return stream.status() == QDataStream::Ok && file.commit();
+}
+
+bool PythonQtCallRecorder::load(const QString& fileName, QList<PythonQtRecordedCall>& calls)
+{
+  calls.clear();
+  QFile file(fileName);
+  if (!file.open(QIODevice::ReadOnly)) {
+    return false;
+  }
+  QDataStream stream(&file);
+  stream.setVersion(QDataStream::Qt_5_0);
+  quint32 magic = 0;
+  quint32 version = 0;
+  qint32 count = 0;
+  stream >> magic >> version >> count;
+  if (magic != pythonQtCallRecordingMagic || version != pythonQtCallRecordingVersion) {
+    return false;
+  }
+  for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; i++) {
+    PythonQtRecordedCall call;
+    qint32 kind = 0;
+    stream >> kind >> call.className >> call.name >> call.returnType >> call.argumentTypes >> call.arguments;
+    call.kind = PythonQtRecordedCall::Kind(kind);
+    calls << call;
+  }
+  if (stream.status() != QDataStream::Ok) {
+    calls.clear();
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------
+
+namespace {
+
+//! a QObject with a meta object that is built from the recorded slot signatures, its slots do nothing
+class PythonQtReplayStub : public QObject
+{
+public:
+  explicit PythonQtReplayStub(QMetaObject* metaObject):_metaObject(metaObject) {}
+  ~PythonQtReplayStub() override { free(_metaObject); }
+
+  const QMetaObject* metaObject() const override { return _metaObject; }
+
+  int qt_metacall(QMetaObject::Call c, int id, void** arguments) override {
+    id = QObject::qt_metacall(c, id, arguments);
+    if (id >= 0 && c == QMetaObject::InvokeMetaMethod) {
+      // the return value keeps its default value
+      id -= _metaObject->methodCount() - _metaObject->methodOffset();
+    }
+    return id;
+  }
+
+private:
+  QMetaObject* _metaObject;
+};
+
+//! a recorded call with its arguments converted for the replay
+struct PythonQtReplayCall
+{
+  int statistics;
+  //! the stub slot of a slot call
+  PythonQtSlotInfo* slot;
+  //! the Python arguments of a slot call
+  PyObject* args;
+  //! the method info of a dispatch
+  const PythonQtMethodInfo* methodInfo;
+  //! the C++ arguments of a dispatch
+  QVariantList values;
+  //! false if the arguments could not be prepared
+  bool valid;
+};
+
+PyObject* PythonQtCallReplay_stubFunction(PyObject* /*self*/, PyObject* /*args*/)
+{
+  Py_RETURN_NONE;
+}
+
+PyMethodDef pythonQtCallReplayStubDef = { "replayStub", PythonQtCallReplay_stubFunction, METH_VARARGS, nullptr };
+
+}
+
+QList<PythonQtReplayStatistics> PythonQtCallReplay::replay(const QList<PythonQtRecordedCall>& calls, int repetitions)
+{
+  PYTHONQT_GIL_SCOPE
+
+  // one stub class has all recorded slots
+  QMetaObjectBuilder builder;
+  builder.setClassName("PythonQtReplayStub");
+  builder.setSuperClass(&QObject::staticMetaObject);
+  QHash<QByteArray, int> slotIndices;
+  Q_FOREACH(const PythonQtRecordedCall& call, calls) {
+    if (call.kind == PythonQtRecordedCall::SlotCall) {
+      QByteArray signature = QMetaObject::normalizedSignature(call.signature().constData());
+      if (!slotIndices.contains(signature)) {
+        QMetaMethodBuilder method = builder.addSlot(signature);
+        if (!call.returnType.isEmpty() && call.returnType != "void") {
+          method.setReturnType(call.returnType);
+        }
+        slotIndices.insert(signature, method.index());
+      }
+    }
+  }
+  PythonQtReplayStub stub(builder.toMetaObject());
+  QHash<QByteArray, PythonQtSlotInfo*> slotInfos;
+  for (QHash<QByteArray, int>::const_iterator it = slotIndices.constBegin(); it != slotIndices.constEnd(); ++it) {
+    int index = stub.metaObject()->methodOffset() + it.value();
+    slotInfos.insert(it.key(), new PythonQtSlotInfo(nullptr, stub.metaObject()->method(index), index));
+  }
+  PyObject* callable = PyCFunction_New(&pythonQtCallReplayStubDef, nullptr);
+
+  QList<PythonQtReplayStatistics> statistics;
+  QHash<QByteArray, int> statisticsIndices;
+  std::vector<PythonQtReplayCall> replayCalls;
+  replayCalls.reserve(calls.size());
+  Q_FOREACH(const PythonQtRecordedCall& call, calls) {
+    PythonQtReplayCall replayCall;
+    replayCall.slot = nullptr;
+    replayCall.args = nullptr;
+    replayCall.methodInfo = nullptr;
+    replayCall.valid = call.arguments.size() == call.argumentTypes.size() && call.argumentTypes.size() < PYTHONQT_MAX_ARGS;
+
+    QByteArray signature = call.signature();
+    QByteArray key = QByteArray::number(int(call.kind)) + " " + call.className + "::" + signature;
+    QHash<QByteArray, int>::const_iterator index = statisticsIndices.constFind(key);
+    if (index == statisticsIndices.constEnd()) {
+      PythonQtReplayStatistics entry;
+      entry.kind = call.kind;
+      entry.className = call.className;
+      entry.signature = signature;
+      index = statisticsIndices.insert(key, statistics.size());
+      statistics << entry;
+    }
+    replayCall.statistics = index.value();
+
+    if (!replayCall.valid) {
+      // nothing to prepare
+    } else if (call.kind == PythonQtRecordedCall::SlotCall) {
+      replayCall.slot = slotInfos.value(QMetaObject::normalizedSignature(signature.constData()));
+      replayCall.args = PyTuple_New(call.arguments.size());
+      for (int i = 0; i < call.arguments.size(); i++) {
+        PyObject* arg = nullptr;
+        if (call.arguments.at(i).isValid()) {
+          arg = PythonQtConv::QVariantToPyObject(call.arguments.at(i));
+        }
+        if (!arg) {
+          PyErr_Clear();
+          arg = Py_None;
+          Py_INCREF(arg);
+        }
+        // steals the reference
+        PyTuple_SET_ITEM(replayCall.args, i, arg);
+      }
+    } else {
+      std::vector<const char*> typeNames;
+      typeNames.push_back(call.returnType.constData());
+      Q_FOREACH(const QByteArray& type, call.argumentTypes) {
+        typeNames.push_back(type.constData());
+      }
+      replayCall.methodInfo = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(int(typeNames.size()), typeNames.data());
+      const QList<PythonQtMethodInfo::ParameterInfo>& params = replayCall.methodInfo->parameters();
+      for (int i = 0; i < call.arguments.size(); i++) {
+        const PythonQtMethodInfo::ParameterInfo& param = params.at(i + 1);
+        QVariant value = call.arguments.at(i);
+        if (param.pointerCount == 0 && param.typeId != PythonQtMethodInfo::Variant && !value.isValid()) {
+          // use a default constructed value instead of the value that could not be recorded
+          if (param.typeId > 0) {
+            value = PythonQtCallRecorder_variantFromType(param.typeId, nullptr);
+          } else {
+            replayCall.valid = false;
+          }
+        }
+        replayCall.values << value;
+      }
+    }
+    replayCalls.push_back(replayCall);
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+  void* nullPointers[PYTHONQT_MAX_ARGS] = {};
+  void* arguments[PYTHONQT_MAX_ARGS];
+  for (int repetition = 0; repetition < repetitions; repetition++) {
+    for (PythonQtReplayCall& call : replayCalls) {
+      PythonQtReplayStatistics& entry = statistics[call.statistics];
+      if (!call.valid) {
+        entry.failures++;
+        continue;
+      }
+      bool ok = false;
+      qint64 duration = 0;
+      if (call.slot) {
+        PyObject* returnValue = nullptr;
+        qint64 start = timer.nsecsElapsed();
+        ok = PythonQtCallSlot(nullptr, &stub, call.args, false, call.slot, nullptr, &returnValue);
+        duration = timer.nsecsElapsed() - start;
+        Py_XDECREF(returnValue);
+      } else {
+        const QList<PythonQtMethodInfo::ParameterInfo>& params = call.methodInfo->parameters();
+        arguments[0] = nullptr;
+        for (int i = 0; i < call.values.size(); i++) {
+          const PythonQtMethodInfo::ParameterInfo& param = params.at(i + 1);
+          if (param.pointerCount > 0) {
+            arguments[i + 1] = &nullPointers[i];
+          } else if (param.typeId == PythonQtMethodInfo::Variant) {
+            arguments[i + 1] = &call.values[i];
+          } else {
+            arguments[i + 1] = call.values[i].data();
+          }
+        }
+        qint64 start = timer.nsecsElapsed();
+        PyObject* returnValue = PythonQtSignalTarget::call(callable, call.methodInfo, arguments);
+        duration = timer.nsecsElapsed() - start;
+        ok = returnValue != nullptr;
+        Py_XDECREF(returnValue);
+      }
+      if (!ok) {
+        PyErr_Clear();
+        entry.failures++;
+        continue;
+      }
+      if (!entry.calls || duration < entry.minNs) {
+        entry.minNs = duration;
+      }
+      entry.maxNs = qMax(entry.maxNs, duration);
+      entry.totalNs += duration;
+      entry.calls++;
+    }
+  }
+
+  for (PythonQtReplayCall& call : replayCalls) {
+    Py_XDECREF(call.args);
+  }
+  qDeleteAll(slotInfos);
+  Py_DECREF(callable);
+
+  std::sort(statistics.begin(), statistics.end(), [](const PythonQtReplayStatistics& a, const PythonQtReplayStatistics& b) {
+    return a.totalNs > b.totalNs;
+  });
+  return statistics;
+}
@@ -0,0 +1,147 @@
+#ifndef _PYTHONQTCALLRECORDER_H
+#define _PYTHONQTCALLRECORDER_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtCallRecorder.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtSystem.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QVariant>
+
+#include <atomic>
+
+class PythonQtMethodInfo;
+
+//! a crossing between Python and C++ that was recorded by PythonQtCallRecorder
+struct PYTHONQT_EXPORT PythonQtRecordedCall
+{
+  enum Kind {
+    SlotCall,       //!< a C++ slot or decorator slot called from Python
+    SignalDispatch, //!< a Qt signal delivered to a Python signal handler
+    VirtualCall     //!< a Python override of a C++ virtual method called from C++
+  };
+
+  PythonQtRecordedCall():kind(SlotCall) {}
+
+  //! returns the signature of the call, e.g. "setValue(int)"
+  QByteArray signature() const;
+
+  Kind kind;
+  //! the class of the called slot, or the class of the Python object that handled the signal/virtual call
+  QByteArray className;
+  //! the slot name, or the name of the Python function
+  QByteArray name;
+  QByteArray returnType;
+  QList<QByteArray> argumentTypes;
+  //! the argument values, arguments that can't be serialized (e.g. pointers and types without
+  //! a builtin QMetaType) are stored as invalid variants
+  QVariantList arguments;
+};
+
+//! Records the slot calls from Python to C++ and the signal/virtual dispatches from C++ to Python
+//! of a real session, so that they can be replayed as a benchmark of the binding layer by PythonQtCallReplay.
+/*! Recording is disabled by default, which costs one relaxed atomic load per crossing.
+    Only the argument values of builtin Qt types are stored, so a saved recording does not contain
+    pointers into the recording process.
+*/
+class PYTHONQT_EXPORT PythonQtCallRecorder
+{
+public:
+  //! starts recording, recording stops by itself after maxCalls calls have been recorded
+  static void start(int maxCalls = 1000000);
+  //! stops recording, the recorded calls are kept
+  static void stop();
+  //! returns if calls are recorded
+  static bool isRecording() { return _recording.load(std::memory_order_relaxed); }
+
+  //! discards the recorded calls
+  static void clear();
+  //! returns the recorded calls in the order in which they happened
+  static QList<PythonQtRecordedCall> calls();
+
+  //! writes the recorded calls to the given file, returns false if the file could not be written
+  static bool save(const QString& fileName);
+  //! reads calls that were written by save(), returns false if the file could not be read
+  static bool load(const QString& fileName, QList<PythonQtRecordedCall>& calls);
+
+  //! records a call, arguments has the qt_metacall layout (the return value at index 0),
+  //! the parameters of methodInfo are recorded starting at firstArgument
+  static void record(PythonQtRecordedCall::Kind kind, const QByteArray& className, const QByteArray& name,
+    const PythonQtMethodInfo* methodInfo, void** arguments, int firstArgument = 1);
+
+private:
+  static std::atomic<bool> _recording;
+};
+
+//! latency of the replayed calls of one signature, see PythonQtCallReplay
+struct PYTHONQT_EXPORT PythonQtReplayStatistics
+{
+  PythonQtReplayStatistics():kind(PythonQtRecordedCall::SlotCall),calls(0),failures(0),totalNs(0),minNs(0),maxNs(0) {}
+
+  PythonQtRecordedCall::Kind kind;
+  QByteArray className;
+  QByteArray signature;
+  int calls;
+  //! the calls whose arguments or return value could not be converted in the replaying process
+  int failures;
+  qint64 totalNs;
+  qint64 minNs;
+  qint64 maxNs;
+};
+
+//! Replays recorded calls against stub objects, measuring the cost of PythonQt's argument conversion and dispatch.
+/*! Slot calls are made with PythonQtCallSlot() on a stub QObject whose meta object has the recorded slots (which do
+    nothing), signal and virtual dispatches are made with PythonQtSignalTarget::call() on a Python callable that
+    returns None. The recorded classes don't have to exist in the replaying process, but the argument types
+    need to be known to PythonQt to be converted.
+*/
+class PYTHONQT_EXPORT PythonQtCallReplay
+{
+public:
+  //! replays the calls repetitions times and returns the statistics per signature,
+  //! sorted by total time (highest first). PythonQt needs to be initialized.
+  static QList<PythonQtReplayStatistics> replay(const QList<PythonQtRecordedCall>& calls, int repetitions = 1);
+};
+
+#endif
@@ -0,0 +1,275 @@
+#ifndef _PYTHONQTCALLABLE_H
+#define _PYTHONQTCALLABLE_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtCallable.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+#include "PythonQt.h"
+#include "PythonQtConversion.h"
+
+#include <type_traits>
+
+//! Converts a C++ value to a new Python reference, specialized for the common types so that no
+//! QVariant is needed. Other types are converted via QVariant and need to be known to the meta type system.
+template<typename T, typename Enable = void>
+struct PythonQtToPython {
+  static PyObject* convert(const T& value) { return PythonQtConv::QVariantToPyObject(QVariant::fromValue(value)); }
+};
+
+template<> struct PythonQtToPython<bool> {
+  static PyObject* convert(bool value) { return PythonQtConv::GetPyBool(value); }
+};
+
+template<typename T>
+struct PythonQtToPython<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type> {
+  static PyObject* convert(T value) { return PyLong_FromLongLong(value); }
+};
+
+template<typename T>
+struct PythonQtToPython<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value>::type> {
+  static PyObject* convert(T value) { return PyLong_FromUnsignedLongLong(value); }
+};
+
+template<typename T>
+struct PythonQtToPython<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static PyObject* convert(T value) { return PyFloat_FromDouble(value); }
+};
+
+template<> struct PythonQtToPython<QString> {
+  static PyObject* convert(const QString& value) { return PythonQtConv::QStringToPyObject(value); }
+};
+
+template<> struct PythonQtToPython<const char*> {
+  static PyObject* convert(const char* value) { return PythonQtConv::QStringToPyObject(QString::fromUtf8(value)); }
+};
+
+template<> struct PythonQtToPython<QByteArray> {
+  static PyObject* convert(const QByteArray& value) { return PyBytes_FromStringAndSize(value.constData(), value.size()); }
+};
+
+template<> struct PythonQtToPython<QVariant> {
+  static PyObject* convert(const QVariant& value) { return PythonQtConv::QVariantToPyObject(value); }
+};
+
+template<> struct PythonQtToPython<PyObject*> {
+  static PyObject* convert(PyObject* value) { if (!value) { value = Py_None; } Py_INCREF(value); return value; }
+};
+
+template<> struct PythonQtToPython<PythonQtObjectPtr> {
+  static PyObject* convert(const PythonQtObjectPtr& value) { return PythonQtToPython<PyObject*>::convert(value.object()); }
+};
+
+template<typename T>
+struct PythonQtToPython<T*, typename std::enable_if<std::is_base_of<QObject, T>::value>::type> {
+  static PyObject* convert(T* value) { return PythonQt::priv()->wrapQObject(value); }
+};
+
+//! Converts a Python object to a C++ value, the counterpart of PythonQtToPython.
+//! Sets \c ok to false if the object can not be converted.
+template<typename T, typename Enable = void>
+struct PythonQtFromPython {
+  static T convert(PyObject* obj, bool& ok) {
+    QVariant v = PythonQtConv::PyObjToQVariant(obj, qMetaTypeId<T>());
+    ok = v.isValid();
+    return qvariant_cast<T>(v);
+  }
+};
+
+template<> struct PythonQtFromPython<bool> {
+  static bool convert(PyObject* obj, bool& ok) { return PythonQtConv::PyObjGetBool(obj, false, ok); }
+};
+
+template<typename T>
+struct PythonQtFromPython<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type> {
+  static T convert(PyObject* obj, bool& ok) { return static_cast<T>(PythonQtConv::PyObjGetLongLong(obj, false, ok)); }
+};
+
+template<typename T>
+struct PythonQtFromPython<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value>::type> {
+  static T convert(PyObject* obj, bool& ok) { return static_cast<T>(PythonQtConv::PyObjGetULongLong(obj, false, ok)); }
+};
+
+template<typename T>
+struct PythonQtFromPython<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static T convert(PyObject* obj, bool& ok) { return static_cast<T>(PythonQtConv::PyObjGetDouble(obj, false, ok)); }
+};
+
+template<> struct PythonQtFromPython<QString> {
+  static QString convert(PyObject* obj, bool& ok) { return PythonQtConv::PyObjGetString(obj, false, ok); }
+};
+
+template<> struct PythonQtFromPython<QByteArray> {
+  static QByteArray convert(PyObject* obj, bool& ok) { return PythonQtConv::PyObjGetBytes(obj, false, ok); }
+};
+
+template<> struct PythonQtFromPython<QVariant> {
+  static QVariant convert(PyObject* obj, bool& ok) { ok = true; return PythonQtConv::PyObjToQVariant(obj); }
+};
+
+template<> struct PythonQtFromPython<PythonQtObjectPtr> {
+  static PythonQtObjectPtr convert(PyObject* obj, bool& ok) { ok = true; return obj; }
+};
+
+template<typename T>
+struct PythonQtFromPython<T*, typename std::enable_if<std::is_base_of<QObject, T>::value>::type> {
+  static T* convert(PyObject* obj, bool& ok) {
+    ok = (obj == Py_None);
+    if (PyObject_TypeCheck(obj, &PythonQtInstanceWrapper_Type)) {
+      // a wrapper of a different class or of a deleted object is not a valid result
+      T* result = qobject_cast<T*>(((PythonQtInstanceWrapper*)obj)->_obj.data());
+      ok = (result != nullptr);
+      return result;
+    }
+    return nullptr;
+  }
+};
+
+//! Calls a Python callable with typed arguments and converts the result to a typed value,
+//! without boxing the arguments and the result into QVariants.
+//! The callable is resolved once, which makes this well suited for calling scripted hooks in loops:
+//! \code
+//! PythonQtCallable<double(int, const QString&)> weight(PythonQt::self()->getMainModule(), "weight");
+//! double w = weight(1, "a");
+//! \endcode
+//! On errors (including a result that can not be converted), the error is handled by PythonQt::handleError()
+//! and a default constructed R is returned.
+template<typename Signature> class PythonQtCallable;
+
+template<typename R, typename... Args>
+class PythonQtCallable<R(Args...)>
+{
+public:
+  PythonQtCallable() {}
+  PythonQtCallable(const PythonQtObjectPtr& callable) {
+    PYTHONQT_GIL_SCOPE
+    _callable = callable;
+  }
+  //! looks up the callable \c name (which may contain dots) in the given module/object
+  PythonQtCallable(PyObject* module, const QString& name) {
+    PYTHONQT_GIL_SCOPE
+    _callable = PythonQt::self()->lookupCallable(module, name);
+  }
+
+  //! returns if a callable was found
+  bool isValid() const { return !_callable.isNull(); }
+
+  const PythonQtSafeObjectPtr& callable() const { return _callable; }
+
+  //! calls the callable, \c ok is set to false on errors
+  R call(bool* ok, typename std::conditional<std::is_scalar<Args>::value, Args, const Args&>::type... args) const {
+    PYTHONQT_GIL_SCOPE
+    PythonQtObjectPtr result;
+    result.setNewRef(callAndReturnPyObject(args...));
+    return convertResult(result, ok, static_cast<R*>(nullptr));
+  }
+
+  R operator()(typename std::conditional<std::is_scalar<Args>::value, Args, const Args&>::type... args) const {
+    return call(nullptr, args...);
+  }
+
+  //! calls the callable and returns the result as new reference (or NULL with the Python error set)
+  PyObject* callAndReturnPyObject(typename std::conditional<std::is_scalar<Args>::value, Args, const Args&>::type... args) const {
+    if (!_callable) {
+      PyErr_SetString(PyExc_RuntimeError, "PythonQtCallable: no callable");
+      return nullptr;
+    }
+    // one extra slot in front, so that PY_VECTORCALL_ARGUMENTS_OFFSET can be used
+    PyObject* argv[sizeof...(Args) + 1] = { nullptr, PythonQtToPython<typename std::decay<Args>::type>::convert(args)... };
+    PyObject* result = nullptr;
+    bool argsOk = true;
+    for (size_t i = 1; i <= sizeof...(Args); i++) {
+      argsOk = argsOk && argv[i];
+    }
+    if (argsOk) {
+#if PY_VERSION_HEX >= 0x03090000
+      result = PyObject_Vectorcall(_callable.object(), argv + 1, sizeof...(Args) | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+#else
+      PyObject* tuple = PyTuple_New(sizeof...(Args));
+      for (size_t i = 1; i <= sizeof...(Args); i++) {
+        Py_INCREF(argv[i]);
+        PyTuple_SET_ITEM(tuple, i - 1, argv[i]);
+      }
+      result = PyObject_Call(_callable.object(), tuple, nullptr);
+      Py_DECREF(tuple);
+#endif
+    } else if (!PyErr_Occurred()) {
+      PyErr_SetString(PyExc_TypeError, "PythonQtCallable: could not convert argument to Python");
+    }
+    for (size_t i = 1; i <= sizeof...(Args); i++) {
+      Py_XDECREF(argv[i]);
+    }
+    return result;
+  }
+
+private:
+  template<typename T>
+  static T convertResult(PyObject* result, bool* ok, T*) {
+    bool converted = false;
+    T value = T();
+    if (result) {
+      value = PythonQtFromPython<T>::convert(result, converted);
+      if (!converted) {
+        PyErr_Format(PyExc_TypeError, "PythonQtCallable: could not convert result of type %s", Py_TYPE(result)->tp_name);
+      }
+    }
+    if (!converted) {
+      PythonQt::self()->handleError();
+    }
+    if (ok) {
+      *ok = converted;
+    }
+    return value;
+  }
+
+  static void convertResult(PyObject* result, bool* ok, void*) {
+    if (!result) {
+      PythonQt::self()->handleError();
+    }
+    if (ok) {
+      *ok = result != nullptr;
+    }
+  }
+
+  PythonQtSafeObjectPtr _callable;
+};
+
+#endif
@@ -57,6 +57,8 @@ QSet<QByteArray> PythonQtClassInfo::_reservedNames{
   "None", "True", "False"
 };
 
+int PythonQtClassInfo::_classHierarchyGeneration = 0;
+
 PythonQtClassInfo::PythonQtClassInfo() {
   _meta = nullptr;
   _constructors = nullptr;
@@ -74,6 +76,7 @@ PythonQtClassInfo::PythonQtClassInfo() {
   _searchRefCountCB = true;
   _refCallback = nullptr;
   _unrefCallback = nullptr;
+  _ancestorOffsetsGeneration = -1;
 }
 
 PythonQtClassInfo::~PythonQtClassInfo()
@@ -110,10 +113,22 @@ void PythonQtClassInfo::setupCPPObject(const QByteArray& classname)
 
 void PythonQtClassInfo::clearCachedMembers()
 {
+  // subclasses that share our slot chains need to look them up again
+  Q_FOREACH(PythonQtClassInfo* borrower, _slotChainBorrowers) {
+    borrower->forgetSharedSlotChains(this);
+  }
+  _slotChainBorrowers.clear();
+  // and we no longer share the slot chains of our ancestors
+  Q_FOREACH(PythonQtClassInfo* owner, _sharedSlotChains) {
+    owner->_slotChainBorrowers.remove(this);
+  }
+
   QHashIterator<QByteArray, PythonQtMemberInfo> i(_cachedMembers);
   while (i.hasNext()) {
-    PythonQtMemberInfo member = i.next().value();
-    if (member._type== PythonQtMemberInfo::Slot || member._type== PythonQtMemberInfo::Signal) {
+    i.next();
+    const PythonQtMemberInfo& member = i.value();
+    if ((member._type== PythonQtMemberInfo::Slot || member._type== PythonQtMemberInfo::Signal) &&
+        !_sharedSlotChains.contains(i.key())) {
       PythonQtSlotInfo* info = member._slot;
       while (info) {
         PythonQtSlotInfo* next = info->nextInfo();
@@ -122,6 +137,22 @@ void PythonQtClassInfo::clearCachedMembers()
       }
     }
   }
+  _cachedMembers.clear();
+  _sharedSlotChains.clear();
+}
+
+void PythonQtClassInfo::forgetSharedSlotChains(PythonQtClassInfo* owner)
+{
+  QMutableHashIterator<QByteArray, PythonQtClassInfo*> it(_sharedSlotChains);
+  while (it.hasNext()) {
+    it.next();
+    if (it.value() == owner) {
+      _cachedMembers.remove(it.key());
+      it.remove();
+    }
+  }
+  // the operator slots might point into the removed chains
+  clearOperatorSlots();
 }
 
 int PythonQtClassInfo::findCharOffset(const char* sigStart, char someChar)
@@ -185,9 +216,61 @@ PythonQtSlotInfo* PythonQtClassInfo::recursiveFindDecoratorSlotsFromDecoratorPro
 }
 
 PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlotsFromDecoratorProvider(const char* memberName, PythonQtSlotInfo* tail, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset) {
+  const NameIndex& index = nameIndex();
+  const QByteArray name = QByteArray::fromRawData(memberName, static_cast<int>(strlen(memberName)));
+  QHash<QByteArray, QVector<int> >::const_iterator it = index._decoratorMethods.constFind(name);
+  if (it != index._decoratorMethods.constEnd()) {
+    QObject* decoratorProvider = decorator();
+    const QMetaObject* meta = decoratorProvider->metaObject();
+    for (int i : it.value()) {
+      QMetaMethod m = meta->method(i);
+      QByteArray signature = PythonQtUtils::methodName(m);
+      bool isClassDeco = signature.startsWith("static_") || signature.startsWith("new_") || signature.startsWith("delete_");
+      // XXX no checking is currently done if the slots have correct first argument or not...
+      found = true;
+      PythonQtSlotInfo* info = new PythonQtSlotInfo(this, m, i, decoratorProvider, isClassDeco?PythonQtSlotInfo::ClassDecorator:PythonQtSlotInfo::InstanceDecorator);
+      info->setUpcastingOffset(upcastingOffset);
+      info->setThunk(PythonQt::priv()->slotThunk(meta, i));
+      if (tail) {
+        tail->setNextInfo(info);
+      } else {
+        PythonQtMemberInfo newInfo(info);
+        memberCache.insert(QByteArray(memberName), newInfo);
+      }
+      tail = info;
+    }
+  }
+
+  tail = findDecoratorSlots(memberName, tail, found, memberCache, upcastingOffset);
+
+  // now look for slots/signals/methods on this level of the meta object
+  it = index._metaMethods.constFind(name);
+  if (it != index._metaMethods.constEnd()) {
+    for (int i : it.value()) {
+      found = true;
+      PythonQtSlotInfo* info = new PythonQtSlotInfo(this, _meta->method(i), i);
+      if (tail) {
+        tail->setNextInfo(info);
+      } else {
+        PythonQtMemberInfo newInfo(info);
+        memberCache.insert(QByteArray(memberName), newInfo);
+      }
+      tail = info;
+    }
+  }
+  return tail;
+}
+
+const PythonQtClassInfo::NameIndex& PythonQtClassInfo::nameIndex()
+{
+  if (_nameIndex._built) {
+    return _nameIndex;
+  }
+  // creating the decorator provider may add decorator slots, so do this first
   QObject* decoratorProvider = decorator();
+  _nameIndex = NameIndex();
+
   if (decoratorProvider) {
-    //qDebug()<< "looking " << decoratorProvider->metaObject()->className() << " " << memberName << " " << upcastingOffset;
     const QMetaObject* meta = decoratorProvider->metaObject();
     int numMethods = meta->methodCount();
     int startFrom = QObject::staticMetaObject.methodCount();
@@ -195,41 +278,26 @@ PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlotsFromDecoratorProvider(con
       QMetaMethod m = meta->method(i);
       if ((m.methodType() == QMetaMethod::Method ||
            m.methodType() == QMetaMethod::Slot) && m.access() == QMetaMethod::Public) {
-        
         QByteArray signature = PythonQtUtils::methodName(m);
-        bool isClassDeco = false;
         if (signature.startsWith("static_")) {
           // skip the static_classname_ part of the string
           signature = signature.mid(7 + 1 + static_cast<int>(strlen(className())));
-          isClassDeco = true;
-        } else if (signature.startsWith("new_")) {
-          isClassDeco = true;
-        } else if (signature.startsWith("delete_")) {
-          isClassDeco = true;
-        }
-        // XXX no checking is currently done if the slots have correct first argument or not...
-        
-        // check if same length and same name
-        if (signature == memberName) {
-          found = true;
-          PythonQtSlotInfo* info = new PythonQtSlotInfo(this, m, i, decoratorProvider, isClassDeco?PythonQtSlotInfo::ClassDecorator:PythonQtSlotInfo::InstanceDecorator);
-          info->setUpcastingOffset(upcastingOffset);
-          //qDebug()<< "adding " << decoratorProvider->metaObject()->className() << " " << memberName << " " << upcastingOffset;
-          if (tail) {
-            tail->setNextInfo(info);
-          } else {
-            PythonQtMemberInfo newInfo(info);
-            memberCache.insert(signature, newInfo);
-          }
-          tail = info;
         }
+        _nameIndex._decoratorMethods[signature].append(i);
       }
     }
+    addEnumValuesToIndex(meta, _nameIndex._decoratorEnumValues);
   }
 
-  tail = findDecoratorSlots(memberName, tail, found, memberCache, upcastingOffset);
+  for (int i = 0; i < _decoratorSlots.size(); i++) {
+    QByteArray signature = PythonQtUtils::methodName(*_decoratorSlots.at(i)->metaMethod());
+    if (signature.startsWith("static_")) {
+      int offset = signature.indexOf('_', 7);
+      signature = signature.mid(offset+1);
+    }
+    _nameIndex._decoratorSlots[signature].append(i);
+  }
 
-  // now look for slots/signals/methods on this level of the meta object
   if (_meta) {
     int numMethods = _meta->methodCount();
     // start from methodOffset, to only add slots which are located in this class,
@@ -242,29 +310,46 @@ PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlotsFromDecoratorProvider(con
       if (((m.methodType() == QMetaMethod::Method ||
         m.methodType() == QMetaMethod::Slot) && m.access() == QMetaMethod::Public)
         || m.methodType()==QMetaMethod::Signal) {
+        _nameIndex._metaMethods[PythonQtUtils::methodName(m)].append(i);
+      }
+    }
+    addEnumValuesToIndex(_meta, _nameIndex._metaEnumValues);
+  }
+  _nameIndex._built = true;
+  return _nameIndex;
+}
 
-          QByteArray signature = PythonQtUtils::methodName(m);
+void PythonQtClassInfo::addEnumValuesToIndex(const QMetaObject* meta, QHash<QByteArray, QPair<int,int> >& enumValues)
+{
+  int enumCount = meta->enumeratorCount();
+  for (int i=0;i<enumCount; i++) {
+    QMetaEnum e = meta->enumerator(i);
+    // we do not want flags, they will cause our values to appear two times
+    if (e.isFlag()) continue;
 
-          // check if same length and same name
-          if (signature == memberName) {
-            found = true;
-            PythonQtSlotInfo* info = new PythonQtSlotInfo(this, m, i);
-            if (tail) {
-              tail->setNextInfo(info);
-            } else {
-              PythonQtMemberInfo newInfo(info);
-              memberCache.insert(signature, newInfo);
-            }
-            tail = info;
-          }
+    for (int j=0; j < e.keyCount(); j++) {
+      QByteArray name = escapeReservedNames(e.key(j));
+      if (!enumValues.contains(name)) {
+        enumValues.insert(name, QPair<int,int>(i, j));
       }
     }
   }
-  return tail;
 }
 
 bool PythonQtClassInfo::lookForMethodAndCache(const char* memberName)
 {
+  PythonQtClassInfo* owner = findSlotChainOwner(memberName);
+  if (owner != this) {
+    // our slot chain would be identical to the one of the owner, so we share it
+    PythonQtMemberInfo info = owner->member(memberName);
+    if (info._type == PythonQtMemberInfo::Slot || info._type == PythonQtMemberInfo::Signal) {
+      _cachedMembers.insert(memberName, info);
+      _sharedSlotChains.insert(memberName, owner);
+      owner->_slotChainBorrowers.insert(this);
+      return true;
+    }
+  }
+
   bool found = false;
   PythonQtSlotInfo* tail = nullptr;
   
@@ -276,36 +361,45 @@ bool PythonQtClassInfo::lookForMethodAndCache(const char* memberName)
   return found;
 }
 
-bool PythonQtClassInfo::lookForEnumAndCache(const QMetaObject* meta, const char* memberName)
+PythonQtClassInfo* PythonQtClassInfo::findSlotChainOwner(const char* memberName)
 {
-  bool found = false;
-  // look for enum values
-  int enumCount = meta->enumeratorCount();
-  for (int i=0;i<enumCount; i++) {
-    QMetaEnum e = meta->enumerator(i);
-    // we do not want flags, they will cause our values to appear two times
-    if (e.isFlag()) continue;
-    
-    for (int j=0; j < e.keyCount(); j++) {
-      if (escapeReservedNames(e.key(j)) == memberName) {
-        PyObject* enumType = findEnumWrapper(e.name());
-        if (enumType) {
-          PythonQtObjectPtr enumValuePtr;
-          enumValuePtr.setNewRef(PythonQtPrivate::createEnumValueInstance(enumType, e.value(j)));
-          PythonQtMemberInfo newInfo(enumValuePtr);
-          _cachedMembers.insert(memberName, newInfo);
-  #ifdef PYTHONQT_DEBUG
-          std::cout << "caching enum " << memberName << " on " << meta->className() << std::endl;
-  #endif
-          found = true;
-          break;
-        } else {
-          std::cerr << "enum " << e.name() << " not found on " << className().constData() << std::endl;
-        }
-      }
+  const QByteArray name = QByteArray::fromRawData(memberName, static_cast<int>(strlen(memberName)));
+  PythonQtClassInfo* info = this;
+  while (true) {
+    const NameIndex& index = info->nameIndex();
+    if (index._decoratorMethods.contains(name) || index._decoratorSlots.contains(name) || index._metaMethods.contains(name)) {
+      return info;
+    }
+    // the slots of other parents or a different upcasting offset would change the chain
+    if (info->_parentClasses.size() != 1 || info->_parentClasses.at(0)._upcastingOffset != 0) {
+      return this;
     }
+    info = info->_parentClasses.at(0)._parent;
+  }
+}
+
+bool PythonQtClassInfo::lookForEnumAndCache(const QMetaObject* meta, const QHash<QByteArray, QPair<int,int> >& enumValues, const char* memberName)
+{
+  // look for enum values
+  QHash<QByteArray, QPair<int,int> >::const_iterator it = enumValues.constFind(QByteArray::fromRawData(memberName, static_cast<int>(strlen(memberName))));
+  if (it == enumValues.constEnd()) {
+    return false;
+  }
+  QMetaEnum e = meta->enumerator(it.value().first);
+  PyObject* enumType = findEnumWrapper(e.name());
+  if (enumType) {
+    PythonQtObjectPtr enumValuePtr;
+    enumValuePtr.setNewRef(PythonQtPrivate::createEnumValueInstance(enumType, e.value(it.value().second)));
+    PythonQtMemberInfo newInfo(enumValuePtr);
+    _cachedMembers.insert(memberName, newInfo);
+#ifdef PYTHONQT_DEBUG
+    std::cout << "caching enum " << memberName << " on " << meta->className() << std::endl;
+#endif
+    return true;
+  } else {
+    std::cerr << "enum " << e.name() << " not found on " << className().constData() << std::endl;
+    return false;
   }
-  return found;
 }
 
 PythonQtMemberInfo PythonQtClassInfo::member(const char* memberName)
@@ -323,18 +417,21 @@ PythonQtMemberInfo PythonQtClassInfo::member(const char* memberName)
     if (!found) {
       if (_meta) {
         // check enums in our meta object directly
-        found = lookForEnumAndCache(_meta, memberName);
+        found = lookForEnumAndCache(_meta, nameIndex()._metaEnumValues, memberName);
       }
       if (!found) {
         // check enums in the class hierachy of CPP classes
         // look for dynamic decorators in this class and in derived classes
-        QList<QObject*> decoObjects;
-        recursiveCollectDecoratorObjects(decoObjects);
-        Q_FOREACH(QObject* deco, decoObjects) {
-          // call on ourself for caching, but with different metaObject():
-          found = lookForEnumAndCache(deco->metaObject(), memberName);
-          if (found) {
-            break;
+        QList<PythonQtClassInfo*> classInfos;
+        recursiveCollectClassInfos(classInfos);
+        Q_FOREACH(PythonQtClassInfo* classInfo, classInfos) {
+          QObject* deco = classInfo->decorator();
+          if (deco) {
+            // call on ourself for caching, but with different metaObject():
+            found = lookForEnumAndCache(deco->metaObject(), classInfo->nameIndex()._decoratorEnumValues, memberName);
+            if (found) {
+              break;
+            }
           }
         }
       }
@@ -405,28 +502,23 @@ void PythonQtClassInfo::recursiveCollectClassInfos(QList<PythonQtClassInfo*>& cl
 
 PythonQtSlotInfo* PythonQtClassInfo::findDecoratorSlots(const char* memberName, PythonQtSlotInfo* tail, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset)
 {
-  QListIterator<PythonQtSlotInfo*> it(_decoratorSlots);
-  while (it.hasNext()) {
-
-    PythonQtSlotInfo* infoOrig = it.next();
-    QByteArray signature = PythonQtUtils::methodName(*infoOrig->metaMethod());
-    if (signature.startsWith("static_")) {
-      int offset = signature.indexOf('_', 7);
-      signature = signature.mid(offset+1);
-    }
-    if (signature == memberName) {
-      //make a copy, otherwise we will have trouble on overloads!
-      PythonQtSlotInfo* info = new PythonQtSlotInfo(*infoOrig);
-      info->setUpcastingOffset(upcastingOffset);
-      found = true;
-      if (tail) {
-        tail->setNextInfo(info);
-      } else {
-        PythonQtMemberInfo newInfo(info);
-        memberCache.insert(signature, newInfo);
-      }
-      tail = info;
+  const NameIndex& index = nameIndex();
+  QHash<QByteArray, QVector<int> >::const_iterator it = index._decoratorSlots.constFind(QByteArray::fromRawData(memberName, static_cast<int>(strlen(memberName))));
+  if (it == index._decoratorSlots.constEnd()) {
+    return tail;
+  }
+  for (int i : it.value()) {
+    //make a copy, otherwise we will have trouble on overloads!
+    PythonQtSlotInfo* info = new PythonQtSlotInfo(*_decoratorSlots.at(i));
+    info->setUpcastingOffset(upcastingOffset);
+    found = true;
+    if (tail) {
+      tail->setNextInfo(info);
+    } else {
+      PythonQtMemberInfo newInfo(info);
+      memberCache.insert(QByteArray(memberName), newInfo);
     }
+    tail = info;
   }
   return tail;
 }
@@ -580,29 +672,43 @@ void* PythonQtClassInfo::castTo(void* ptr, const char* classname)
   if (ptr==nullptr) {
     return nullptr;
   }
-  if (_wrappedClassName == classname) {
+  PythonQtClassInfo* info = findAncestor(classname);
+  return info ? castTo(ptr, info) : nullptr;
+}
+
+void* PythonQtClassInfo::castTo(void* ptr, PythonQtClassInfo* info)
+{
+  if (ptr==nullptr) {
+    return nullptr;
+  }
+  if (info == this) {
     return ptr;
   }
-  Q_FOREACH(const ParentClassInfo& info, _parentClasses) {
-    void* result = info._parent->castTo((char*)ptr + info._upcastingOffset, classname);
-    if (result) {
-      return result;
-    }
+  const QHash<PythonQtClassInfo*, int>& offsets = ancestorOffsets();
+  QHash<PythonQtClassInfo*, int>::const_iterator it = offsets.constFind(info);
+  if (it == offsets.constEnd()) {
+    return nullptr;
   }
-  return nullptr;
+  return (char*)ptr + it.value();
 }
 
-bool PythonQtClassInfo::inherits(const char* name)
+PythonQtClassInfo* PythonQtClassInfo::findAncestor(const char* classname)
 {
-  if (_wrappedClassName == name) {
-    return true;
+  if (_wrappedClassName == classname) {
+    return this;
   }
-  Q_FOREACH(const ParentClassInfo& info, _parentClasses) {
-    if (info._parent->inherits(name)) {
-      return true;
+  const QHash<PythonQtClassInfo*, int>& offsets = ancestorOffsets();
+  for (QHash<PythonQtClassInfo*, int>::const_iterator it = offsets.constBegin(); it != offsets.constEnd(); ++it) {
+    if (it.key()->_wrappedClassName == classname) {
+      return it.key();
     }
   }
-  return false;
+  return nullptr;
+}
+
+bool PythonQtClassInfo::inherits(const char* name)
+{
+  return findAncestor(name) != nullptr;
 }
 
 bool PythonQtClassInfo::inherits(PythonQtClassInfo* classInfo)
@@ -610,12 +716,29 @@ bool PythonQtClassInfo::inherits(PythonQtClassInfo* classInfo)
   if (classInfo == this) {
     return true;
   }
-  Q_FOREACH(const ParentClassInfo& info, _parentClasses) {
-    if (info._parent->inherits(classInfo)) {
-      return true;
-    }
+  return ancestorOffsets().contains(classInfo);
+}
+
+const QHash<PythonQtClassInfo*, int>& PythonQtClassInfo::ancestorOffsets()
+{
+  if (_ancestorOffsetsGeneration != _classHierarchyGeneration) {
+    _ancestorOffsets.clear();
+    addAncestorOffsets(this, 0);
+    _ancestorOffsetsGeneration = _classHierarchyGeneration;
+  }
+  return _ancestorOffsets;
+}
+
+void PythonQtClassInfo::addAncestorOffsets(PythonQtClassInfo* info, int upcastingOffset)
+{
+  if (_ancestorOffsets.contains(info)) {
+    // the first path in depth-first order wins, like in the recursive lookup
+    return;
+  }
+  _ancestorOffsets.insert(info, upcastingOffset);
+  Q_FOREACH(const ParentClassInfo& parent, info->_parentClasses) {
+    addAncestorOffsets(parent._parent, upcastingOffset + parent._upcastingOffset);
   }
-  return false;
 }
 
 QString PythonQtClassInfo::help()
@@ -728,6 +851,7 @@ void PythonQtClassInfo::addConstructor(PythonQtSlotInfo* info)
 void PythonQtClassInfo::addDecoratorSlot(PythonQtSlotInfo* info)
 {
   _decoratorSlots.append(info);
+  _nameIndex._built = false;
 }
 
 void PythonQtClassInfo::setDestructor(PythonQtSlotInfo* info)
@@ -741,7 +865,10 @@ void PythonQtClassInfo::setDestructor(PythonQtSlotInfo* info)
 void PythonQtClassInfo::setMetaObject(const QMetaObject* meta)
 {
   _meta = meta;
+  _nameIndex = NameIndex();
   clearCachedMembers();
+  _knownMissingAttributes.clear();
+  clearOperatorSlots();
 }
 
 QObject* PythonQtClassInfo::decorator()
@@ -930,6 +1057,7 @@ void PythonQtClassInfo::setDecoratorProvider( PythonQtQObjectCreatorFunctionCB*
   _decoratorProviderCB = cb;
   _decoratorProvider = nullptr;
   _enumsCreated = false;
+  _nameIndex._built = false;
 }
 
 void PythonQtClassInfo::clearNotFoundCachedMembers()
@@ -943,6 +1071,18 @@ void PythonQtClassInfo::clearNotFoundCachedMembers()
       it.remove();
     }
   }
+  _knownMissingAttributes.clear();
+  // operators that were not found may be provided by the new decorators
+  clearOperatorSlots();
+}
+
+void PythonQtClassInfo::addKnownMissingAttribute(const char* name)
+{
+  // the names come from arbitrary getattr() calls, so don't let the set grow without limit
+  if (_knownMissingAttributes.size() >= 1024) {
+    _knownMissingAttributes.clear();
+  }
+  _knownMissingAttributes.insert(QByteArray(name));
 }
 
 void PythonQtClassInfo::addNestedClass(PythonQtClassInfo* info)
@@ -1151,3 +1291,148 @@ PythonQtDynamicClassInfo::~PythonQtDynamicClassInfo()
 {
   delete _classInfo;
 }
+
+//-------------------------------------------------------------------------
+
+//! approximate size of a hash node with a key and value of the given sizes (including the next pointer and hash value)
+static qint64 PythonQtClassInfo_hashNodeSize(qint64 keySize, qint64 valueSize)
+{
+  return keySize + valueSize + sizeof(void*) + sizeof(uint);
+}
+
+static qint64 PythonQtClassInfo_slotChainMemoryUsage(const PythonQtSlotInfo* info)
+{
+  // the parameter lists are implicitly shared with the cached method infos, so they are not counted here
+  qint64 size = 0;
+  while (info) {
+    size += sizeof(PythonQtSlotInfo);
+    info = info->nextInfo();
+  }
+  return size;
+}
+
+static qint64 PythonQtClassInfo_indexMemoryUsage(const QHash<QByteArray, QVector<int> >& index)
+{
+  qint64 size = 0;
+  for (QHash<QByteArray, QVector<int> >::const_iterator it = index.constBegin(); it != index.constEnd(); ++it) {
+    size += PythonQtClassInfo_hashNodeSize(sizeof(QByteArray) + it.key().capacity(), sizeof(QVector<int>) + it.value().capacity() * sizeof(int));
+  }
+  return size;
+}
+
+static qint64 PythonQtClassInfo_indexMemoryUsage(const QHash<QByteArray, QPair<int,int> >& index)
+{
+  qint64 size = 0;
+  for (QHash<QByteArray, QPair<int,int> >::const_iterator it = index.constBegin(); it != index.constEnd(); ++it) {
+    size += PythonQtClassInfo_hashNodeSize(sizeof(QByteArray) + it.key().capacity(), sizeof(QPair<int,int>));
+  }
+  return size;
+}
+
+qint64 PythonQtClassInfo::metadataMemoryUsage() const
+{
+  qint64 size = sizeof(PythonQtClassInfo);
+  for (QHash<QByteArray, PythonQtMemberInfo>::const_iterator it = _cachedMembers.constBegin(); it != _cachedMembers.constEnd(); ++it) {
+    size += PythonQtClassInfo_hashNodeSize(sizeof(QByteArray) + it.key().capacity(), sizeof(PythonQtMemberInfo));
+    if ((it->_type == PythonQtMemberInfo::Slot || it->_type == PythonQtMemberInfo::Signal) &&
+        !_sharedSlotChains.contains(it.key())) {
+      size += PythonQtClassInfo_slotChainMemoryUsage(it->_slot);
+    }
+  }
+  // the keys are shared with _cachedMembers
+  size += _sharedSlotChains.size() * PythonQtClassInfo_hashNodeSize(sizeof(QByteArray), sizeof(void*));
+  size += _slotChainBorrowers.size() * PythonQtClassInfo_hashNodeSize(sizeof(void*), 0);
+  Q_FOREACH(const QByteArray& name, _knownMissingAttributes) {
+    size += PythonQtClassInfo_hashNodeSize(sizeof(QByteArray) + name.capacity(), 0);
+  }
+
+  size += PythonQtClassInfo_slotChainMemoryUsage(_constructors);
+  size += PythonQtClassInfo_slotChainMemoryUsage(_destructor);
+  Q_FOREACH(PythonQtSlotInfo* info, _decoratorSlots) {
+    size += sizeof(void*) + PythonQtClassInfo_slotChainMemoryUsage(info);
+  }
+
+  size += PythonQtClassInfo_indexMemoryUsage(_nameIndex._decoratorMethods);
+  size += PythonQtClassInfo_indexMemoryUsage(_nameIndex._decoratorSlots);
+  size += PythonQtClassInfo_indexMemoryUsage(_nameIndex._metaMethods);
+  size += PythonQtClassInfo_indexMemoryUsage(_nameIndex._metaEnumValues);
+  size += PythonQtClassInfo_indexMemoryUsage(_nameIndex._decoratorEnumValues);
+
+  size += _ancestorOffsets.size() * PythonQtClassInfo_hashNodeSize(sizeof(void*), sizeof(int));
+  size += _parentClasses.size() * (sizeof(void*) + sizeof(ParentClassInfo));
+  size += _wrappedClassName.capacity();
+  return size;
+}
+
+//! returns true if a wrapped object can never be converted strictly to the given parameter
+static bool PythonQtClassInfo_rejectsWrappedObjects(const PythonQtMethodInfo::ParameterInfo& param)
+{
+  if (param.pointerCount != 0) {
+    return false;
+  }
+  switch (param.typeId) {
+  case QMetaType::Bool:
+  case QMetaType::Int:
+  case QMetaType::UInt:
+  case QMetaType::Long:
+  case QMetaType::ULong:
+  case QMetaType::LongLong:
+  case QMetaType::ULongLong:
+  case QMetaType::Short:
+  case QMetaType::UShort:
+  case QMetaType::Char:
+  case QMetaType::SChar:
+  case QMetaType::UChar:
+  case QMetaType::Float:
+  case QMetaType::Double:
+  case QMetaType::QString:
+    return true;
+  default:
+    return false;
+  }
+}
+
+void PythonQtClassInfo::resolveOperatorSlot(Operator op)
+{
+  static const char* operatorNames[Op_Count] = {
+    "__add__", "__sub__", "__mul__", "__div__", "__and__", "__or__", "__xor__", "__mod__", "__lshift__", "__rshift__",
+    "__iadd__", "__isub__", "__imul__", "__idiv__", "__iand__", "__ior__",
+    "__ixor__", "__imod__", "__ilshift__", "__irshift__",
+    "__lt__", "__le__", "__eq__", "__ne__", "__gt__", "__ge__",
+    "__getitem__", "__setitem__", "__delitem__", "__len__", "__invert__", "__nonzero__"
+  };
+  OperatorSlot& entry = _operatorSlots[op];
+  entry._resolved = true;
+  entry._slot = nullptr;
+  entry._sameTypeOverload = nullptr;
+
+  PythonQtMemberInfo info = member(operatorNames[op]);
+  if (info._type != PythonQtMemberInfo::Slot) {
+    return;
+  }
+  entry._slot = info._slot;
+
+  // The normal overload resolution tries a strict conversion on all overloads in order,
+  // so an overload for this class is only chosen directly if no earlier overload can accept the object.
+  for (PythonQtSlotInfo* slot = info._slot; slot; slot = slot->nextInfo()) {
+    int argumentIndex = slot->isInstanceDecorator() ? 2 : 1;
+    if (slot->parameterCount() != argumentIndex + 1) {
+      continue;
+    }
+    const PythonQtMethodInfo::ParameterInfo& param = slot->parameters().at(argumentIndex);
+    if (param.pointerCount <= 1 && param.name == _wrappedClassName) {
+      entry._sameTypeOverload = slot;
+      break;
+    }
+    if (!PythonQtClassInfo_rejectsWrappedObjects(param)) {
+      break;
+    }
+  }
+}
+
+void PythonQtClassInfo::clearOperatorSlots()
+{
+  for (int i = 0; i < Op_Count; i++) {
+    _operatorSlots[i] = OperatorSlot();
+  }
+}
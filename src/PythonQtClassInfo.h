@@ -40,17 +40,66 @@
 #include <QHash>
 #include <QByteArray>
 #include <QList>
+#include <QVector>
+#include <QPair>
 
 class PythonQtSlotInfo;
 class PythonQtClassInfo;
+class PythonQtMethodInfo;
+
+//! cached dispatch data of a Python implemented slot of a dynamic meta object
+struct PythonQtDynamicSlotEntry
+{
+  PythonQtDynamicSlotEntry():_methodInfo(nullptr),_functionType(nullptr),_functionTypeVersion(0) {}
+
+  //! the interned name of the Python method
+  PythonQtObjectPtr _name;
+  //! the (globally cached) method info of the slot
+  const PythonQtMethodInfo* _methodInfo;
+
+  //! the Python function that was found for _name on _functionType, it is only valid as long as
+  //! the version tag of _functionType is _functionTypeVersion (Python changes the tag when the class
+  //! or one of its bases is modified)
+  mutable PythonQtObjectPtr _function;
+  mutable PyTypeObject* _functionType;
+  mutable unsigned int _functionTypeVersion;
+};
 
 struct PythonQtDynamicClassInfo
 {
-  PythonQtDynamicClassInfo() { _dynamicMetaObject = nullptr; _classInfo = nullptr; }
+  PythonQtDynamicClassInfo() { _dynamicMetaObject = nullptr; _classInfo = nullptr; _slotOffset = 0; _propertyOffset = 0; }
   ~PythonQtDynamicClassInfo();
 
+  //! get the cached slot entry for the given absolute method index, returns nullptr if there is none
+  //! (e.g. for signals or methods of the C++ base class)
+  const PythonQtDynamicSlotEntry* slotEntry(int methodIndex) const {
+    int idx = methodIndex - _slotOffset;
+    if (idx >= 0 && idx < _slots.size() && _slots.at(idx)._methodInfo) {
+      return &_slots.at(idx);
+    }
+    return nullptr;
+  }
+
+  //! get the cached PythonQtProperty object for the given absolute property index, returns nullptr if there is none
+  PyObject* property(int propertyIndex) const {
+    int idx = propertyIndex - _propertyOffset;
+    if (idx >= 0 && idx < _properties.size()) {
+      return _properties.at(idx).object();
+    }
+    return nullptr;
+  }
+
   const QMetaObject* _dynamicMetaObject;
   PythonQtClassInfo* _classInfo;
+
+  //! absolute method index of the first entry in _slots
+  int _slotOffset;
+  //! absolute property index of the first entry in _properties
+  int _propertyOffset;
+  //! slot dispatch table of this class and all dynamic base classes, indexed by method index - _slotOffset
+  QVector<PythonQtDynamicSlotEntry> _slots;
+  //! PythonQtProperty objects of this class and all dynamic base classes, indexed by property index - _propertyOffset
+  QVector<PythonQtObjectPtr> _properties;
 };
 
 struct PythonQtMemberInfo {
@@ -108,6 +157,35 @@ public:
   //! get the Python method definition for a given slot name (without return type and signature)
   PythonQtMemberInfo member(const char* member);
 
+  //! operators that are called via the number, mapping and compare protocols of the class wrapper
+  enum Operator {
+    Op_Add, Op_Sub, Op_Mul, Op_Div, Op_And, Op_Or, Op_Xor, Op_Mod, Op_LShift, Op_RShift,
+    Op_InplaceAdd, Op_InplaceSub, Op_InplaceMul, Op_InplaceDiv, Op_InplaceAnd, Op_InplaceOr,
+    Op_InplaceXor, Op_InplaceMod, Op_InplaceLShift, Op_InplaceRShift,
+    Op_Lt, Op_Le, Op_Eq, Op_Ne, Op_Gt, Op_Ge,
+    Op_GetItem, Op_SetItem, Op_DelItem, Op_Len, Op_Invert, Op_NonZero,
+    Op_Count
+  };
+
+  //! an operator slot that is looked up only once
+  struct OperatorSlot {
+    OperatorSlot():_slot(nullptr),_sameTypeOverload(nullptr),_resolved(false) {}
+
+    //! the slot (with all overloads) or NULL if the class has no such operator
+    PythonQtSlotInfo* _slot;
+    //! the overload that is chosen for an argument of this class, NULL if that needs the normal overload resolution
+    PythonQtSlotInfo* _sameTypeOverload;
+    bool _resolved;
+  };
+
+  //! get the operator slot, the member is looked up on first use and when decorators were added
+  const OperatorSlot& operatorSlot(Operator op) {
+    if (!_operatorSlots[op]._resolved) {
+      resolveOperatorSlot(op);
+    }
+    return _operatorSlots[op];
+  }
+
   //! get access to the constructor slot (which may be overloaded if there are multiple constructors)
   PythonQtSlotInfo* constructors();
 
@@ -155,6 +233,13 @@ public:
   //! (if the cast is not possible or if ptr is NULL, NULL is returned)
   void* castTo(void* ptr, const char* classname);
 
+  //! casts the given \c ptr to an object of the class \c info, using the flattened ancestor table
+  //! (if this class does not inherit from \c info or if ptr is NULL, NULL is returned)
+  void* castTo(void* ptr, PythonQtClassInfo* info);
+
+  //! returns the class info of this class or of the ancestor with the given classname (or NULL)
+  PythonQtClassInfo* findAncestor(const char* classname);
+
   //! get help string for the metaobject
   QString help();
 
@@ -174,7 +259,7 @@ public:
   QObject* decorator();
 
   //! add the parent class info of a CPP object
-  void addParentClass(const ParentClassInfo& info) { _parentClasses.append(info); }
+  void addParentClass(const ParentClassInfo& info) { _parentClasses.append(info); _classHierarchyGeneration++; }
 
   //! set the associated PythonQtClassWrapper (which handles instance creation of this type)
   void setPythonQtClassWrapper(PyObject* obj) { _pythonQtClassWrapper = obj; }
@@ -204,6 +289,22 @@ public:
   //! clear all members that where cached as "NotFound"
   void clearNotFoundCachedMembers();
 
+  //! returns the approximate number of bytes held by the cached members, slot infos and lookup tables of this class,
+  //! slot chains that are shared with subclasses are only counted for the class that owns them
+  qint64 metadataMemoryUsage() const;
+
+  //! returns the number of cached member lookups (including "NotFound" entries)
+  int cachedMemberCount() const { return _cachedMembers.size(); }
+
+  //! returns if the attribute is known to be missing on the C++ side of this class, i.e. it is no member,
+  //! has no py_get_ getter, is no internal method and the class has no py_dynamic_get_attrib slot
+  bool isKnownMissingAttribute(const char* name) const {
+    return _knownMissingAttributes.contains(QByteArray::fromRawData(name, qstrlen(name)));
+  }
+
+  //! remember that the given attribute is missing on the C++ side of this class
+  void addKnownMissingAttribute(const char* name);
+
   //! get nested classes
   const QList<PythonQtClassInfo*>& nestedClasses() { return _nestedClasses; }
 
@@ -245,8 +346,33 @@ public:
   static void addGlobalNamespaceWrapper(PythonQtClassInfo* namespaceWrapper);
 
 private:
+  //! index of the method and enum value names of this class level, built on the first member lookup
+  struct NameIndex {
+    NameIndex():_built(false) {}
+
+    //! method indices of the decorator provider by member name (without the static_classname_ prefix)
+    QHash<QByteArray, QVector<int> >    _decoratorMethods;
+    //! indices into _decoratorSlots by member name
+    QHash<QByteArray, QVector<int> >    _decoratorSlots;
+    //! method indices of the meta object of this level by name
+    QHash<QByteArray, QVector<int> >    _metaMethods;
+    //! enumerator and key index of the enum values of the meta object by (escaped) name
+    QHash<QByteArray, QPair<int,int> >  _metaEnumValues;
+    //! enumerator and key index of the enum values of the decorator provider by (escaped) name
+    QHash<QByteArray, QPair<int,int> >  _decoratorEnumValues;
+    bool _built;
+  };
+
+  //! get the name index of this class level, builds it if needed
+  const NameIndex& nameIndex();
+  //! adds the enum values of all (non-flag) enumerators of meta to the index
+  static void addEnumValuesToIndex(const QMetaObject* meta, QHash<QByteArray, QPair<int,int> >& enumValues);
+
   void updateRefCountingCBs();
 
+  void resolveOperatorSlot(Operator op);
+  void clearOperatorSlots();
+
   void createEnumWrappers(const QObject* decoratorProvider);
   void createEnumWrappers(const QMetaObject* meta);
   PyObject* findEnumWrapper(const char* name);
@@ -256,6 +382,13 @@ private:
 
   void* recursiveCastDownIfPossible(void* ptr, const char** resultClassName);
 
+  //! returns the table of this class and all its ancestors with their cumulative upcasting offsets,
+  //! it is rebuilt when a parent class was added to any class since it was built
+  const QHash<PythonQtClassInfo*, int>& ancestorOffsets();
+
+  //! adds \c info and its ancestors to the ancestor table
+  void addAncestorOffsets(PythonQtClassInfo* info, int upcastingOffset);
+
   PythonQtSlotInfo* findDecoratorSlotsFromDecoratorProvider(const char* memberName, PythonQtSlotInfo* inputInfo, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset);
   void listDecoratorSlotsFromDecoratorProvider(QStringList& list, bool metaOnly);
   PythonQtSlotInfo* recursiveFindDecoratorSlotsFromDecoratorProvider(const char* memberName, PythonQtSlotInfo* inputInfo, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset);
@@ -265,13 +398,31 @@ private:
 
   bool lookForPropertyAndCache(const char* memberName);
   bool lookForMethodAndCache(const char* memberName);
-  bool lookForEnumAndCache(const QMetaObject* m, const char* memberName);
+
+  //! returns the ancestor whose slot chain for \c memberName is identical to the one of this class
+  //! (the first class defining the member along single inheritance without upcasting offset), or this class
+  PythonQtClassInfo* findSlotChainOwner(const char* memberName);
+  //! removes the cached members that share the slot chains of \c owner
+  void forgetSharedSlotChains(PythonQtClassInfo* owner);
+  bool lookForEnumAndCache(const QMetaObject* m, const QHash<QByteArray, QPair<int,int> >& enumValues, const char* memberName);
 
   PythonQtSlotInfo* findDecoratorSlots(const char* memberName, PythonQtSlotInfo* tail, bool &found, QHash<QByteArray, PythonQtMemberInfo>& memberCache, int upcastingOffset);
   int findCharOffset(const char* sigStart, char someChar);
 
   QHash<QByteArray, PythonQtMemberInfo> _cachedMembers;
 
+  NameIndex                             _nameIndex;
+
+  //! cached members whose slot chain is owned by the given ancestor
+  QHash<QByteArray, PythonQtClassInfo*> _sharedSlotChains;
+  //! subclasses that share slot chains of this class
+  QSet<PythonQtClassInfo*>              _slotChainBorrowers;
+
+  //! attribute names that were not found on the C++ side (see isKnownMissingAttribute())
+  QSet<QByteArray>                      _knownMissingAttributes;
+
+  OperatorSlot                          _operatorSlots[Op_Count];
+
   PythonQtSlotInfo*                    _constructors;
   PythonQtSlotInfo*                    _destructor;
 
@@ -287,6 +438,9 @@ private:
   QByteArray                           _wrappedClassName;
   QList<ParentClassInfo>               _parentClasses;
 
+  QHash<PythonQtClassInfo*, int>       _ancestorOffsets;
+  int                                  _ancestorOffsetsGeneration;
+
   QList<PythonQtPolymorphicHandlerCB*> _polymorphicHandlers;
 
   QList<PythonQtClassInfo*>            _nestedClasses;
@@ -310,6 +464,9 @@ private:
   static QList<PythonQtClassInfo*>     _globalNamespaceWrappers;
 
   static QSet<QByteArray>              _reservedNames;
+
+  //! incremented whenever a parent class is added, invalidates all ancestor tables
+  static int                           _classHierarchyGeneration;
 };
 
 //---------------------------------------------------------------
@@ -49,47 +49,37 @@
 #include "PythonQtConversion.h"
 #include "PythonQtInstanceWrapper.h"
 
-static PyObject* PythonQtInstanceWrapper_invert(PythonQtInstanceWrapper* wrapper)
+static PyObject* PythonQtInstanceWrapper_callUnaryOperator(PythonQtInstanceWrapper* wrapper, PythonQtClassInfo::Operator op)
 {
-  PyObject* result = nullptr;
-  static QByteArray memberName = "__invert__";
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
-    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, nullptr, nullptr, wrapper->_wrappedPtr);
+  PythonQtSlotInfo* slot = wrapper->classInfo()->operatorSlot(op)._slot;
+  if (slot) {
+    return PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, slot, nullptr, nullptr, wrapper->_wrappedPtr);
   }
-  return result;
+  return nullptr;
+}
+
+static PyObject* PythonQtInstanceWrapper_invert(PythonQtInstanceWrapper* wrapper)
+{
+  return PythonQtInstanceWrapper_callUnaryOperator(wrapper, PythonQtClassInfo::Op_Invert);
 }
 
 static PyObject* PythonQtInstanceWrapper_negative(PythonQtInstanceWrapper* wrapper)
 {
-  PyObject* result = nullptr;
-  static QByteArray memberName = "__sub__";
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
-    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, nullptr, nullptr, wrapper->_wrappedPtr);
-  }
-  return result;
+  return PythonQtInstanceWrapper_callUnaryOperator(wrapper, PythonQtClassInfo::Op_Sub);
 }
 
 static PyObject* PythonQtInstanceWrapper_positive(PythonQtInstanceWrapper* wrapper)
 {
-  PyObject* result = nullptr;
-  static QByteArray memberName = "__add__";
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
-    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, nullptr, nullptr, wrapper->_wrappedPtr);
-  }
-  return result;
+  return PythonQtInstanceWrapper_callUnaryOperator(wrapper, PythonQtClassInfo::Op_Add);
 }
 
 static int PythonQtInstanceWrapper_nonzero(PythonQtInstanceWrapper* wrapper)
 {
   int result = (wrapper->_wrappedPtr == nullptr && wrapper->_obj == nullptr)?0:1;
   if (result) {
-    static QByteArray memberName = "__nonzero__";
-    PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-    if (opSlot._type == PythonQtMemberInfo::Slot) {
-      PyObject* resultObj = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, nullptr, nullptr, wrapper->_wrappedPtr);
+    PythonQtSlotInfo* slot = wrapper->classInfo()->operatorSlot(PythonQtClassInfo::Op_NonZero)._slot;
+    if (slot) {
+      PyObject* resultObj = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, slot, nullptr, nullptr, wrapper->_wrappedPtr);
       if (resultObj == Py_False) {
         result = 0;
       }
@@ -103,10 +93,9 @@ static Py_ssize_t PythonQtInstanceWrapper_length(PythonQtInstanceWrapper* wrappe
 {
   qint64 result = -1;
   if (wrapper->_wrappedPtr != nullptr || wrapper->_obj != nullptr) {
-    static QByteArray memberName = "__len__";
-    PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-    if (opSlot._type == PythonQtMemberInfo::Slot) {
-      PyObject* resultObj = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, nullptr, nullptr, wrapper->_wrappedPtr);
+    PythonQtSlotInfo* slot = wrapper->classInfo()->operatorSlot(PythonQtClassInfo::Op_Len)._slot;
+    if (slot) {
+      PyObject* resultObj = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, slot, nullptr, nullptr, wrapper->_wrappedPtr);
       bool ok;
       result = PythonQtConv::PyObjGetLongLong(resultObj, false, ok);
       if (!ok) {
@@ -122,11 +111,9 @@ static int PythonQtInstanceWrapper_setitem(PyObject* self, PyObject* index, PyOb
 {
   PythonQtInstanceWrapper* wrapper = (PythonQtInstanceWrapper*)self;
   bool isSetItem = value;
-  PythonQtMemberInfo opSlot = isSetItem ?
-        wrapper->classInfo()->member("__setitem__")
-        : wrapper->classInfo()->member("__delitem__");
+  PythonQtSlotInfo* slot = wrapper->classInfo()->operatorSlot(isSetItem ? PythonQtClassInfo::Op_SetItem : PythonQtClassInfo::Op_DelItem)._slot;
 
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
+  if (slot) {
     PyObject* args = PyTuple_New(isSetItem?2:1);
     Py_INCREF(index);
     PyTuple_SET_ITEM(args, 0, index);
@@ -134,7 +121,7 @@ static int PythonQtInstanceWrapper_setitem(PyObject* self, PyObject* index, PyOb
       Py_INCREF(value);
       PyTuple_SET_ITEM(args, 1, value);
     }
-    PyObject* result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, args, nullptr, wrapper->_wrappedPtr);
+    PyObject* result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, slot, args, nullptr, wrapper->_wrappedPtr);
     if (result) {
       Py_DECREF(result);
     }
@@ -145,28 +132,29 @@ static int PythonQtInstanceWrapper_setitem(PyObject* self, PyObject* index, PyOb
   }
 }
 
-static PyObject* PythonQtInstanceWrapper_binaryfunc(PyObject* self, PyObject* other, const QByteArray& opName, const QByteArray& fallbackOpName = QByteArray())
+static PyObject* PythonQtInstanceWrapper_binaryfunc(PyObject* self, PyObject* other, PythonQtClassInfo::Operator op, const char* opName, PythonQtClassInfo::Operator fallbackOp = PythonQtClassInfo::Op_Count)
 {
   // since we disabled type checking, we can receive any object as self, but we currently only support
   // different objects on the right. Otherwise we would need to generate __radd__ etc. methods.
   if (!PyObject_TypeCheck(self, &PythonQtInstanceWrapper_Type)) {
-    QString error = "Unsupported operation " + opName + "(" + self->ob_type->tp_name + ", " +  other->ob_type->tp_name + ")";
+    QString error = QString("Unsupported operation ") + opName + "(" + self->ob_type->tp_name + ", " +  other->ob_type->tp_name + ")";
     PyErr_SetString(PyExc_ArithmeticError, QStringToPythonCharPointer(error));
     return nullptr;
   }
   PythonQtInstanceWrapper* wrapper = (PythonQtInstanceWrapper*)self;
   PyObject* result = nullptr;
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(opName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
+  const PythonQtClassInfo::OperatorSlot& opSlot = wrapper->classInfo()->operatorSlot(op);
+  if (opSlot._slot) {
     PyObject* args = PyTuple_New(1);
     Py_INCREF(other);
     PyTuple_SET_ITEM(args, 0, other);
-    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, args, nullptr, wrapper->_wrappedPtr);
+    result = PythonQtInstanceWrapper_callOperator(wrapper, opSlot._slot, opSlot._sameTypeOverload, args);
     Py_DECREF(args);
-    if (!result && !fallbackOpName.isEmpty()) {
-      // try fallback if we did not get a result
-      result = PythonQtInstanceWrapper_binaryfunc(self, other, fallbackOpName);
-    }
+  }
+  if (!result && fallbackOp != PythonQtClassInfo::Op_Count) {
+    // try the binary operator if there is no in-place operator or if it did not accept the argument
+    PyErr_Clear();
+    result = PythonQtInstanceWrapper_binaryfunc(self, other, fallbackOp, opName);
   }
   return result;
 }
@@ -183,53 +171,50 @@ static PyObject* PythonQtInstanceWrapper_mul(PyObject* self, PyObject* other)
   }
   PythonQtInstanceWrapper* wrapper = (PythonQtInstanceWrapper*)self;
   PyObject* result = nullptr;
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member("__mul__");
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
+  const PythonQtClassInfo::OperatorSlot& opSlot = wrapper->classInfo()->operatorSlot(PythonQtClassInfo::Op_Mul);
+  if (opSlot._slot) {
     PyObject* args = PyTuple_New(1);
     Py_INCREF(other);
     PyTuple_SET_ITEM(args, 0, other);
-    result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, args, nullptr, wrapper->_wrappedPtr);
+    result = PythonQtInstanceWrapper_callOperator(wrapper, opSlot._slot, opSlot._sameTypeOverload, args);
     Py_DECREF(args);
   }
   return result;
 }
 
-#define BINARY_OP(NAME) \
+#define BINARY_OP(NAME, OP) \
 static PyObject* PythonQtInstanceWrapper_ ## NAME(PyObject* self, PyObject* other) \
 { \
-  static const QByteArray opName("__" #NAME "__"); \
-  return PythonQtInstanceWrapper_binaryfunc(self, other, opName); \
+  return PythonQtInstanceWrapper_binaryfunc(self, other, PythonQtClassInfo::OP, "__" #NAME "__"); \
 }
 
-#define BINARY_OP_INPLACE(NAME) \
+#define BINARY_OP_INPLACE(NAME, OP) \
   static PyObject* PythonQtInstanceWrapper_i ## NAME(PyObject* self, PyObject* other) \
 { \
-  static const QByteArray opName("__i" #NAME "__"); \
-  static const QByteArray fallbackName("__" #NAME "__"); \
-  return PythonQtInstanceWrapper_binaryfunc(self, other, opName, fallbackName); \
+  return PythonQtInstanceWrapper_binaryfunc(self, other, PythonQtClassInfo::Op_Inplace ## OP, "__i" #NAME "__", PythonQtClassInfo::Op_ ## OP); \
 }
 
-BINARY_OP(add)
-BINARY_OP(sub)
-BINARY_OP(div)
-BINARY_OP(and)
-BINARY_OP(or)
-BINARY_OP(xor)
-BINARY_OP(mod)
-BINARY_OP(lshift)
-BINARY_OP(rshift)
-BINARY_OP(getitem)
-
-BINARY_OP_INPLACE(add)
-BINARY_OP_INPLACE(sub)
-BINARY_OP_INPLACE(mul)
-BINARY_OP_INPLACE(div)
-BINARY_OP_INPLACE(and)
-BINARY_OP_INPLACE(or)
-BINARY_OP_INPLACE(xor)
-BINARY_OP_INPLACE(mod)
-BINARY_OP_INPLACE(lshift)
-BINARY_OP_INPLACE(rshift)
+BINARY_OP(add, Op_Add)
+BINARY_OP(sub, Op_Sub)
+BINARY_OP(div, Op_Div)
+BINARY_OP(and, Op_And)
+BINARY_OP(or, Op_Or)
+BINARY_OP(xor, Op_Xor)
+BINARY_OP(mod, Op_Mod)
+BINARY_OP(lshift, Op_LShift)
+BINARY_OP(rshift, Op_RShift)
+BINARY_OP(getitem, Op_GetItem)
+
+BINARY_OP_INPLACE(add, Add)
+BINARY_OP_INPLACE(sub, Sub)
+BINARY_OP_INPLACE(mul, Mul)
+BINARY_OP_INPLACE(div, Div)
+BINARY_OP_INPLACE(and, And)
+BINARY_OP_INPLACE(or, Or)
+BINARY_OP_INPLACE(xor, Xor)
+BINARY_OP_INPLACE(mod, Mod)
+BINARY_OP_INPLACE(lshift, LShift)
+BINARY_OP_INPLACE(rshift, RShift)
 
 static void initializeSlots(PythonQtClassWrapper* wrap)
 {
@@ -0,0 +1,513 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtContainerView.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtContainerView.h"
+#include "PythonQt.h"
+#include "PythonQtConversion.h"
+#include "PythonQtClassInfo.h"
+
+#include <QPointer>
+
+namespace {
+
+class PythonQtVariantListViewSource : public PythonQtSequenceViewSource
+{
+public:
+  PythonQtVariantListViewSource(const QVariantList& list):_list(list) {}
+
+  Py_ssize_t size() const override { return _list.size(); }
+  PyObject* item(Py_ssize_t index) const override { return PythonQtConv::QVariantToPyObject(_list.at(index)); }
+  QVariant toVariant() const override { return _list; }
+
+private:
+  QVariantList _list;
+};
+
+//! the items are guarded, an item that is deleted after the view was created is returned as None
+class PythonQtObjectListViewSource : public PythonQtSequenceViewSource
+{
+public:
+  PythonQtObjectListViewSource(const QList<void*>& list, const QByteArray& className):_className(className) {
+    _list.reserve(list.size());
+    Q_FOREACH(void* item, list) {
+      _list << QPointer<QObject>((QObject*)item);
+    }
+  }
+
+  Py_ssize_t size() const override { return _list.size(); }
+  PyObject* item(Py_ssize_t index) const override {
+    // wrapPtr() returns None for deleted items
+    PyObject* wrap = PythonQt::priv()->wrapPtr(_list.at(index).data(), _className);
+    if (!wrap) {
+      Py_INCREF(Py_None);
+      wrap = Py_None;
+    }
+    return wrap;
+  }
+
+private:
+  QList<QPointer<QObject> > _list;
+  QByteArray _className;
+};
+
+template <typename Map>
+class PythonQtVariantMapViewSource : public PythonQtMappingViewSource
+{
+public:
+  PythonQtVariantMapViewSource(const Map& map):_map(map) {}
+
+  Py_ssize_t size() const override { return _map.size(); }
+  QStringList keys() const override { return _map.keys(); }
+  bool contains(const QString& key) const override { return _map.contains(key); }
+  PyObject* value(const QString& key) const override { return PythonQtConv::QVariantToPyObject(_map.value(key)); }
+  QVariant toVariant() const override { return _map; }
+
+private:
+  Map _map;
+};
+
+}
+
+//-----------------------------------------------------------------------------------
+
+PyObject* PythonQtSequenceView_New(PythonQtSequenceViewSource* source)
+{
+  PythonQtSequenceViewObject* view = PyObject_New(PythonQtSequenceViewObject, &PythonQtSequenceView_Type);
+  if (!view) {
+    delete source;
+    return nullptr;
+  }
+  view->_source = source;
+  return (PyObject*)view;
+}
+
+PyObject* PythonQtSequenceView_FromVariantList(const QVariantList& list)
+{
+  return PythonQtSequenceView_New(new PythonQtVariantListViewSource(list));
+}
+
+PyObject* PythonQtSequenceView_FromPointerList(const QList<void*>& list, const QByteArray& className)
+{
+  // only QObjects can be guarded against their deletion
+  PythonQtClassInfo* info = PythonQt::priv()->getClassInfo(className);
+  if (!info || !info->isQObject()) {
+    return nullptr;
+  }
+  return PythonQtSequenceView_New(new PythonQtObjectListViewSource(list, className));
+}
+
+static void PythonQtSequenceView_dealloc(PythonQtSequenceViewObject* self)
+{
+  delete self->_source;
+  self->_source = nullptr;
+  PyObject_Del(self);
+}
+
+static PyObject* PythonQtSequenceView_toTuple(PythonQtSequenceViewObject* self, PyObject* /*args*/ = nullptr)
+{
+  Py_ssize_t count = self->_source->size();
+  PyObject* result = PyTuple_New(count);
+  for (Py_ssize_t i = 0; i < count; i++) {
+    PyTuple_SET_ITEM(result, i, self->_source->item(i));
+  }
+  return result;
+}
+
+static PyObject* PythonQtSequenceView_toList(PythonQtSequenceViewObject* self, PyObject* /*args*/)
+{
+  Py_ssize_t count = self->_source->size();
+  PyObject* result = PyList_New(count);
+  for (Py_ssize_t i = 0; i < count; i++) {
+    PyList_SET_ITEM(result, i, self->_source->item(i));
+  }
+  return result;
+}
+
+static Py_ssize_t PythonQtSequenceView_length(PythonQtSequenceViewObject* self)
+{
+  return self->_source->size();
+}
+
+static PyObject* PythonQtSequenceView_item(PythonQtSequenceViewObject* self, Py_ssize_t index)
+{
+  if (index < 0 || index >= self->_source->size()) {
+    PyErr_SetString(PyExc_IndexError, "index out of range");
+    return nullptr;
+  }
+  return self->_source->item(index);
+}
+
+static PyObject* PythonQtSequenceView_subscript(PythonQtSequenceViewObject* self, PyObject* key)
+{
+  if (PyIndex_Check(key)) {
+    Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+    if (index == -1 && PyErr_Occurred()) {
+      return nullptr;
+    }
+    if (index < 0) {
+      index += self->_source->size();
+    }
+    return PythonQtSequenceView_item(self, index);
+  } else if (PySlice_Check(key)) {
+    Py_ssize_t start, stop, step, sliceLength;
+#ifdef PY3K
+    if (PySlice_GetIndicesEx(key, self->_source->size(), &start, &stop, &step, &sliceLength) < 0) {
+#else
+    if (PySlice_GetIndicesEx((PySliceObject*)key, self->_source->size(), &start, &stop, &step, &sliceLength) < 0) {
+#endif
+      return nullptr;
+    }
+    PyObject* result = PyTuple_New(sliceLength);
+    for (Py_ssize_t i = 0; i < sliceLength; i++, start += step) {
+      PyTuple_SET_ITEM(result, i, self->_source->item(start));
+    }
+    return result;
+  }
+  PyErr_Format(PyExc_TypeError, "indices must be integers or slices, not %.200s", Py_TYPE(key)->tp_name);
+  return nullptr;
+}
+
+static PyObject* PythonQtSequenceView_richcompare(PythonQtSequenceViewObject* self, PyObject* other, int op)
+{
+  if (op != Py_EQ && op != Py_NE) {
+    Py_INCREF(Py_NotImplemented);
+    return Py_NotImplemented;
+  }
+  // compare like the tuple we would have returned without views
+  PythonQtObjectPtr tuple;
+  tuple.setNewRef(PythonQtSequenceView_toTuple(self));
+  PythonQtObjectPtr otherTuple;
+  if (PythonQtSequenceView_Check(other)) {
+    otherTuple.setNewRef(PythonQtSequenceView_toTuple((PythonQtSequenceViewObject*)other));
+    other = otherTuple;
+  }
+  return PyObject_RichCompare(tuple, other, op);
+}
+
+static PyObject* PythonQtSequenceView_repr(PythonQtSequenceViewObject* self)
+{
+  PythonQtObjectPtr tuple;
+  tuple.setNewRef(PythonQtSequenceView_toTuple(self));
+  QString repr = "SequenceView(" + PythonQtConv::PyObjGetRepresentation(tuple) + ")";
+  return PythonQtConv::QStringToPyObject(repr);
+}
+
+static PyMethodDef PythonQtSequenceView_methods[] = {
+  {"toTuple", (PyCFunction)PythonQtSequenceView_toTuple, METH_NOARGS,
+  "Converts all items and returns them as a tuple"
+  },
+  {"toList", (PyCFunction)PythonQtSequenceView_toList, METH_NOARGS,
+  "Converts all items and returns them as a list"
+  },
+  {nullptr, nullptr, 0 , nullptr}  /* Sentinel */
+};
+
+static PySequenceMethods PythonQtSequenceView_as_sequence = {
+  (lenfunc)PythonQtSequenceView_length,      /* sq_length */
+  nullptr,                                   /* sq_concat */
+  nullptr,                                   /* sq_repeat */
+  (ssizeargfunc)PythonQtSequenceView_item,   /* sq_item */
+};
+
+static PyMappingMethods PythonQtSequenceView_as_mapping = {
+  (lenfunc)PythonQtSequenceView_length,         /* mp_length */
+  (binaryfunc)PythonQtSequenceView_subscript,   /* mp_subscript */
+  nullptr,                                      /* mp_ass_subscript */
+};
+
+PyTypeObject PythonQtSequenceView_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "SequenceView",
+    sizeof(PythonQtSequenceViewObject),
+    0,
+    (destructor)PythonQtSequenceView_dealloc,  /* tp_dealloc */
+    0,            /* tp_vectorcall_offset */
+    nullptr,      /* tp_getattr */
+    nullptr,      /* tp_setattr */
+    nullptr,
+    (reprfunc)PythonQtSequenceView_repr,       /* tp_repr */
+    nullptr,      /* tp_as_number */
+    &PythonQtSequenceView_as_sequence,         /* tp_as_sequence */
+    &PythonQtSequenceView_as_mapping,          /* tp_as_mapping */
+    PyObject_HashNotImplemented,               /* tp_hash */
+    nullptr,      /* tp_call */
+    nullptr,      /* tp_str */
+    nullptr,      /* tp_getattro */
+    nullptr,      /* tp_setattro */
+    nullptr,      /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,/* tp_flags */
+    "Read-only sequence that converts the items of a C++ container on access",     /* tp_doc */
+    nullptr,      /* tp_traverse */
+    nullptr,      /* tp_clear */
+    (richcmpfunc)PythonQtSequenceView_richcompare, /* tp_richcompare */
+    0,            /* tp_weaklistoffset */
+    nullptr,      /* tp_iter */
+    nullptr,      /* tp_iternext */
+    PythonQtSequenceView_methods,              /* tp_methods */
+};
+
+//-----------------------------------------------------------------------------------
+
+PyObject* PythonQtMappingView_New(PythonQtMappingViewSource* source)
+{
+  PythonQtMappingViewObject* view = PyObject_New(PythonQtMappingViewObject, &PythonQtMappingView_Type);
+  if (!view) {
+    delete source;
+    return nullptr;
+  }
+  view->_source = source;
+  view->_keys = nullptr;
+  return (PyObject*)view;
+}
+
+PyObject* PythonQtMappingView_FromVariantMap(const QVariantMap& map)
+{
+  return PythonQtMappingView_New(new PythonQtVariantMapViewSource<QVariantMap>(map));
+}
+
+PyObject* PythonQtMappingView_FromVariantHash(const QVariantHash& hash)
+{
+  return PythonQtMappingView_New(new PythonQtVariantMapViewSource<QVariantHash>(hash));
+}
+
+static void PythonQtMappingView_dealloc(PythonQtMappingViewObject* self)
+{
+  delete self->_source;
+  self->_source = nullptr;
+  Py_XDECREF(self->_keys);
+  PyObject_Del(self);
+}
+
+//! returns the (borrowed) list of keys
+static PyObject* PythonQtMappingView_keyList(PythonQtMappingViewObject* self)
+{
+  if (!self->_keys) {
+    self->_keys = PythonQtConv::QStringListToPyList(self->_source->keys());
+  }
+  return self->_keys;
+}
+
+static bool PythonQtMappingView_getKey(PyObject* key, QString& result)
+{
+  if (!PythonQtConv::isStringType(Py_TYPE(key))) {
+    return false;
+  }
+  result = PythonQtConv::PyObjGetString(key);
+  return true;
+}
+
+static PyObject* PythonQtMappingView_toDict(PythonQtMappingViewObject* self, PyObject* /*args*/ = nullptr)
+{
+  PyObject* keys = PythonQtMappingView_keyList(self);
+  PyObject* result = PyDict_New();
+  Py_ssize_t count = PyList_GET_SIZE(keys);
+  for (Py_ssize_t i = 0; i < count; i++) {
+    PyObject* key = PyList_GET_ITEM(keys, i);
+    PyObject* value = self->_source->value(PythonQtConv::PyObjGetString(key));
+    PyDict_SetItem(result, key, value);
+    Py_DECREF(value);
+  }
+  return result;
+}
+
+static PyObject* PythonQtMappingView_keys(PythonQtMappingViewObject* self, PyObject* /*args*/)
+{
+  PyObject* keys = PythonQtMappingView_keyList(self);
+  return PyList_GetSlice(keys, 0, PyList_GET_SIZE(keys));
+}
+
+static PyObject* PythonQtMappingView_values(PythonQtMappingViewObject* self, PyObject* /*args*/)
+{
+  PyObject* keys = PythonQtMappingView_keyList(self);
+  Py_ssize_t count = PyList_GET_SIZE(keys);
+  PyObject* result = PyList_New(count);
+  for (Py_ssize_t i = 0; i < count; i++) {
+    PyList_SET_ITEM(result, i, self->_source->value(PythonQtConv::PyObjGetString(PyList_GET_ITEM(keys, i))));
+  }
+  return result;
+}
+
+static PyObject* PythonQtMappingView_items(PythonQtMappingViewObject* self, PyObject* /*args*/)
+{
+  PyObject* keys = PythonQtMappingView_keyList(self);
+  Py_ssize_t count = PyList_GET_SIZE(keys);
+  PyObject* result = PyList_New(count);
+  for (Py_ssize_t i = 0; i < count; i++) {
+    PyObject* key = PyList_GET_ITEM(keys, i);
+    PyObject* value = self->_source->value(PythonQtConv::PyObjGetString(key));
+    PyList_SET_ITEM(result, i, PyTuple_Pack(2, key, value));
+    Py_DECREF(value);
+  }
+  return result;
+}
+
+static PyObject* PythonQtMappingView_get(PythonQtMappingViewObject* self, PyObject* args)
+{
+  PyObject* key;
+  PyObject* defaultValue = Py_None;
+  if (!PyArg_ParseTuple(args, "O|O:get", &key, &defaultValue)) {
+    return nullptr;
+  }
+  QString keyString;
+  if (PythonQtMappingView_getKey(key, keyString) && self->_source->contains(keyString)) {
+    return self->_source->value(keyString);
+  }
+  Py_INCREF(defaultValue);
+  return defaultValue;
+}
+
+static Py_ssize_t PythonQtMappingView_length(PythonQtMappingViewObject* self)
+{
+  return self->_source->size();
+}
+
+static PyObject* PythonQtMappingView_subscript(PythonQtMappingViewObject* self, PyObject* key)
+{
+  QString keyString;
+  if (PythonQtMappingView_getKey(key, keyString) && self->_source->contains(keyString)) {
+    return self->_source->value(keyString);
+  }
+  PyErr_SetObject(PyExc_KeyError, key);
+  return nullptr;
+}
+
+static int PythonQtMappingView_contains(PythonQtMappingViewObject* self, PyObject* key)
+{
+  QString keyString;
+  return (PythonQtMappingView_getKey(key, keyString) && self->_source->contains(keyString)) ? 1 : 0;
+}
+
+static PyObject* PythonQtMappingView_iter(PythonQtMappingViewObject* self)
+{
+  return PyObject_GetIter(PythonQtMappingView_keyList(self));
+}
+
+static PyObject* PythonQtMappingView_richcompare(PythonQtMappingViewObject* self, PyObject* other, int op)
+{
+  if (op != Py_EQ && op != Py_NE) {
+    Py_INCREF(Py_NotImplemented);
+    return Py_NotImplemented;
+  }
+  // compare like the dict we would have returned without views
+  PythonQtObjectPtr dict;
+  dict.setNewRef(PythonQtMappingView_toDict(self));
+  PythonQtObjectPtr otherDict;
+  if (PythonQtMappingView_Check(other)) {
+    otherDict.setNewRef(PythonQtMappingView_toDict((PythonQtMappingViewObject*)other));
+    other = otherDict;
+  }
+  return PyObject_RichCompare(dict, other, op);
+}
+
+static PyObject* PythonQtMappingView_repr(PythonQtMappingViewObject* self)
+{
+  PythonQtObjectPtr dict;
+  dict.setNewRef(PythonQtMappingView_toDict(self));
+  QString repr = "MappingView(" + PythonQtConv::PyObjGetRepresentation(dict) + ")";
+  return PythonQtConv::QStringToPyObject(repr);
+}
+
+static PyMethodDef PythonQtMappingView_methods[] = {
+  {"keys", (PyCFunction)PythonQtMappingView_keys, METH_NOARGS,
+  "Returns the keys as a list"
+  },
+  {"values", (PyCFunction)PythonQtMappingView_values, METH_NOARGS,
+  "Converts all values and returns them as a list"
+  },
+  {"items", (PyCFunction)PythonQtMappingView_items, METH_NOARGS,
+  "Converts all values and returns a list of (key, value) tuples"
+  },
+  {"get", (PyCFunction)PythonQtMappingView_get, METH_VARARGS,
+  "Returns the value for key if key is contained, else default"
+  },
+  {"toDict", (PyCFunction)PythonQtMappingView_toDict, METH_NOARGS,
+  "Converts all values and returns them as a dict"
+  },
+  {nullptr, nullptr, 0 , nullptr}  /* Sentinel */
+};
+
+static PySequenceMethods PythonQtMappingView_as_sequence = {
+  nullptr,      /* sq_length */
+  nullptr,      /* sq_concat */
+  nullptr,      /* sq_repeat */
+  nullptr,      /* sq_item */
+  nullptr,      /* sq_slice / was_sq_slice */
+  nullptr,      /* sq_ass_item */
+  nullptr,      /* sq_ass_slice / was_sq_ass_slice */
+  (objobjproc)PythonQtMappingView_contains,  /* sq_contains */
+};
+
+static PyMappingMethods PythonQtMappingView_as_mapping = {
+  (lenfunc)PythonQtMappingView_length,         /* mp_length */
+  (binaryfunc)PythonQtMappingView_subscript,   /* mp_subscript */
+  nullptr,                                     /* mp_ass_subscript */
+};
+
+PyTypeObject PythonQtMappingView_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "MappingView",
+    sizeof(PythonQtMappingViewObject),
+    0,
+    (destructor)PythonQtMappingView_dealloc,   /* tp_dealloc */
+    0,            /* tp_vectorcall_offset */
+    nullptr,      /* tp_getattr */
+    nullptr,      /* tp_setattr */
+    nullptr,
+    (reprfunc)PythonQtMappingView_repr,        /* tp_repr */
+    nullptr,      /* tp_as_number */
+    &PythonQtMappingView_as_sequence,          /* tp_as_sequence */
+    &PythonQtMappingView_as_mapping,           /* tp_as_mapping */
+    PyObject_HashNotImplemented,               /* tp_hash */
+    nullptr,      /* tp_call */
+    nullptr,      /* tp_str */
+    nullptr,      /* tp_getattro */
+    nullptr,      /* tp_setattro */
+    nullptr,      /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,/* tp_flags */
+    "Read-only mapping that converts the values of a C++ container on access",     /* tp_doc */
+    nullptr,      /* tp_traverse */
+    nullptr,      /* tp_clear */
+    (richcmpfunc)PythonQtMappingView_richcompare, /* tp_richcompare */
+    0,            /* tp_weaklistoffset */
+    (getiterfunc)PythonQtMappingView_iter,     /* tp_iter */
+    nullptr,      /* tp_iternext */
+    PythonQtMappingView_methods,               /* tp_methods */
+};
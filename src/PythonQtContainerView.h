@@ -0,0 +1,118 @@
+#ifndef _PYTHONQTCONTAINERVIEW_H
+#define _PYTHONQTCONTAINERVIEW_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtContainerView.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+#include "PythonQtSystem.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QStringList>
+#include <QVariant>
+
+extern PYTHONQT_EXPORT PyTypeObject PythonQtSequenceView_Type;
+extern PYTHONQT_EXPORT PyTypeObject PythonQtMappingView_Type;
+
+#define PythonQtSequenceView_Check(op) (Py_TYPE(op) == &PythonQtSequenceView_Type)
+#define PythonQtMappingView_Check(op) (Py_TYPE(op) == &PythonQtMappingView_Type)
+
+//! The container behind a PythonQtSequenceView, it converts its items to Python on access.
+class PYTHONQT_EXPORT PythonQtSequenceViewSource
+{
+public:
+  virtual ~PythonQtSequenceViewSource() {}
+
+  virtual Py_ssize_t size() const = 0;
+  //! returns a new reference to the converted item, index is in range
+  virtual PyObject* item(Py_ssize_t index) const = 0;
+  //! returns the container as variant if it can be passed back to C++ without conversion
+  virtual QVariant toVariant() const { return QVariant(); }
+};
+
+//! The container behind a PythonQtMappingView (with string keys), it converts its values to Python on access.
+class PYTHONQT_EXPORT PythonQtMappingViewSource
+{
+public:
+  virtual ~PythonQtMappingViewSource() {}
+
+  virtual Py_ssize_t size() const = 0;
+  //! returns the keys in the iteration order of the container
+  virtual QStringList keys() const = 0;
+  virtual bool contains(const QString& key) const = 0;
+  //! returns a new reference to the converted value, the key has to be contained
+  virtual PyObject* value(const QString& key) const = 0;
+  //! returns the container as variant if it can be passed back to C++ without conversion
+  virtual QVariant toVariant() const { return QVariant(); }
+};
+
+//! a read-only Python sequence that converts the items of a Qt container on access
+struct PythonQtSequenceViewObject {
+  PyObject_HEAD
+  PythonQtSequenceViewSource* _source;
+};
+
+//! a read-only Python mapping that converts the values of a Qt container on access
+struct PythonQtMappingViewObject {
+  PyObject_HEAD
+  PythonQtMappingViewSource* _source;
+  //! the keys as a Python list, created on first iteration
+  PyObject* _keys;
+};
+
+//! creates a new sequence view, takes ownership of the source
+PYTHONQT_EXPORT PyObject* PythonQtSequenceView_New(PythonQtSequenceViewSource* source);
+//! creates a new mapping view, takes ownership of the source
+PYTHONQT_EXPORT PyObject* PythonQtMappingView_New(PythonQtMappingViewSource* source);
+
+//! creates a view on a (implicitly shared) copy of the list
+PYTHONQT_EXPORT PyObject* PythonQtSequenceView_FromVariantList(const QVariantList& list);
+//! creates a view on a copy of the list of QObject pointers, the items are wrapped as \c className when they are
+//! accessed and are None if they have been deleted. Returns NULL if \c className is not a known QObject class,
+//! lists of other pointers have to be wrapped eagerly
+PYTHONQT_EXPORT PyObject* PythonQtSequenceView_FromPointerList(const QList<void*>& list, const QByteArray& className);
+//! creates a view on a (implicitly shared) copy of the map
+PYTHONQT_EXPORT PyObject* PythonQtMappingView_FromVariantMap(const QVariantMap& map);
+//! creates a view on a (implicitly shared) copy of the hash
+PYTHONQT_EXPORT PyObject* PythonQtMappingView_FromVariantHash(const QVariantHash& hash);
+
+#endif
@@ -40,6 +40,7 @@
 //----------------------------------------------------------------------------------
 
 #include "PythonQtConversion.h"
+#include "PythonQtContainerView.h"
 #include "PythonQtVariants.h"
 #include "PythonQtBoolResult.h"
 #include <QDateTime>
@@ -68,6 +69,8 @@ QHash<int, PythonQtConvertMetaTypeToPythonCB*> PythonQtConv::_metaTypeToPythonCo
 QHash<int, PythonQtConvertPythonToMetaTypeCB*> PythonQtConv::_pythonToMetaTypeConverters;
 
 PythonQtConvertPythonSequenceToQVariantListCB* PythonQtConv::_pythonSequenceToQVariantListCB = nullptr;
+bool PythonQtConv::_numericListsAsBuffers = false;
+bool PythonQtConv::_containerViews = false;
 
 PyObject* PythonQtConv::GetPyBool(bool val)
 {
@@ -196,10 +199,19 @@ PyObject* PythonQtConv::convertQtValueToPythonInternal(int type, const void* dat
   //  return PyBytes_FromStringAndSize(*v, v->size());
   //                            }
   case QMetaType::QVariantHash:
+    if (_containerViews) {
+      return PythonQtMappingView_FromVariantHash(*((QVariantHash*)data));
+    }
     return PythonQtConv::QVariantHashToPyObject(*((QVariantHash*)data));
   case QMetaType::QVariantMap:
+    if (_containerViews) {
+      return PythonQtMappingView_FromVariantMap(*((QVariantMap*)data));
+    }
     return PythonQtConv::QVariantMapToPyObject(*((QVariantMap*)data));
   case QMetaType::QVariantList:
+    if (_containerViews) {
+      return PythonQtSequenceView_FromVariantList(*((QVariantList*)data));
+    }
     return PythonQtConv::QVariantListToPyObject(*((QVariantList*)data));
   case QMetaType::QString:
     return PythonQtConv::QStringToPyObject(*((QString*)data));
@@ -307,6 +319,33 @@ PyObject* PythonQtConv::convertQtValueToPythonInternal(int type, const void* dat
    return object;
  }
 
+ void* PythonQtConv::castWrapperTo(PythonQtInstanceWrapper* wrapper, const PythonQtMethodInfo::ParameterInfo& info, bool& ok)
+ {
+   PythonQtClassInfo* classInfo = wrapper->classInfo();
+   if (!info.classInfo) {
+     // the class info can only be found among the ancestors of a wrapper that can be casted to it
+     info.classInfo = classInfo->findAncestor(info.name);
+     if (!info.classInfo) {
+       ok = false;
+       return nullptr;
+     }
+   }
+   void* object;
+   if (classInfo->isCPPWrapper()) {
+     object = wrapper->_wrappedPtr;
+   } else {
+     QObject* tmp = wrapper->_obj;
+     object = tmp;
+   }
+   if (object) {
+     object = classInfo->castTo(object, info.classInfo);
+     ok = object!=nullptr;
+   } else {
+     ok = classInfo->inherits(info.classInfo);
+   }
+   return object;
+ }
+
 void* PythonQtConv::handlePythonToQtAutoConversion(int typeId, PyObject* obj, void* alreadyAllocatedCPPObject, PythonQtArgumentFrame* frame)
 {
   void* ptr = alreadyAllocatedCPPObject;
@@ -410,7 +449,7 @@ void* PythonQtConv::ConvertPythonToQt(const PythonQtMethodInfo::ParameterInfo& i
 
      // a C++ wrapper (can be passed as pointer or reference)
      PythonQtInstanceWrapper* wrap = (PythonQtInstanceWrapper*)obj;
-     void* object = castWrapperTo(wrap, info.name, ok);
+     void* object = castWrapperTo(wrap, info, ok);
      if (ok) {
        if (info.passOwnershipToCPP) {
          // Example: QLayout::addWidget(QWidget*)
@@ -1070,6 +1109,25 @@ void PythonQtConv::pythonToMapVariant(PyObject* val, QVariant& result)
   }
 }
 
+namespace
+{
+  //! views on QVariantList/Map/Hash can pass their container back to C++ without conversion
+  bool containerFromView(PyObject* val, int type, QVariant& result)
+  {
+    QVariant container;
+    if (PythonQtSequenceView_Check(val)) {
+      container = ((PythonQtSequenceViewObject*)val)->_source->toVariant();
+    } else if (PythonQtMappingView_Check(val)) {
+      container = ((PythonQtMappingViewObject*)val)->_source->toVariant();
+    }
+    if (container.userType() == type) {
+      result = container;
+      return true;
+    }
+    return false;
+  }
+}
+
 namespace
 {
   QVariant variantFromType(int typeId, const void *copy)
@@ -1145,7 +1203,7 @@ QVariant PythonQtConv::PyObjToQVariant(PyObject* val, int type)
     } else if (val == Py_None) {
       // none is invalid
       type = QVariant::Invalid;
-    } else if (PyDict_Check(val)) {
+    } else if (PyDict_Check(val) || PythonQtMappingView_Check(val)) {
       type = QVariant::Map;
     } else if (PyList_Check(val) || PyTuple_Check(val) || PySequence_Check(val)) {
       type = QVariant::List;
@@ -1257,13 +1315,22 @@ QVariant PythonQtConv::PyObjToQVariant(PyObject* val, int type)
     break;
 
   case QVariant::Map:
+    if (containerFromView(val, type, v)) {
+      return v;
+    }
     pythonToMapVariant<QVariantMap>(val, v);
     break;
   case QVariant::Hash:
+    if (containerFromView(val, type, v)) {
+      return v;
+    }
     pythonToMapVariant<QVariantHash>(val, v);
     break;
   case QVariant::List:
   {
+    if (containerFromView(val, type, v)) {
+      return v;
+    }
     bool isListOrTuple = PyList_Check(val) || PyTuple_Check(val);
     if (isListOrTuple || PySequence_Check(val)) {
       if (!isListOrTuple && _pythonSequenceToQVariantListCB) {
@@ -1442,8 +1509,74 @@ PyObject* PythonQtConv::QVariantListToPyObject(const QVariantList& l) {
   return result;
 }
 
+char PythonQtConv::getNumericBuffer(PyObject* obj, Py_buffer* view)
+{
+#ifdef PY3K
+  if (!PyObject_CheckBuffer(obj)) {
+    return 0;
+  }
+  if (PyObject_GetBuffer(obj, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+    PyErr_Clear();
+    return 0;
+  }
+  const char* format = view->format ? view->format : "B";
+  // only native byte order is supported
+  if (*format == '@' || *format == '=') {
+    format++;
+  }
+  Py_ssize_t itemSize = 0;
+  switch (format[0]) {
+  case 'b': case 'B': itemSize = sizeof(char); break;
+  case 'h': case 'H': itemSize = sizeof(short); break;
+  case 'i': case 'I': itemSize = sizeof(int); break;
+  case 'l': case 'L': itemSize = sizeof(long); break;
+  case 'q': case 'Q': itemSize = sizeof(long long); break;
+  case 'f': itemSize = sizeof(float); break;
+  case 'd': itemSize = sizeof(double); break;
+  case '?': itemSize = sizeof(bool); break;
+  }
+  if (itemSize && format[1] == 0 && view->itemsize == itemSize && view->ndim == 1) {
+    return format[0];
+  }
+  PyBuffer_Release(view);
+#else
+  Q_UNUSED(obj);
+  Q_UNUSED(view);
+#endif
+  return 0;
+}
+
+PyObject* PythonQtConv::wrapNumericBuffer(PyObject* bytes, char format)
+{
+#ifdef PY3K
+  PyObject* result = nullptr;
+  PyObject* view = PyMemoryView_FromObject(bytes);
+  if (view) {
+    char formatString[2] = { format, 0 };
+    result = PyObject_CallMethod(view, "cast", "s", formatString);
+    Py_DECREF(view);
+  }
+  Py_DECREF(bytes);
+  if (!result) {
+    PyErr_Clear();
+  }
+  return result;
+#else
+  Q_UNUSED(format);
+  Py_DECREF(bytes);
+  return nullptr;
+#endif
+}
+
 PyObject* PythonQtConv::ConvertQListOfPointerTypeToPythonList(QList<void*>* list, const PythonQtMethodInfo::ParameterInfo& info)
 {
+  if (_containerViews && !info.passOwnershipToCPP && !info.passOwnershipToPython) {
+    // the ownership could only be passed when an item is accessed, so views are only used without ownership transfer
+    PyObject* view = PythonQtSequenceView_FromPointerList(*list, info.innerName);
+    if (view) {
+      return view;
+    }
+  }
   PyObject* result = PyTuple_New(list->count());
   int i = 0;
   Q_FOREACH (void* value, *list) {
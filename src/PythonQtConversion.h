@@ -47,9 +47,12 @@
 #include "PythonQtMisc.h"
 #include "PythonQtClassInfo.h"
 #include "PythonQtMethodInfo.h"
+#include "PythonQtContainerView.h"
 
 #include <QList>
 #include <vector>
+#include <algorithm>
+#include <type_traits>
 
 typedef PyObject* PythonQtConvertMetaTypeToPythonCB(const void* inObject, int metaTypeId);
 typedef bool PythonQtConvertPythonToMetaTypeCB(PyObject* inObject, void* outObject, int metaTypeId, bool strict);
@@ -175,12 +178,36 @@ public:
   //! converts the Qt parameter given in \c data, interpreting it as a \c type registered qvariant/meta type, into a Python object,
   static PyObject* convertQtValueToPythonInternal(int type, const void* data);
 
+  //! If enabled, numeric QList/QVector/std::vector values are converted to a typed, read-only memoryview
+  //! instead of a tuple, which is much faster for large lists and can be passed to numpy.asarray() without another copy.
+  //! This is off by default and only supported with Python 3.
+  static void setNumericListsAsBuffers(bool flag) { _numericListsAsBuffers = flag; }
+  static bool numericListsAsBuffers() { return _numericListsAsBuffers; }
+
+  //! If enabled, QVariantList, QVariantMap, QVariantHash, lists of QObject pointers and lists of known classes
+  //! are returned as read-only views that convert their items on access (see PythonQtContainerView.h),
+  //! so that accessing a few items of a large container does not convert all of them. Off by default.
+  static void setContainerViews(bool flag) { _containerViews = flag; }
+  static bool containerViews() { return _containerViews; }
+
+  //! Gets a contiguous, one-dimensional buffer of native numeric items from \c obj (e.g. from array.array, bytes or numpy).
+  //! Returns the struct module format character of the items, or 0 if \c obj does not provide such a buffer.
+  //! If a format is returned, the buffer has to be released with PyBuffer_Release().
+  static char getNumericBuffer(PyObject* obj, Py_buffer* view);
+
+  //! Wraps the \c bytes object (which is stolen) into a read-only memoryview with the given item \c format,
+  //! returns NULL if this is not supported.
+  static PyObject* wrapNumericBuffer(PyObject* bytes, char format);
+
   //! creates a copy of given object, using the QMetaType
   static PyObject* createCopyFromMetaType( int type, const void* object );
 
   //! cast wrapper to given className if possible
   static void* castWrapperTo(PythonQtInstanceWrapper* wrapper, const QByteArray& className, bool& ok);
 
+  //! cast wrapper to the type of the given parameter if possible, uses the class info cached in the parameter info
+  static void* castWrapperTo(PythonQtInstanceWrapper* wrapper, const PythonQtMethodInfo::ParameterInfo& info, bool& ok);
+
   static bool      convertToPythonQtObjectPtr(PyObject* obj, void* /* PythonQtObjectPtr* */ outPtr, int /*metaTypeId*/, bool /*strict*/);
   static PyObject* convertFromPythonQtObjectPtr(const void* /* PythonQtObjectPtr* */ inObject, int /*metaTypeId*/);
   static bool      convertToPythonQtSafeObjectPtr(PyObject* obj, void* /* PythonQtObjectPtr* */ outPtr, int /*metaTypeId*/, bool /*strict*/);
@@ -208,6 +235,8 @@ protected:
   static QHash<int, PythonQtConvertMetaTypeToPythonCB*> _metaTypeToPythonConverters;
   static QHash<int, PythonQtConvertPythonToMetaTypeCB*> _pythonToMetaTypeConverters;
   static PythonQtConvertPythonSequenceToQVariantListCB*  _pythonSequenceToQVariantListCB;
+  static bool _numericListsAsBuffers;
+  static bool _containerViews;
 
   //! handle automatic conversion of some special types (QColor, QBrush, ...)
   static void* handlePythonToQtAutoConversion(int typeId, PyObject* obj, void* alreadyAllocatedCPPObject, PythonQtArgumentFrame* frame);
@@ -233,10 +262,122 @@ protected:
 #endif
 };
 
+//! the struct module format character of numeric list items that can be passed as buffers
+template<class T> struct PythonQtNumericBufferFormat { static char value() { return 0; } };
+template<> struct PythonQtNumericBufferFormat<bool> { static char value() { return '?'; } };
+template<> struct PythonQtNumericBufferFormat<float> { static char value() { return 'f'; } };
+template<> struct PythonQtNumericBufferFormat<double> { static char value() { return 'd'; } };
+template<> struct PythonQtNumericBufferFormat<qint32> { static char value() { return 'i'; } };
+template<> struct PythonQtNumericBufferFormat<quint32> { static char value() { return 'I'; } };
+template<> struct PythonQtNumericBufferFormat<qint64> { static char value() { return 'q'; } };
+template<> struct PythonQtNumericBufferFormat<quint64> { static char value() { return 'Q'; } };
+
+//! lists that store their items in one contiguous array
+template<class ListType> struct PythonQtIsContiguousList { static const bool value = true; };
+#if QT_VERSION < 0x060000
+template<class T> struct PythonQtIsContiguousList<QList<T> > { static const bool value = false; };
+#endif
+template<> struct PythonQtIsContiguousList<std::vector<bool> > { static const bool value = false; };
+
+template<class ListType, class T, class S>
+void PythonQtCopyBufferItemsToList(const S* src, Py_ssize_t count, ListType* list, std::true_type /*contiguous*/)
+{
+  size_t offset = list->size();
+  list->resize(offset + count);
+  T* dst = list->data() + offset;
+  for (Py_ssize_t i = 0; i < count; i++) {
+    dst[i] = static_cast<T>(src[i]);
+  }
+}
+
+template<class ListType, class T, class S>
+void PythonQtCopyBufferItemsToList(const S* src, Py_ssize_t count, ListType* list, std::false_type /*contiguous*/)
+{
+  list->reserve(list->size() + count);
+  for (Py_ssize_t i = 0; i < count; i++) {
+    list->push_back(static_cast<T>(src[i]));
+  }
+}
+
+template<class ListType, class T, class S>
+void PythonQtCopyBufferItemsToList(const void* src, Py_ssize_t count, ListType* list)
+{
+  PythonQtCopyBufferItemsToList<ListType, T, S>((const S*)src, count, list, std::integral_constant<bool, PythonQtIsContiguousList<ListType>::value>());
+}
+
+//! the buffer fast path is only used for arithmetic types, other types are converted item by item
+template<class ListType, class T>
+bool PythonQtConvertBufferToListOfValueType(PyObject* /*obj*/, ListType* /*list*/, std::false_type /*isArithmetic*/)
+{
+  return false;
+}
+
+template<class ListType, class T>
+bool PythonQtConvertBufferToListOfValueType(PyObject* obj, ListType* list, std::true_type /*isArithmetic*/)
+{
+  Py_buffer view;
+  char format = PythonQtConv::getNumericBuffer(obj, &view);
+  if (!format) {
+    return false;
+  }
+  if ((format == 'f' || format == 'd') && !std::is_floating_point<T>::value) {
+    // casting NaN or out of range floating point values to integers is undefined
+    PyBuffer_Release(&view);
+    return false;
+  }
+  Py_ssize_t count = view.len / view.itemsize;
+  switch (format) {
+  case 'b': PythonQtCopyBufferItemsToList<ListType, T, signed char>(view.buf, count, list); break;
+  case 'B': PythonQtCopyBufferItemsToList<ListType, T, unsigned char>(view.buf, count, list); break;
+  case 'h': PythonQtCopyBufferItemsToList<ListType, T, short>(view.buf, count, list); break;
+  case 'H': PythonQtCopyBufferItemsToList<ListType, T, unsigned short>(view.buf, count, list); break;
+  case 'i': PythonQtCopyBufferItemsToList<ListType, T, int>(view.buf, count, list); break;
+  case 'I': PythonQtCopyBufferItemsToList<ListType, T, unsigned int>(view.buf, count, list); break;
+  case 'l': PythonQtCopyBufferItemsToList<ListType, T, long>(view.buf, count, list); break;
+  case 'L': PythonQtCopyBufferItemsToList<ListType, T, unsigned long>(view.buf, count, list); break;
+  case 'q': PythonQtCopyBufferItemsToList<ListType, T, long long>(view.buf, count, list); break;
+  case 'Q': PythonQtCopyBufferItemsToList<ListType, T, unsigned long long>(view.buf, count, list); break;
+  case 'f': PythonQtCopyBufferItemsToList<ListType, T, float>(view.buf, count, list); break;
+  case 'd': PythonQtCopyBufferItemsToList<ListType, T, double>(view.buf, count, list); break;
+  case '?': PythonQtCopyBufferItemsToList<ListType, T, bool>(view.buf, count, list); break;
+  }
+  PyBuffer_Release(&view);
+  return true;
+}
+
+//! converts a numeric buffer in one pass, returns false if obj does not provide a suitable buffer or T is not arithmetic
+template<class ListType, class T>
+bool PythonQtConvertBufferToListOfValueType(PyObject* obj, ListType* list)
+{
+  return PythonQtConvertBufferToListOfValueType<ListType, T>(obj, list, std::integral_constant<bool, std::is_arithmetic<T>::value>());
+}
+
+//! converts the list to a typed memoryview, returns NULL if T is not a numeric type
+template<class ListType, class T>
+PyObject* PythonQtConvertListOfValueTypeToPythonBuffer(const ListType* list)
+{
+  char format = PythonQtNumericBufferFormat<T>::value();
+  if (!format) {
+    return nullptr;
+  }
+  PyObject* bytes = PyBytes_FromStringAndSize(nullptr, list->size() * sizeof(T));
+  if (!bytes) {
+    return nullptr;
+  }
+  std::copy(list->begin(), list->end(), (T*)PyBytes_AS_STRING(bytes));
+  return PythonQtConv::wrapNumericBuffer(bytes, format);
+}
+
 template<class ListType, class T>
 PyObject* PythonQtConvertListOfValueTypeToPythonList(const void* /*QList<T>* */ inList, int metaTypeId)
 {
   ListType* list = (ListType*)inList;
+  if (PythonQtConv::numericListsAsBuffers()) {
+    PyObject* buffer = PythonQtConvertListOfValueTypeToPythonBuffer<ListType, T>(list);
+    if (buffer) {
+      return buffer;
+    }
+  }
   static const int innerType = PythonQtMethodInfo::getInnerTemplateMetaType(QByteArray(QMetaType::typeName(metaTypeId)));
   if (innerType == QVariant::Invalid) {
     std::cerr << "PythonQtConvertListOfValueTypeToPythonList: unknown inner type " << QMetaType::typeName(metaTypeId) << std::endl;
@@ -258,6 +399,9 @@ bool PythonQtConvertPythonListToListOfValueType(PyObject* obj, void* /*QList<T>*
   if (innerType == QVariant::Invalid) {
     std::cerr << "PythonQtConvertPythonListToListOfValueType: unknown inner type " << QMetaType::typeName(metaTypeId) << std::endl;
   }
+  if (PythonQtConvertBufferToListOfValueType<ListType, T>(obj, list)) {
+    return true;
+  }
   bool result = false;
   if (PySequence_Check(obj)) {
     int count = PySequence_Size(obj);
@@ -283,6 +427,26 @@ bool PythonQtConvertPythonListToListOfValueType(PyObject* obj, void* /*QList<T>*
 
 //--------------------------------------------------------------------------------------------------------------------
 
+//! view source for a list of known classes, the items are copied when they are accessed
+template<class ListType, class T>
+class PythonQtKnownClassListViewSource : public PythonQtSequenceViewSource
+{
+public:
+  PythonQtKnownClassListViewSource(const ListType& list, PythonQtClassInfo* info):_list(list), _info(info) {}
+
+  Py_ssize_t size() const override { return _list.size(); }
+  PyObject* item(Py_ssize_t index) const override {
+    T* newObject = new T(_list[index]);
+    PythonQtInstanceWrapper* wrap = (PythonQtInstanceWrapper*)PythonQt::priv()->wrapPtr(newObject, _info->className());
+    wrap->_ownedByPythonQt = true;
+    return (PyObject*)wrap;
+  }
+
+private:
+  ListType _list;
+  PythonQtClassInfo* _info;
+};
+
 template<class ListType, class T>
 PyObject* PythonQtConvertListOfKnownClassToPythonList(const void* /*QList<T>* */ inList, int metaTypeId)
 {
@@ -291,6 +455,9 @@ PyObject* PythonQtConvertListOfKnownClassToPythonList(const void* /*QList<T>* */
   if (innerType == nullptr) {
     std::cerr << "PythonQtConvertListOfKnownClassToPythonList: unknown inner type for " << QMetaType::typeName(metaTypeId) << std::endl;
   }
+  if (PythonQtConv::containerViews() && innerType) {
+    return PythonQtSequenceView_New(new PythonQtKnownClassListViewSource<ListType, T>(*list, innerType));
+  }
   PyObject* result = PyTuple_New(list->size());
   int i = 0;
   Q_FOREACH(const T& value, *list) {
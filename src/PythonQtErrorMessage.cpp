@@ -0,0 +1,231 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtErrorMessage.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtErrorMessage.h"
+#include "PythonQtConversion.h"
+
+PyObject* PythonQtErrorMessage_New(PythonQtErrorMessageRenderer* renderer)
+{
+  PythonQtErrorMessageObject* message = PyObject_New(PythonQtErrorMessageObject, &PythonQtErrorMessage_Type);
+  if (!message) {
+    delete renderer;
+    return nullptr;
+  }
+  message->_renderer = renderer;
+  message->_message = nullptr;
+  return (PyObject*)message;
+}
+
+PyObject* PythonQtErrorMessage_Text(PyObject* obj)
+{
+  PythonQtErrorMessageObject* message = (PythonQtErrorMessageObject*)obj;
+  if (!message->_message) {
+    QString text;
+    if (message->_renderer) {
+      text = message->_renderer->render();
+      // the renderer may hold references that are no longer needed
+      delete message->_renderer;
+      message->_renderer = nullptr;
+    }
+    message->_message = PythonQtConv::QStringToPyObject(text);
+  }
+  return message->_message;
+}
+
+void PythonQtErrorMessage_SetError(PyObject* exceptionType, PythonQtErrorMessageRenderer* renderer)
+{
+  PyObject* message = PythonQtErrorMessage_New(renderer);
+  if (message) {
+    PyErr_SetObject(exceptionType, message);
+    Py_DECREF(message);
+  }
+}
+
+static PyObject* PythonQtErrorMessage_getExceptionArgs(PyObject* /*self*/, PyObject* exception)
+{
+  // args is stored in the base exception, replace the message objects when they are seen for the first time
+  PyBaseExceptionObject* base = (PyBaseExceptionObject*)exception;
+  PyObject* args = base->args;
+  if (args && PyTuple_Check(args)) {
+    PyObject* rendered = nullptr;
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(args); i++) {
+      PyObject* item = PyTuple_GET_ITEM(args, i);
+      if (PythonQtErrorMessage_Check(item)) {
+        if (!rendered) {
+          rendered = PyTuple_GetSlice(args, 0, PyTuple_GET_SIZE(args));
+          if (!rendered) {
+            return nullptr;
+          }
+        }
+        PyObject* text = PythonQtErrorMessage_Text(item);
+        if (!text) {
+          Py_DECREF(rendered);
+          return nullptr;
+        }
+        Py_INCREF(text);
+        Py_DECREF(PyTuple_GET_ITEM(rendered, i));
+        PyTuple_SET_ITEM(rendered, i, text);
+      }
+    }
+    if (rendered) {
+      base->args = rendered;
+      Py_DECREF(args);
+      args = rendered;
+    }
+  }
+  Py_XINCREF(args);
+  return args;
+}
+
+static PyObject* PythonQtErrorMessage_setExceptionArgs(PyObject* /*self*/, PyObject* args)
+{
+  PyObject* exception;
+  PyObject* value;
+  if (!PyArg_ParseTuple(args, "OO", &exception, &value)) {
+    return nullptr;
+  }
+  // use the args descriptor of BaseException, it converts the value to a tuple
+  PyObject* descr = PyObject_GetAttrString(PyExc_BaseException, "args");
+  if (!descr) {
+    return nullptr;
+  }
+  int result = Py_TYPE(descr)->tp_descr_set(descr, exception, value);
+  Py_DECREF(descr);
+  if (result < 0) {
+    return nullptr;
+  }
+  Py_RETURN_NONE;
+}
+
+static PyMethodDef PythonQtErrorMessage_getExceptionArgsDef = {
+  "args", PythonQtErrorMessage_getExceptionArgs, METH_O, nullptr
+};
+
+static PyMethodDef PythonQtErrorMessage_setExceptionArgsDef = {
+  "args", PythonQtErrorMessage_setExceptionArgs, METH_VARARGS, nullptr
+};
+
+PyObject* PythonQtErrorMessage_NewExceptionType(const char* name, PyObject* base)
+{
+  PyObject* getter = PyCFunction_New(&PythonQtErrorMessage_getExceptionArgsDef, nullptr);
+  PyObject* setter = PyCFunction_New(&PythonQtErrorMessage_setExceptionArgsDef, nullptr);
+  PyObject* property = (getter && setter) ? PyObject_CallFunctionObjArgs((PyObject*)&PyProperty_Type, getter, setter, NULL) : nullptr;
+  Py_XDECREF(getter);
+  Py_XDECREF(setter);
+  if (!property) {
+    return nullptr;
+  }
+  PyObject* dict = PyDict_New();
+  PyDict_SetItemString(dict, "args", property);
+  Py_DECREF(property);
+  PyObject* type = PyErr_NewException(const_cast<char*>(name), base, dict);
+  Py_DECREF(dict);
+  return type;
+}
+
+static void PythonQtErrorMessage_dealloc(PythonQtErrorMessageObject* self)
+{
+  delete self->_renderer;
+  Py_XDECREF(self->_message);
+  PyObject_Del(self);
+}
+
+static PyObject* PythonQtErrorMessage_str(PyObject* self)
+{
+  PyObject* text = PythonQtErrorMessage_Text(self);
+  Py_XINCREF(text);
+  return text;
+}
+
+static PyObject* PythonQtErrorMessage_repr(PyObject* self)
+{
+  PyObject* text = PythonQtErrorMessage_Text(self);
+  return text ? PyObject_Repr(text) : nullptr;
+}
+
+static long PythonQtErrorMessage_hash(PyObject* self)
+{
+  PyObject* text = PythonQtErrorMessage_Text(self);
+  return text ? PyObject_Hash(text) : -1;
+}
+
+static PyObject* PythonQtErrorMessage_richcompare(PyObject* self, PyObject* other, int op)
+{
+  // behave like the rendered string, so that code that inspects the exception arguments keeps working
+  PyObject* text = PythonQtErrorMessage_Text(self);
+  if (!text) {
+    return nullptr;
+  }
+  if (PythonQtErrorMessage_Check(other)) {
+    other = PythonQtErrorMessage_Text(other);
+    if (!other) {
+      return nullptr;
+    }
+  }
+  return PyObject_RichCompare(text, other, op);
+}
+
+PyTypeObject PythonQtErrorMessage_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "ErrorMessage",
+    sizeof(PythonQtErrorMessageObject),
+    0,
+    (destructor)PythonQtErrorMessage_dealloc,  /* tp_dealloc */
+    0,            /* tp_vectorcall_offset */
+    nullptr,      /* tp_getattr */
+    nullptr,      /* tp_setattr */
+    nullptr,
+    PythonQtErrorMessage_repr,                 /* tp_repr */
+    nullptr,      /* tp_as_number */
+    nullptr,      /* tp_as_sequence */
+    nullptr,      /* tp_as_mapping */
+    (hashfunc)PythonQtErrorMessage_hash,       /* tp_hash */
+    nullptr,      /* tp_call */
+    PythonQtErrorMessage_str,                  /* tp_str */
+    nullptr,      /* tp_getattro */
+    nullptr,      /* tp_setattro */
+    nullptr,      /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,/* tp_flags */
+    "Error message that is rendered when it is first converted to a string",     /* tp_doc */
+    nullptr,      /* tp_traverse */
+    nullptr,      /* tp_clear */
+    PythonQtErrorMessage_richcompare,          /* tp_richcompare */
+};
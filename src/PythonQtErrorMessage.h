@@ -0,0 +1,90 @@
+#ifndef _PYTHONQTERRORMESSAGE_H
+#define _PYTHONQTERRORMESSAGE_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtErrorMessage.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtPythonInclude.h"
+
+#include "PythonQtSystem.h"
+#include <QString>
+
+//! Renders the text of an error message, this is only done when the message is actually needed,
+//! e.g. when the exception is printed or converted to a string
+class PYTHONQT_EXPORT PythonQtErrorMessageRenderer {
+public:
+  virtual ~PythonQtErrorMessageRenderer() {}
+
+  //! returns the message text, this is called at most once
+  virtual QString render() = 0;
+};
+
+extern PYTHONQT_EXPORT PyTypeObject PythonQtErrorMessage_Type;
+
+#define PythonQtErrorMessage_Check(op) (Py_TYPE(op) == &PythonQtErrorMessage_Type)
+
+//! a Python object that is passed as argument to an exception and renders its text on the first str()/repr()
+struct PythonQtErrorMessageObject {
+  PyObject_HEAD
+
+  //! the renderer, deleted after the message was rendered
+  PythonQtErrorMessageRenderer* _renderer;
+
+  //! the rendered message (a string) or NULL if it was not rendered yet
+  PyObject* _message;
+};
+
+//! creates a new message object, takes ownership of the renderer
+PYTHONQT_EXPORT PyObject* PythonQtErrorMessage_New(PythonQtErrorMessageRenderer* renderer);
+
+//! returns the rendered message as string (borrowed reference)
+PYTHONQT_EXPORT PyObject* PythonQtErrorMessage_Text(PyObject* message);
+
+//! sets a Python error of the given exception type with a message that is rendered lazily,
+//! takes ownership of the renderer. The exception type should be created with PythonQtErrorMessage_NewExceptionType(),
+//! otherwise the message object is visible in the args of the exception.
+PYTHONQT_EXPORT void PythonQtErrorMessage_SetError(PyObject* exceptionType, PythonQtErrorMessageRenderer* renderer);
+
+//! creates a new exception type derived from \c base whose args contain the rendered messages (plain strings)
+//! instead of the message objects, the messages are rendered on the first access of args or str() (new reference)
+PYTHONQT_EXPORT PyObject* PythonQtErrorMessage_NewExceptionType(const char* name, PyObject* base);
+
+#endif
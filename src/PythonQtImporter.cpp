@@ -48,7 +48,10 @@
 #include "PythonQtImportFileInterface.h"
 #include "PythonQt.h"
 #include "PythonQtConversion.h"
+#include "PythonQtTrace.h"
+#include <QCryptographicHash>
 #include <QDir>
+#include <QDirIterator>
 #include <QFile>
 #include <QFileInfo>
 #include <fcntl.h>
@@ -80,6 +83,8 @@ struct st_mlab_searchorder {
 extern PyTypeObject PythonQtImporter_Type;
 PyObject *PythonQtImportError;
 
+QString PythonQtImport::_bytecodeCacheDirectory;
+
 QString PythonQtImport::getSubName(const QString& str)
 {
   int idx = str.lastIndexOf('.');
@@ -233,6 +238,12 @@ PythonQtImporter_load_module(PyObject *obj, PyObject *args)
     return nullptr;
   }
 
+  // covers loading, compiling and executing the module, including nested imports
+  PythonQtTraceScope trace(PythonQtTrace::Imports);
+  if (trace.isEnabled()) {
+    trace.begin(nullptr, fullname);
+  }
+
   if (info.type == PythonQtImport::MI_PACKAGE || info.type == PythonQtImport::MI_MODULE) {
     QString fullPath;
     QString fullCachePath;
@@ -552,19 +563,19 @@ open_exclusive(const QString& filename)
 }
 
 
-void PythonQtImport::writeCompiledModule(PyCodeObject *co, const QString& filename, long mtime, long sourceSize)
+bool PythonQtImport::writeCompiledModule(PyCodeObject *co, const QString& filename, long mtime, long sourceSize)
 {
   FILE *fp;
   // we do not want to write Qt resources to disk, do we?
   if (filename.startsWith(":")) {
-    return;
+    return false;
   }
   fp = open_exclusive(filename);
   if (fp == nullptr) {
     if (Py_VerboseFlag)
       PySys_WriteStderr(
       "# can't create %s\n", QStringToPythonConstCharPointer(filename));
-    return;
+    return false;
   }
 #if PY_VERSION_HEX < 0x02040000
   PyMarshal_WriteLongToFile(PyImport_GetMagicNumber(), fp);
@@ -593,7 +604,7 @@ void PythonQtImport::writeCompiledModule(PyCodeObject *co, const QString& filena
     /* Don't keep partial file */
     fclose(fp);
     QFile::remove(filename);
-    return;
+    return false;
   }
   /* Now write the true mtime */
   fseek(fp, 4L, 0);
@@ -607,6 +618,42 @@ void PythonQtImport::writeCompiledModule(PyCodeObject *co, const QString& filena
   if (Py_VerboseFlag) {
     PySys_WriteStderr("# wrote %s\n", QStringToPythonConstCharPointer(filename));
   }
+  return true;
+}
+
+namespace
+{
+  void appendLong(QByteArray& data, long value)
+  {
+    // pyc files store their header values in little endian byte order, like PyMarshal_WriteLongToFile()
+    data.append(char(value & 0xff));
+    data.append(char((value >> 8) & 0xff));
+    data.append(char((value >> 16) & 0xff));
+    data.append(char((value >> 24) & 0xff));
+  }
+}
+
+QByteArray PythonQtImport::compiledModuleData(PyCodeObject *co, long mtime, long sourceSize)
+{
+  QByteArray data;
+  appendLong(data, PyImport_GetMagicNumber());
+  appendLong(data, mtime);
+#ifdef PY3K
+  appendLong(data, sourceSize);
+#else
+  Q_UNUSED(sourceSize)
+#endif
+#if PY_VERSION_HEX < 0x02040000
+  PyObject* marshalled = PyMarshal_WriteObjectToString((PyObject *)co);
+#else
+  PyObject* marshalled = PyMarshal_WriteObjectToString((PyObject *)co, Py_MARSHAL_VERSION);
+#endif
+  if (!marshalled) {
+    return QByteArray();
+  }
+  data.append(PyBytes_AS_STRING(marshalled), PyBytes_GET_SIZE(marshalled));
+  Py_DECREF(marshalled);
+  return data;
 }
 
 /* Given the contents of a .py[co] file in a buffer, unmarshal the data
@@ -745,19 +792,97 @@ PythonQtImport::getCodeFromData(const QString& path, int isbytecode,int /*ispack
     code = unmarshalCode(path, qdata, mtime);
   }
   else {
-  //  mlabDebugConst("MLABPython", "compiling source " << path);
-    code = compileSource(path, qdata);
-    if (code) {
-      // save a pyc file if possible
-      QDateTime time;
-      time = PythonQt::importInterface()->lastModifiedDate(path);
-      QString cacheFilename =  getCacheFilename(path, /*isOptimizedFilename=*/false);
-      writeCompiledModule((PyCodeObject*)code, cacheFilename, toSecsSinceEpoch(time), /*sourceSize=*/qdata.length());
+    // sources without a pyc file next to them may have one in the bytecode cache directory
+    QString bytecodeCacheFilename = getBytecodeCacheFilename(path, qdata);
+    code = bytecodeCacheFilename.isEmpty() ? nullptr : readCachedBytecode(bytecodeCacheFilename);
+    if (!code) {
+    //  mlabDebugConst("MLABPython", "compiling source " << path);
+      code = compileSource(path, qdata);
+      if (code) {
+        // save a pyc file if possible
+        QDateTime time;
+        time = PythonQt::importInterface()->lastModifiedDate(path);
+        QString cacheFilename =  getCacheFilename(path, /*isOptimizedFilename=*/false);
+        if (!writeCompiledModule((PyCodeObject*)code, cacheFilename, toSecsSinceEpoch(time), /*sourceSize=*/qdata.length()) &&
+            !bytecodeCacheFilename.isEmpty()) {
+          // the cache file name depends on the content, so it does not need a time stamp
+          writeCompiledModule((PyCodeObject*)code, bytecodeCacheFilename, 0, /*sourceSize=*/qdata.length());
+        }
+      }
     }
   }
   return code;
 }
 
+bool PythonQtImport::setBytecodeCacheDirectory(const QString& path)
+{
+  _bytecodeCacheDirectory.clear();
+  if (path.isEmpty()) {
+    return true;
+  }
+  if (!QDir().mkpath(path)) {
+    std::cerr << "PythonQt: could not create bytecode cache directory " << path.toLocal8Bit().constData() << std::endl;
+    return false;
+  }
+  _bytecodeCacheDirectory = QDir(path).absolutePath();
+  return true;
+}
+
+QString PythonQtImport::bytecodeCacheDirectory()
+{
+  return _bytecodeCacheDirectory;
+}
+
+QString PythonQtImport::getBytecodeCacheFilename(const QString& sourcePath, const QByteArray& source)
+{
+  if (_bytecodeCacheDirectory.isEmpty()) {
+    return QString();
+  }
+  // the path is part of the key, since it is stored as the file name of the code object
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(sourcePath.toUtf8());
+  hash.addData("\0", 1);
+  hash.addData(source);
+  return _bytecodeCacheDirectory + "/" + QString::fromLatin1(hash.result().toHex()) + ".pyc";
+}
+
+PyObject* PythonQtImport::readCachedBytecode(const QString& cacheFilename)
+{
+  QFile file(cacheFilename);
+  if (!file.open(QIODevice::ReadOnly)) {
+    return nullptr;
+  }
+  QByteArray data = file.readAll();
+  file.close();
+  PyObject* code = unmarshalCode(cacheFilename, data, 0);
+  if (code == Py_None) {
+    // written by a different Python version, it will be replaced
+    Py_DECREF(code);
+    code = nullptr;
+  } else if (!code) {
+    PyErr_Clear();
+  }
+  return code;
+}
+
+int PythonQtImport::populateBytecodeCache(const QStringList& paths)
+{
+  int count = 0;
+  Q_FOREACH(const QString& path, paths) {
+    QDirIterator it(QDir::cleanPath(path), QStringList() << "*.py", QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+      PyObject* code = getCodeFromData(it.next());
+      if (code) {
+        count++;
+        Py_DECREF(code);
+      } else {
+        PythonQt::self()->handleError();
+      }
+    }
+  }
+  return count;
+}
+
 time_t
 PythonQtImport::getMTimeOfSource(const QString& path)
 {
@@ -52,6 +52,7 @@
 
 #include <qobject.h>
 #include <qstring.h>
+#include <qstringlist.h>
 
 
 //! defines a python object that stores a Qt slot info
@@ -87,8 +88,12 @@ public:
   //! initialize
   static void init();
 
-  //! writes the python code to disk, marshalling and writing the time stamp
-  static void writeCompiledModule(PyCodeObject *co, const QString& filename, long mtime, long sourceSize);
+  //! writes the python code to disk, marshalling and writing the time stamp, returns false if the file could not be written
+  static bool writeCompiledModule(PyCodeObject *co, const QString& filename, long mtime, long sourceSize);
+
+  //! returns the contents of a pyc file for the given code object, in the format written by writeCompiledModule(),
+  //! returns an empty array and sets a Python error if the code object could not be marshalled
+  static QByteArray compiledModuleData(PyCodeObject *co, long mtime, long sourceSize);
 
   /*! Given the contents of a .py[co] file in a buffer, unmarshal the data
    and return the code object. Return None if it the magic word doesn't
@@ -138,6 +143,28 @@ public:
 
   //! Returns the filename of the source file for the given cache file, e.g. test.py for test.pyc.
   static QString getSourceFilename(const QString& cacheFile);
+
+  //! Sets the directory that stores the compiled code of sources whose *.pyc file can't be written next
+  //! to them (Qt resources and read-only locations), an empty path disables it. Creates the directory if needed.
+  static bool setBytecodeCacheDirectory(const QString& path);
+
+  //! Returns the bytecode cache directory (or an empty string)
+  static QString bytecodeCacheDirectory();
+
+  //! Returns the file in the bytecode cache directory for the given source path and content (or an empty string
+  //! if there is no cache directory). The name is a hash of both, so a changed source gets a new file.
+  static QString getBytecodeCacheFilename(const QString& sourcePath, const QByteArray& source);
+
+  //! Compiles all *.py files below the given directories (which may be Qt resource paths) like an import would,
+  //! which fills the bytecode cache for sources that can't get a *.pyc file next to them.
+  //! Returns the number of compiled files.
+  static int populateBytecodeCache(const QStringList& paths);
+
+private:
+  //! reads the code of the given cache file, returns NULL if it is missing or invalid
+  static PyObject* readCachedBytecode(const QString& cacheFilename);
+
+  static QString _bytecodeCacheDirectory;
 };
 
 #endif
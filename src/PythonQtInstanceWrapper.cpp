@@ -47,8 +47,65 @@
 #include "PythonQtProperty.h"
 #include "PythonQtClassInfo.h"
 #include "PythonQtConversion.h"
+#include "PythonQtErrorMessage.h"
+#include "PythonQtTrace.h"
+#include <QThread>
 
 
+//! objects with fewer children are searched linearly, without building a PythonQtChildIndex
+static const int PythonQtChildIndexMinimumChildren = 16;
+
+PythonQtChildIndex::PythonQtChildIndex(QObject* object)
+  : _object(object), _valid(false)
+{
+}
+
+QObject* PythonQtChildIndex::findChild(const QString& name)
+{
+  if (!_object) {
+    return nullptr;
+  }
+  const QObjectList& children = _object->children();
+  if (!_valid || !_indexedChildren.isSharedWith(children)) {
+    _children.clear();
+    _indexedChildren = children;
+    for (QObject* child : children) {
+      // a renamed child may match a different name, UniqueConnection avoids connecting twice on rebuild
+      connect(child, &QObject::objectNameChanged, this, &PythonQtChildIndex::invalidate, Qt::UniqueConnection);
+      QString childName = child->objectName();
+      if (!childName.isEmpty() && !_children.contains(childName)) {
+        // the first child with a given name wins, like in the linear search
+        _children.insert(childName, child);
+      }
+    }
+    _valid = true;
+  }
+  return _children.value(name);
+}
+
+//! renders the message of the AttributeError that is raised for a missing attribute
+class PythonQtMissingAttributeMessage : public PythonQtErrorMessageRenderer
+{
+public:
+  //! \c details is the text of the missing attribute callback, which is called when the error is raised
+  PythonQtMissingAttributeMessage(const QByteArray& className, PyObject* name, const QString& details)
+    : _className(className), _name(name), _details(details) {
+    Py_INCREF(_name);
+  }
+  ~PythonQtMissingAttributeMessage() override {
+    Py_DECREF(_name);
+  }
+
+  QString render() override {
+    return QString(_className) + " has no attribute named '" + PythonQtConv::PyObjGetString(_name) + "'" + _details;
+  }
+
+private:
+  QByteArray _className;
+  PyObject* _name;
+  QString _details;
+};
+
 static void PythonQtInstanceWrapper_deleteObject(PythonQtInstanceWrapper* self, bool force = false) {
 
   // is this a C++ wrapper?
@@ -117,9 +174,26 @@ static void PythonQtInstanceWrapper_deleteObject(PythonQtInstanceWrapper* self,
   self->_obj = nullptr;
 }
 
+//! deletes the child index of the wrapper, the wrapper may be released in another thread than the one of the index
+static void PythonQtInstanceWrapper_deleteChildIndex(PythonQtInstanceWrapper* self)
+{
+  if (self->_childIndex) {
+    if (self->_childIndex->thread() == QThread::currentThread()) {
+      delete self->_childIndex;
+    } else {
+      self->_childIndex->deleteLater();
+    }
+    self->_childIndex = nullptr;
+  }
+}
+
 static void PythonQtInstanceWrapper_dealloc(PythonQtInstanceWrapper* self)
 {
+  if (PythonQt::self()) {
+    PythonQt::priv()->wrapperDeleted(self);
+  }
   PythonQtInstanceWrapper_deleteObject(self);
+  PythonQtInstanceWrapper_deleteChildIndex(self);
   self->_obj.~QPointer<QObject>();
   Py_TYPE(self)->tp_free((PyObject*)self);
 }
@@ -142,6 +216,10 @@ static PyObject* PythonQtInstanceWrapper_new(PyTypeObject *type, PyObject * /*ar
     self->_useQMetaTypeDestroy = false;
     self->_isShellInstance = false;
     self->_shellInstanceRefCountsWrapper = false;
+    self->_childIndex = nullptr;
+    if (PythonQt::self()) {
+      PythonQt::priv()->wrapperCreated(self);
+    }
   }
   return (PyObject *)self;
 }
@@ -211,6 +289,25 @@ int PythonQtInstanceWrapper_init(PythonQtInstanceWrapper * self, PyObject * args
   return 0;
 }
 
+PyObject* PythonQtInstanceWrapper_callOperator(PythonQtInstanceWrapper* wrapper, PythonQtSlotInfo* slot, PythonQtSlotInfo* sameTypeOverload, PyObject* args)
+{
+  PythonQtClassInfo* classInfo = wrapper->classInfo();
+  if (sameTypeOverload) {
+    PyObject* other = PyTuple_GET_ITEM(args, 0);
+    if (PyObject_TypeCheck(other, &PythonQtInstanceWrapper_Type) && ((PythonQtInstanceWrapper*)other)->classInfo() == classInfo) {
+      // skip the overload resolution, the overload was chosen when the operator was looked up
+      PyObject* result = nullptr;
+      if (PythonQtCallSlot(classInfo, wrapper->_obj, args, true, sameTypeOverload, wrapper->_wrappedPtr, &result)) {
+        return result;
+      }
+      if (PyErr_Occurred()) {
+        return nullptr;
+      }
+    }
+  }
+  return PythonQtSlotFunction_CallImpl(classInfo, wrapper->_obj, slot, args, nullptr, wrapper->_wrappedPtr);
+}
+
 static PyObject *PythonQtInstanceWrapper_richcompare(PythonQtInstanceWrapper* wrapper, PyObject* other, int code)
 {
   bool validPtrs = false;
@@ -249,57 +346,34 @@ static PyObject *PythonQtInstanceWrapper_richcompare(PythonQtInstanceWrapper* wr
     return Py_NotImplemented;
   }
 
-  QByteArray memberName;
+  PythonQtClassInfo::Operator op = PythonQtClassInfo::Op_Eq;
   switch (code) {
   case Py_LT:
-    {
-      static QByteArray name = "__lt__";
-      memberName = name;
-    }
+    op = PythonQtClassInfo::Op_Lt;
     break;
-
   case Py_LE:
-    {
-      static QByteArray name = "__le__";
-      memberName = name;
-    }
+    op = PythonQtClassInfo::Op_Le;
     break;
-
   case Py_EQ:
-    {
-      static QByteArray name = "__eq__";
-      memberName = name;
-    }
+    op = PythonQtClassInfo::Op_Eq;
     break;
-
   case Py_NE:
-    {
-      static QByteArray name = "__ne__";
-      memberName = name;
-    }
+    op = PythonQtClassInfo::Op_Ne;
     break;
-
   case Py_GT:
-    {
-      static QByteArray name = "__gt__";
-      memberName = name;
-    }
+    op = PythonQtClassInfo::Op_Gt;
     break;
-
   case Py_GE:
-    {
-      static QByteArray name = "__ge__";
-      memberName = name;
-    }
+    op = PythonQtClassInfo::Op_Ge;
     break;
   }
 
-  PythonQtMemberInfo opSlot = wrapper->classInfo()->member(memberName);
-  if (opSlot._type == PythonQtMemberInfo::Slot) {
+  const PythonQtClassInfo::OperatorSlot& opSlot = wrapper->classInfo()->operatorSlot(op);
+  if (opSlot._slot) {
     PyObject* args = PyTuple_New(1);
     Py_INCREF(other);
     PyTuple_SET_ITEM(args, 0, other);
-    PyObject* result = PythonQtSlotFunction_CallImpl(wrapper->classInfo(), wrapper->_obj, opSlot._slot, args, nullptr, wrapper->_wrappedPtr);
+    PyObject* result = PythonQtInstanceWrapper_callOperator(wrapper, opSlot._slot, opSlot._sameTypeOverload, args);
     Py_DECREF(args);
     if (result == nullptr) {
       // special handling of EQ and NE, if call fails we just return EQ == false / NE == true.
@@ -373,6 +447,71 @@ static PyMethodDef PythonQtInstanceWrapper_methods[] = {
 };
 
 
+static PyObject* PythonQtInstanceWrapper_getDynamicProperty(PythonQtInstanceWrapper* wrapper, const char* attributeName)
+{
+  if (wrapper->_obj) {
+    // the static properties were already looked up on the class, property() returns an invalid
+    // variant if there is no dynamic property either, without copying the list of dynamic property names
+    QVariant v = wrapper->_obj->property(attributeName);
+    if (v.isValid()) {
+      return PythonQtConv::QVariantToPyObject(v);
+    }
+  }
+  return nullptr;
+}
+
+static QObject* PythonQtInstanceWrapper_findChild(PythonQtInstanceWrapper* wrapper, const char* attributeName)
+{
+  QObject* obj = wrapper->_obj;
+  const QObjectList& children = obj->children();
+  if (children.isEmpty()) {
+    return nullptr;
+  }
+  QString childName = QString::fromUtf8(attributeName);
+  if (children.count() < PythonQtChildIndexMinimumChildren || obj->thread() != QThread::currentThread()) {
+    for (QObject* child : children) {
+      if (child->objectName() == childName) {
+        return child;
+      }
+    }
+    return nullptr;
+  }
+  // the rename connections of the index are only direct in the thread of the object, so it is rebuilt after moveToThread()
+  if (!wrapper->_childIndex || wrapper->_childIndex->object() != obj || wrapper->_childIndex->thread() != obj->thread()) {
+    PythonQtInstanceWrapper_deleteChildIndex(wrapper);
+    wrapper->_childIndex = new PythonQtChildIndex(obj);
+  }
+  return wrapper->_childIndex->findChild(childName);
+}
+
+//! handles the per instance lookups of an attribute that was not found on the class
+static PyObject* PythonQtInstanceWrapper_getMissingAttribute(PythonQtInstanceWrapper* wrapper, PyObject* name, const char* attributeName, bool checkDynamicProperties)
+{
+  if (wrapper->_obj) {
+    if (checkDynamicProperties) {
+      PyObject* dynamicProperty = PythonQtInstanceWrapper_getDynamicProperty(wrapper, attributeName);
+      if (dynamicProperty) {
+        return dynamicProperty;
+      }
+    }
+    // look for a child
+    QObject* child = PythonQtInstanceWrapper_findChild(wrapper, attributeName);
+    if (child) {
+      return PythonQt::priv()->wrapQObject(child);
+    }
+  }
+
+  // the callback is called when the lookup fails, not when the message is rendered
+  QString details;
+  if (wrapper->_obj && PythonQt::self()) {
+    details = PythonQt::self()->qObjectMissingAttributeCallback(wrapper->_obj, QString::fromUtf8(attributeName));
+  }
+  // the message is only formatted if someone looks at it, hasattr() and getattr() with default don't
+  PythonQtErrorMessage_SetError(PythonQt::priv()->attributeErrorType(),
+    new PythonQtMissingAttributeMessage(wrapper->classInfo()->className(), name, details));
+  return nullptr;
+}
+
 static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
 {
   const char *attributeName;
@@ -478,7 +617,15 @@ static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
 
   //  mlabDebugConst("Python","get " << attributeName);
 
-  PythonQtMemberInfo member = wrapper->classInfo()->member(attributeName);
+  // attributes that already failed on the C++ side of the class only need the per instance checks,
+  // this makes hasattr()/getattr() with default cheap for missing attributes
+  PythonQtClassInfo* classInfo = wrapper->classInfo();
+  if (classInfo->isKnownMissingAttribute(attributeName)) {
+    return PythonQtInstanceWrapper_getMissingAttribute(wrapper, name, attributeName, true);
+  }
+
+  bool classHasDynamicGetter = false;
+  PythonQtMemberInfo member = classInfo->member(attributeName);
   switch (member._type) {
   case PythonQtMemberInfo::Property:
     if (wrapper->_obj) {
@@ -492,6 +639,11 @@ static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
           profilingCB(PythonQt::Enter, wrapper->_obj->metaObject()->className(), QStringToPythonConstCharPointer(methodName), nullptr);
         }
 
+        PythonQtTraceScope trace(PythonQtTrace::Properties);
+        if (trace.isEnabled()) {
+          trace.begin(wrapper->_obj->metaObject()->className(), member._property.name());
+        }
+
         PyObject* value = PythonQtConv::QVariantToPyObject(member._property.read(wrapper->_obj));
 
         if (profilingCB) {
@@ -545,6 +697,7 @@ static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
         // check for a dynamic getter slot
         PythonQtMemberInfo member = wrapper->classInfo()->member(dynamicGetterString);
         if (member._type == PythonQtMemberInfo::Slot) {
+          classHasDynamicGetter = true;
           PyObject* args = PyTuple_New(1);
           Py_INCREF(name);
           PyTuple_SET_ITEM(args, 0, name);
@@ -561,11 +714,9 @@ static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
       }
 
       // handle dynamic properties
-      if (wrapper->_obj) {
-        QVariant v = wrapper->_obj->property(attributeName);
-        if (v.isValid()) {
-          return PythonQtConv::QVariantToPyObject(v);
-        }
+      PyObject* dynamicProperty = PythonQtInstanceWrapper_getDynamicProperty(wrapper, attributeName);
+      if (dynamicProperty) {
+        return dynamicProperty;
       }
     }
     break;
@@ -585,24 +736,13 @@ static PyObject *PythonQtInstanceWrapper_getattro(PyObject *obj,PyObject *name)
   }
   PyErr_Clear();
 
-  if (wrapper->_obj) {
-    // look for a child
-    QObjectList children = wrapper->_obj->children();
-    for (int i = 0; i < children.count(); i++) {
-      QObject *child = children.at(i);
-      if (child->objectName() == attributeName) {
-        return PythonQt::priv()->wrapQObject(child);
-      }
-    }
-  }
-
-  QString error = QString(wrapper->classInfo()->className()) + " has no attribute named '" + QString(attributeName) + "'";
-  if (wrapper->_obj) {
-    error += PythonQt::self()->qObjectMissingAttributeCallback(wrapper->_obj, QString(attributeName));
+  if (member._type == PythonQtMemberInfo::NotFound && !classHasDynamicGetter) {
+    // nothing on the C++ side of the class can provide this attribute
+    classInfo->addKnownMissingAttribute(attributeName);
   }
-  PyErr_SetString(PyExc_AttributeError, QStringToPythonConstCharPointer(error));
 
-  return nullptr;
+  // dynamic properties were already checked for members that were not found
+  return PythonQtInstanceWrapper_getMissingAttribute(wrapper, name, attributeName, member._type != PythonQtMemberInfo::NotFound);
 }
 
 static int PythonQtInstanceWrapper_setattro(PyObject *obj,PyObject *name,PyObject *value)
@@ -643,6 +783,11 @@ static int PythonQtInstanceWrapper_setattro(PyObject *obj,PyObject *name,PyObjec
           profilingCB(PythonQt::Enter, wrapper->_obj->metaObject()->className(), QStringToPythonConstCharPointer(methodName), nullptr);
         }
 
+        PythonQtTraceScope trace(PythonQtTrace::Properties);
+        if (trace.isEnabled()) {
+          trace.begin(wrapper->_obj->metaObject()->className(), prop.name());
+        }
+
         success = prop.write(wrapper->_obj, v);
 
         if (profilingCB) {
@@ -47,13 +47,45 @@
 #include "PythonQtSystem.h"
 #include "PythonQtClassWrapper.h"
 #include <QPointer>
+#include <QObject>
+#include <QHash>
+#include <QString>
 
 #include "structmember.h"
 #include "methodobject.h"
 #include "compile.h"
 
 class PythonQtClassInfo;
-class QObject;
+class PythonQtSlotInfo;
+
+//---------------------------------------------------------------
+//! Maps the objectName of the children of a QObject to the child, used for attribute access to children.
+//! The index is rebuilt lazily after a child was added, removed or renamed. It keeps a shallow copy of the
+//! children list, adding or removing a child detaches the list of the object from the copy, which is checked
+//! on lookup, so that the object itself is not watched.
+class PythonQtChildIndex : public QObject
+{
+  Q_OBJECT
+
+public:
+  PythonQtChildIndex(QObject* object);
+
+  //! the object whose children are indexed
+  QObject* object() const { return _object; }
+
+  //! returns the first child with the given objectName or NULL
+  QObject* findChild(const QString& name);
+
+private Q_SLOTS:
+  void invalidate() { _valid = false; }
+
+private:
+  QPointer<QObject> _object;
+  //! the children list of the object when the index was built (shared with the object until it changes)
+  QObjectList _indexedChildren;
+  QHash<QString, QObject*> _children;
+  bool _valid;
+};
 
 extern PYTHONQT_EXPORT PyTypeObject PythonQtInstanceWrapper_Type;
 
@@ -125,10 +157,16 @@ struct PythonQtInstanceWrapper {
   //! stores if the shell instance (C++) owns the wrapper with its ref count
   bool _shellInstanceRefCountsWrapper;
 
+  //! index of the children by objectName, created on demand for objects with many children
+  PythonQtChildIndex* _childIndex;
+
 };
 
 int PythonQtInstanceWrapper_init(PythonQtInstanceWrapper * self, PyObject * args, PyObject * kwds);
 
+//! calls an operator slot, if the first argument is of the same class, the given sameTypeOverload is called directly
+PyObject* PythonQtInstanceWrapper_callOperator(PythonQtInstanceWrapper* wrapper, PythonQtSlotInfo* slot, PythonQtSlotInfo* sameTypeOverload, PyObject* args);
+
 PyObject *PythonQtInstanceWrapper_delete(PythonQtInstanceWrapper * self);
 
 #endif
@@ -41,11 +41,30 @@
 
 #include "PythonQtMethodInfo.h"
 #include "PythonQtClassInfo.h"
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
 #include <iostream>
 
 QHash<QByteArray, PythonQtMethodInfo*> PythonQtMethodInfo::_cachedSignatures;
 QHash<int, PythonQtMethodInfo::ParameterInfo> PythonQtMethodInfo::_cachedParameterInfos;
 QHash<QByteArray, QByteArray> PythonQtMethodInfo::_parameterNameAliases;
+QHash<QByteArray, QList<PythonQtMethodInfo::ParameterInfo> > PythonQtMethodInfo::_persistentSignatures;
+bool PythonQtMethodInfo::_persistentCacheModified = false;
+
+namespace {
+  const quint32 persistentCacheMagic = 0x50514d43; // "PQMC"
+  const quint32 persistentCacheFormatVersion = 1;
+
+  enum PersistentParameterFlags {
+    IsConst = 1,
+    IsReference = 2,
+    IsQList = 4,
+    PassOwnershipToCPP = 8,
+    PassOwnershipToPython = 16,
+    NewOwnerOfThis = 32
+  };
+}
 
 bool PythonQtSlotInfo::_globalShouldAllowThreads = false;
 
@@ -82,6 +101,15 @@ PythonQtMethodInfo::PythonQtMethodInfo(const QByteArray& typeName, const QList<Q
   setupAllowThreads();
 }
 
+PythonQtMethodInfo::PythonQtMethodInfo(const QList<ParameterInfo>& cachedParameters, PythonQtClassInfo* classInfo)
+{
+  _parameters = cachedParameters;
+  for (int i = 0; i < _parameters.size(); i++) {
+    resolveCachedParameterInfo(_parameters[i], classInfo);
+  }
+  setupAllowThreads();
+}
+
 void PythonQtMethodInfo::setupAllowThreads()
 {
   bool allowThreads = true;
@@ -102,7 +130,14 @@ const PythonQtMethodInfo* PythonQtMethodInfo::getCachedMethodInfo(const QMetaMet
   QByteArray fullSig = QByteArray(signal.typeName()) + " " + sig;
   PythonQtMethodInfo* result = _cachedSignatures.value(fullSig);
   if (!result) {
-    result = new PythonQtMethodInfo(signal, classInfo);
+    QHash<QByteArray, QList<ParameterInfo> >::iterator it = _persistentSignatures.find(fullSig);
+    if (it != _persistentSignatures.end()) {
+      result = new PythonQtMethodInfo(it.value(), classInfo);
+      _persistentSignatures.erase(it);
+    } else {
+      result = new PythonQtMethodInfo(signal, classInfo);
+      _persistentCacheModified = true;
+    }
     _cachedSignatures.insert(fullSig, result);
   }
   return result;
@@ -125,7 +160,14 @@ const PythonQtMethodInfo* PythonQtMethodInfo::getCachedMethodInfoFromArgumentLis
   fullSig += ")";
   PythonQtMethodInfo* result = _cachedSignatures.value(fullSig);
   if (!result) {
-    result = new PythonQtMethodInfo(typeName, arguments);
+    QHash<QByteArray, QList<ParameterInfo> >::iterator it = _persistentSignatures.find(fullSig);
+    if (it != _persistentSignatures.end()) {
+      result = new PythonQtMethodInfo(it.value(), nullptr);
+      _persistentSignatures.erase(it);
+    } else {
+      result = new PythonQtMethodInfo(typeName, arguments);
+      _persistentCacheModified = true;
+    }
     _cachedSignatures.insert(fullSig, result);
   }
   return result;
@@ -136,6 +178,7 @@ void PythonQtMethodInfo::fillParameterInfo(ParameterInfo& type, const QByteArray
   QByteArray name = orgName;
 
   type.enumWrapper = nullptr;
+  type.classInfo = nullptr;
   type.innerNamePointerCount = 0;
   type.isQList = false;
   type.passOwnershipToCPP = false;
@@ -419,6 +462,139 @@ void PythonQtMethodInfo::cleanupCachedMethodInfos()
   }
   _cachedSignatures.clear();
   _cachedParameterInfos.clear();
+  _persistentSignatures.clear();
+  _persistentCacheModified = false;
+}
+
+void PythonQtMethodInfo::resolveCachedParameterInfo(ParameterInfo& type, PythonQtClassInfo* classInfo)
+{
+  type.enumWrapper = nullptr;
+  type.classInfo = nullptr;
+  if (type.typeId == Unknown || type.typeId >= QMetaType::User) {
+    // user type ids depend on the registration order, so they need to be looked up again
+    type.typeId = nameToType(type.name);
+    if (type.typeId == Unknown) {
+      type.typeId = QMetaType::type(type.name.constData());
+#if( QT_VERSION >= QT_VERSION_CHECK(5,0,0) )
+      if (type.typeId == QMetaType::UnknownType) {
+#else
+      if (type.typeId == QMetaType::Void) {
+#endif
+        type.typeId = Unknown;
+      }
+    }
+    if (type.typeId == Unknown || type.typeId >= QMetaType::User) {
+      bool isLocalEnum;
+      type.enumWrapper = PythonQtClassInfo::findEnumWrapper(type.name, classInfo, &isLocalEnum);
+    }
+  }
+}
+
+QByteArray PythonQtMethodInfo::persistentCacheBuildId(const QByteArray& applicationBuildId)
+{
+  QByteArray id = applicationBuildId;
+  id += "|Qt " QT_VERSION_STR "/";
+  id += qVersion();
+  id += "|Python " + QByteArray::number(PY_VERSION_HEX, 16);
+  id += "|PythonQt " PYTHONQT_VERSION_STR;
+  id += "|" + QByteArray::number(QT_POINTER_SIZE);
+  return id;
+}
+
+bool PythonQtMethodInfo::loadPersistentCache(const QString& fileName, const QByteArray& buildId)
+{
+  QFile file(fileName);
+  if (!file.open(QIODevice::ReadOnly)) {
+    return false;
+  }
+  QDataStream stream(&file);
+  stream.setVersion(QDataStream::Qt_5_0);
+  quint32 magic = 0;
+  quint32 version = 0;
+  QByteArray fileBuildId;
+  stream >> magic >> version >> fileBuildId;
+  if (magic != persistentCacheMagic || version != persistentCacheFormatVersion || fileBuildId != buildId) {
+    return false;
+  }
+  quint32 count = 0;
+  stream >> count;
+  QHash<QByteArray, QList<ParameterInfo> > signatures;
+  signatures.reserve(count);
+  for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; i++) {
+    QByteArray sig;
+    quint8 numParameters = 0;
+    stream >> sig >> numParameters;
+    QList<ParameterInfo> parameters;
+    for (quint8 j = 0; j < numParameters; j++) {
+      ParameterInfo type;
+      qint32 typeId;
+      qint8 pointerCount, innerNamePointerCount;
+      quint8 flags;
+      stream >> type.name >> type.innerName >> typeId >> pointerCount >> innerNamePointerCount >> flags;
+      type.enumWrapper = nullptr;
+      type.classInfo = nullptr;
+      type.typeId = typeId;
+      type.pointerCount = pointerCount;
+      type.innerNamePointerCount = innerNamePointerCount;
+      type.isConst = (flags & IsConst) != 0;
+      type.isReference = (flags & IsReference) != 0;
+      type.isQList = (flags & IsQList) != 0;
+      type.passOwnershipToCPP = (flags & PassOwnershipToCPP) != 0;
+      type.passOwnershipToPython = (flags & PassOwnershipToPython) != 0;
+      type.newOwnerOfThis = (flags & NewOwnerOfThis) != 0;
+      parameters.append(type);
+    }
+    signatures.insert(sig, parameters);
+  }
+  if (stream.status() != QDataStream::Ok) {
+    std::cerr << "PythonQt: ignoring corrupt method info cache " << fileName.toLocal8Bit().constData() << std::endl;
+    return false;
+  }
+  for (QHash<QByteArray, QList<ParameterInfo> >::const_iterator it = signatures.constBegin(); it != signatures.constEnd(); ++it) {
+    if (!_cachedSignatures.contains(it.key())) {
+      _persistentSignatures.insert(it.key(), it.value());
+    }
+  }
+  return true;
+}
+
+bool PythonQtMethodInfo::savePersistentCache(const QString& fileName, const QByteArray& buildId)
+{
+  if (!_persistentCacheModified && QFile::exists(fileName)) {
+    return true;
+  }
+  QSaveFile file(fileName);
+  if (!file.open(QIODevice::WriteOnly)) {
+    return false;
+  }
+  QDataStream stream(&file);
+  stream.setVersion(QDataStream::Qt_5_0);
+  stream << persistentCacheMagic << persistentCacheFormatVersion << buildId;
+  stream << quint32(_cachedSignatures.size() + _persistentSignatures.size());
+
+  QList<QPair<QByteArray, const QList<ParameterInfo>*> > entries;
+  for (QHash<QByteArray, PythonQtMethodInfo*>::const_iterator it = _cachedSignatures.constBegin(); it != _cachedSignatures.constEnd(); ++it) {
+    entries << qMakePair(it.key(), &it.value()->parameters());
+  }
+  // keep the signatures of the last session that have not been used in this session
+  for (QHash<QByteArray, QList<ParameterInfo> >::const_iterator it = _persistentSignatures.constBegin(); it != _persistentSignatures.constEnd(); ++it) {
+    entries << qMakePair(it.key(), &it.value());
+  }
+  for (int i = 0; i < entries.size(); i++) {
+    const QList<ParameterInfo>& parameters = *entries.at(i).second;
+    stream << entries.at(i).first << quint8(parameters.size());
+    for (const ParameterInfo& type : parameters) {
+      quint8 flags = (type.isConst ? IsConst : 0) | (type.isReference ? IsReference : 0) | (type.isQList ? IsQList : 0) |
+        (type.passOwnershipToCPP ? PassOwnershipToCPP : 0) | (type.passOwnershipToPython ? PassOwnershipToPython : 0) |
+        (type.newOwnerOfThis ? NewOwnerOfThis : 0);
+      stream << type.name << type.innerName << qint32(type.typeId) << qint8(type.pointerCount) << qint8(type.innerNamePointerCount) << flags;
+    }
+  }
+  if (!file.commit()) {
+    return false;
+  }
+  _persistentCacheModified = false;
+  return true;
 }
 
 void PythonQtMethodInfo::addParameterTypeAlias(const QByteArray& alias, const QByteArray& name)
@@ -435,6 +611,34 @@ void PythonQtMethodInfo::addParameterTypeAlias(const QByteArray& alias, const QB
 #endif
 }
 
+qint64 PythonQtMethodInfo::parametersMemoryUsage(const QList<ParameterInfo>& parameters)
+{
+  qint64 size = 0;
+  for (const ParameterInfo& type : parameters) {
+    // QList stores large types as pointers to heap allocated nodes
+    size += sizeof(void*) + sizeof(ParameterInfo) + type.name.capacity() + type.innerName.capacity();
+  }
+  return size;
+}
+
+qint64 PythonQtMethodInfo::cachedMethodInfosMemoryUsage()
+{
+  // a hash node holds the key, the value, the next pointer and the hash value
+  const qint64 nodeSize = sizeof(void*) + sizeof(uint);
+  qint64 size = 0;
+  for (QHash<QByteArray, PythonQtMethodInfo*>::const_iterator it = _cachedSignatures.constBegin(); it != _cachedSignatures.constEnd(); ++it) {
+    size += nodeSize + sizeof(QByteArray) + it.key().capacity() + sizeof(void*);
+    size += sizeof(PythonQtMethodInfo) + parametersMemoryUsage(it.value()->_parameters);
+  }
+  for (QHash<int, ParameterInfo>::const_iterator it = _cachedParameterInfos.constBegin(); it != _cachedParameterInfos.constEnd(); ++it) {
+    size += nodeSize + sizeof(int) + sizeof(ParameterInfo) + it.value().name.capacity() + it.value().innerName.capacity();
+  }
+  for (QHash<QByteArray, QList<ParameterInfo> >::const_iterator it = _persistentSignatures.constBegin(); it != _persistentSignatures.constEnd(); ++it) {
+    size += nodeSize + sizeof(QByteArray) + it.key().capacity() + parametersMemoryUsage(it.value());
+  }
+  return size;
+}
+
 const PythonQtMethodInfo::ParameterInfo& PythonQtMethodInfo::getParameterInfoForMetaType(int type)
 {
   QHash<int, ParameterInfo>::ConstIterator it = _cachedParameterInfos.find(type);
@@ -461,17 +665,23 @@ void PythonQtSlotInfo::deleteOverloadsAndThis()
 
 
 QString PythonQtSlotInfo::fullSignature(bool skipReturnValue, int optionalArgsIndex) const
-{ 
-  int firstArgOffset = isInstanceDecorator()?2:1;
+{
+  return fullSignature(_meta, _parameters, _type, isInstanceDecorator(), skipReturnValue, optionalArgsIndex);
+}
+
+QString PythonQtSlotInfo::fullSignature(const QMetaMethod& meta, const QList<ParameterInfo>& parameters, Type type, bool isInstanceDecorator,
+  bool skipReturnValue, int optionalArgsIndex)
+{
+  int firstArgOffset = isInstanceDecorator?2:1;
   QString result;
-  QByteArray sig = slotName();
-  QList<QByteArray> names = _meta.parameterNames();
+  QByteArray sig = PythonQtUtils::methodName(meta);
+  QList<QByteArray> names = meta.parameterNames();
 
   bool isStatic = false;
   bool isConstructor = false;
   bool isDestructor = false;
 
-  if (_type == ClassDecorator) {
+  if (type == ClassDecorator) {
     if (sig.startsWith("new_")) {
       sig = sig.mid(4);
       isConstructor = true;
@@ -495,24 +705,24 @@ QString PythonQtSlotInfo::fullSignature(bool skipReturnValue, int optionalArgsIn
   result += sig;
   result += "(";
 
-  for (int i = firstArgOffset; i<_parameters.count(); i++) {
+  for (int i = firstArgOffset; i<parameters.count(); i++) {
     if ((optionalArgsIndex + firstArgOffset) == i) {
       result += " [";
     }
     if (i!=firstArgOffset) {
       result += ", ";
     }
-    //if (_parameters.at(i).isConst) {
+    //if (parameters.at(i).isConst) {
     //  result += "const ";
     //}
-    if (_parameters.at(i).name == "bool" && _parameters.at(i).pointerCount == 1) {
+    if (parameters.at(i).name == "bool" && parameters.at(i).pointerCount == 1) {
       result += "PythonQt.BoolResult";
     } else {
-      result += _parameters.at(i).name;
+      result += parameters.at(i).name;
     }
-    //if (_parameters.at(i).pointerCount) {
+    //if (parameters.at(i).pointerCount) {
     //  QByteArray stars;
-    //  stars.fill('*', _parameters.at(i).pointerCount);
+    //  stars.fill('*', parameters.at(i).pointerCount);
     //  result += stars;
     //}
     if (!names.at(i-1).isEmpty()) {
@@ -536,9 +746,9 @@ QString PythonQtSlotInfo::fullSignature(bool skipReturnValue, int optionalArgsIn
   } 
 
   if (!skipReturnValue) {
-    if (!_parameters.at(0).name.isEmpty()) {
+    if (!parameters.at(0).name.isEmpty()) {
       result += " -> ";
-      result += _parameters.at(0).name;
+      result += parameters.at(0).name;
     }
   }
   return result;
@@ -662,9 +872,16 @@ QByteArray PythonQtSlotInfo::getImplementingClassName() const
 
 void PythonQtSlotInfo::invokeQtMethod(QObject* obj, PythonQtSlotInfo* slot, void** args)
 {
+  PythonQtSlotThunkCB* thunk = slot->thunk();
   if (slot->shouldAllowThreads() && _globalShouldAllowThreads) {
     PYTHONQT_ALLOW_THREADS_SCOPE
-    obj->qt_metacall(QMetaObject::InvokeMetaMethod, slot->slotIndex(), args);
+    if (thunk) {
+      (*thunk)(obj, args);
+    } else {
+      obj->qt_metacall(QMetaObject::InvokeMetaMethod, slot->slotIndex(), args);
+    }
+  } else if (thunk) {
+    (*thunk)(obj, args);
   } else {
     obj->qt_metacall(QMetaObject::InvokeMetaMethod, slot->slotIndex(), args);
   }
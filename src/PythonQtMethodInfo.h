@@ -68,6 +68,7 @@ public:
     QByteArray name;
     QByteArray innerName; // if the type is a template, this stores the inner name
     PyObject*  enumWrapper; // if it is an enum, a pointer to the enum wrapper
+    mutable PythonQtClassInfo* classInfo; // the class info of a wrapped type, resolved on the first wrapper argument that can be casted to it
     int  typeId; // a mixture from QMetaType and ParameterType
     char pointerCount; // the number of pointer indirections
     char innerNamePointerCount; // the number of pointer indirections in the inner name
@@ -100,6 +101,32 @@ public:
   //! cleanup the cache
   static void cleanupCachedMethodInfos();
 
+  //! returns the id that a persistent cache file needs to match, it is made up of the Qt, Python and PythonQt
+  //! versions and the given application build id (which should change when the wrapped classes change)
+  static QByteArray persistentCacheBuildId(const QByteArray& applicationBuildId = QByteArray());
+
+  //! loads the parsed signatures of a previous session from the given file, they are used
+  //! instead of parsing the signatures again. Returns false if the file can't be read or if it was written
+  //! for a different buildId.
+  static bool loadPersistentCache(const QString& fileName, const QByteArray& buildId);
+
+  //! writes all parsed signatures to the given file (if new signatures have been parsed since loading)
+  static bool savePersistentCache(const QString& fileName, const QByteArray& buildId);
+
+  //! returns the approximate number of bytes held by the cached method and parameter infos
+  static qint64 cachedMethodInfosMemoryUsage();
+
+  //! returns the number of cached method infos (by signature)
+  static int cachedSignatureCount() { return _cachedSignatures.size(); }
+
+  //! returns the number of signatures loaded from the persistent cache that have not been used yet
+  static int persistentSignatureCount() { return _persistentSignatures.size(); }
+  //! returns the number of cached parameter infos (by meta type id)
+  static int cachedParameterInfoCount() { return _cachedParameterInfos.size(); }
+
+  //! returns the approximate number of bytes held by the given parameter list (without sharing)
+  static qint64 parametersMemoryUsage(const QList<ParameterInfo>& parameters);
+
   //! returns the number of parameters including the return value
   int  parameterCount() const { return _parameters.size(); };
 
@@ -133,6 +160,13 @@ public:
   bool shouldAllowThreads() const { return _shouldAllowThreads; }
 
 protected:
+  //! creates the method info from parameters that were read from the persistent cache
+  PythonQtMethodInfo(const QList<ParameterInfo>& cachedParameters, PythonQtClassInfo* classInfo);
+
+  //! resolves the parts of a cached parameter info that are only valid in the current session
+  //! (user type ids and enum wrappers)
+  static void resolveCachedParameterInfo(ParameterInfo& type, PythonQtClassInfo* classInfo);
+
   void setupAllowThreads();
 
   static QHash<QByteArray, int> _parameterTypeDict;
@@ -143,11 +177,27 @@ protected:
 
   static QHash<int, ParameterInfo> _cachedParameterInfos;
 
+  //! parsed signatures that were loaded from the persistent cache, but have not been requested yet
+  static QHash<QByteArray, QList<ParameterInfo> > _persistentSignatures;
+  //! set if signatures were parsed that are not in the persistent cache yet
+  static bool _persistentCacheModified;
+
   QList<ParameterInfo> _parameters;
   bool _shouldAllowThreads;
 
 };
 
+//! a direct call thunk of a wrapper slot, gets the object and the argument list in the qt_metacall layout
+typedef void PythonQtSlotThunkCB(QObject* object, void** args);
+
+//! entry of a (generated) table that maps a slot signature of a wrapper class to its direct call thunk,
+//! tables are terminated by an entry with a nullptr signature
+struct PythonQtSlotThunkEntry
+{
+  const char* signature;
+  PythonQtSlotThunkCB* thunk;
+};
+
 //! stores information about a slot, including a next pointer to overloaded slots
 class PYTHONQT_EXPORT PythonQtSlotInfo : public PythonQtMethodInfo
 {
@@ -165,6 +215,8 @@ public:
     _decorator = info._decorator;
     _type = info._type;
     _upcastingOffset = 0;
+    _thunk = info._thunk;
+    _cachedInfo = info._cachedInfo;
   }
 
   PythonQtSlotInfo(PythonQtClassInfo* classInfo, const QMetaMethod& meta, int slotIndex, QObject* decorator = nullptr, Type type = MemberSlot ):PythonQtMethodInfo()
@@ -178,6 +230,8 @@ public:
     _decorator = decorator;
     _type = type;
     _upcastingOffset = 0;
+    _thunk = nullptr;
+    _cachedInfo = info;
   }
 
 
@@ -196,6 +250,12 @@ public:
   //! get the index of the slot (needed for qt_metacall)
   int slotIndex() const { return _slotIndex; }
 
+  //! set a direct call thunk that is used instead of qt_metacall
+  void setThunk(PythonQtSlotThunkCB* thunk) { _thunk = thunk; }
+
+  //! get the direct call thunk, may be nullptr
+  PythonQtSlotThunkCB* thunk() const { return _thunk; }
+
   //! get next overloaded slot (which has the same name)
   PythonQtSlotInfo* nextInfo()  const { return _next; }
 
@@ -210,9 +270,17 @@ public:
 
   QObject* decorator() const { return _decorator; }
 
+  //! get the shared method info of the signature, it is valid until PythonQt::cleanup()
+  const PythonQtMethodInfo* cachedMethodInfo() const { return _cachedInfo; }
+
   //! get the full signature including return type
   QString fullSignature(bool skipReturnValue = false, int optionalArgsIndex = -1) const;
 
+  //! get the full signature of the given method, this allows to render the signature of a slot info
+  //! that may be deleted in the meantime (using its meta method and cached method info)
+  static QString fullSignature(const QMetaMethod& meta, const QList<ParameterInfo>& parameters, Type type, bool isInstanceDecorator,
+    bool skipReturnValue = false, int optionalArgsIndex = -1);
+
   //! get the Qt signature of the slot
   QByteArray signature() const;
 
@@ -244,6 +312,8 @@ private:
   Type              _type;
   QMetaMethod       _meta;
   int               _upcastingOffset;
+  PythonQtSlotThunkCB* _thunk;
+  const PythonQtMethodInfo* _cachedInfo;
 
   static bool _globalShouldAllowThreads;
 };
@@ -97,6 +97,11 @@ QVariant PythonQtObjectPtr::call(const QVariantList& args, const QVariantMap& kw
   return PythonQt::self()->call(_object, args, kwargs);
 }
 
+int PythonQtObjectPtr::callBatch(const QVector<QVariantList>& argsList, QVector<QVariant>& results, QStringList* errors, int yieldInterval)
+{
+  return PythonQt::self()->callBatch(_object, argsList, results, errors, yieldInterval);
+}
+
 PythonQtObjectPtr::PythonQtObjectPtr(PyObject* o)
 {
   Py_XINCREF(o);
@@ -171,20 +176,42 @@ PythonQtSafeObjectPtr::PythonQtSafeObjectPtr(PyObject* o)
 PythonQtSafeObjectPtr::~PythonQtSafeObjectPtr()
 {
   if (_object) {
-    PYTHONQT_GIL_SCOPE
-    Py_DECREF(_object);
+    releaseObject(_object);
   }
 }
 
 void PythonQtSafeObjectPtr::setObject(PyObject* o)
 {
   if (o != _object) {
+    if (!o) {
+      // releasing does not need to wait for the GIL
+      PyObject* old = _object;
+      _object = nullptr;
+      releaseObject(old);
+      return;
+    }
     PYTHONQT_GIL_SCOPE
     Py_XINCREF(o);
     Py_XSETREF(_object, o);
   }
 }
 
+void PythonQtSafeObjectPtr::releaseObject(PyObject* o)
+{
+#if defined(PYTHONQT_GIL_SUPPORT) && defined(PY3K)
+  if (!PythonQtGILScope::currentThreadHoldsGIL()) {
+    // don't block on the GIL, the decref is done by the next thread that enters Python
+    PythonQtDeferredDecref::push(o);
+    return;
+  }
+  PythonQtDeferredDecref::drain();
+  Py_DECREF(o);
+#else
+  PYTHONQT_GIL_SCOPE
+  Py_DECREF(o);
+#endif
+}
+
 void PythonQtSafeObjectPtr::setObjectUnsafe(PyObject* o)
 {
   if (o != _object) {
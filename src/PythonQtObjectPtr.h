@@ -49,6 +49,8 @@
 #include <QVariant>
 #include <QVariantList>
 #include <QVariantMap>
+#include <QVector>
+#include <QStringList>
 
 class PythonQtSafeObjectPtr;
 
@@ -177,6 +179,9 @@ public:
   //! call the contained python object directly, returns the result converted to a QVariant
   QVariant call(const QVariantList& args = QVariantList(), const QVariantMap& kwargs = QVariantMap());
 
+  //! call the contained python object once for each entry of \c argsList under one GIL acquisition (see PythonQt::callBatch())
+  int callBatch(const QVector<QVariantList>& argsList, QVector<QVariant>& results, QStringList* errors = nullptr, int yieldInterval = 0);
+
   //! takes the object from the pointer, leaving the pointer empty.
   //! the caller has to take care about the decref of the taken object!
   PyObject* takeObject() {
@@ -299,6 +304,9 @@ protected:
   void setObjectUnsafe(PyObject* o);
 
 private:
+  //! decrefs o, or queues the decref with PythonQtDeferredDecref if the current thread does not hold the GIL
+  static void releaseObject(PyObject* o);
+
   PyObject* _object;
 };
 
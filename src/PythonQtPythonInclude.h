@@ -90,6 +90,7 @@
 #define PyString_AS_STRING  PyUnicode_AsUTF8
 #define PyString_AsString   PyUnicode_AsUTF8
 #define PyString_FromFormat PyUnicode_FromFormat
+#define PyString_InternFromString PyUnicode_InternFromString
 #define PyString_Check      PyUnicode_Check
 
 #define PyInt_Type     PyLong_Type
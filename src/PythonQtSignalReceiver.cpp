@@ -43,15 +43,19 @@
 #include "PythonQtClassInfo.h"
 #include "PythonQtMethodInfo.h"
 #include "PythonQtConversion.h"
+#include "PythonQtTrace.h"
+#include "PythonQtCallRecorder.h"
+#include "PythonQtUtils.h"
+#include <QCoreApplication>
 #include <QMetaObject>
 #include <QMetaMethod>
 
 // use -2 to signal that the variable is uninitialized
-int PythonQtSignalReceiver::_destroyedSignal1Id = -2;
-int PythonQtSignalReceiver::_destroyedSignal2Id = -2;
+int PythonQtSignalDispatcher::_destroyedSignal1Id = -2;
+int PythonQtSignalDispatcher::_destroyedSignal2Id = -2;
 
 void PythonQtSignalTarget::call(void **arguments) const {
-  PYTHONQT_GIL_SCOPE
+  PYTHONQT_GIL_SITE_SCOPE("PythonQtSignalTarget::call")
   PyObject* result = call(_callable, methodInfo(), arguments);
   if (result) {
     PythonQt::priv()->checkAndRunCoroutine(result);
@@ -59,9 +63,43 @@ void PythonQtSignalTarget::call(void **arguments) const {
   }
 }
 
+//! returns the class name of the bound object and the function name of a Python callable
+static void PythonQtSignalTarget_callableNames(PyObject* callable, QByteArray& className, QByteArray& name)
+{
+  PyObject* function = callable;
+  if (PyMethod_Check(callable)) {
+    PyMethodObject* method = (PyMethodObject*)callable;
+    if (method->im_self) {
+      className = Py_TYPE(method->im_self)->tp_name;
+    }
+    function = method->im_func;
+  }
+  PyObject* nameObject = PyObject_GetAttrString(function, "__name__");
+  if (nameObject) {
+    name = PythonQtConv::PyObjGetString(nameObject).toUtf8();
+    Py_DECREF(nameObject);
+  } else {
+    PyErr_Clear();
+  }
+}
+
 PyObject* PythonQtSignalTarget::call(PyObject* callable, const PythonQtMethodInfo* methodInfos, void **arguments, bool skipFirstArgumentOfMethodInfo)
 {
-  Q_UNUSED(skipFirstArgumentOfMethodInfo)
+  // only the generated shell classes skip the first argument, they call Python overrides of virtual methods
+  PythonQtTraceScope trace(PythonQtTrace::Virtuals);
+  if (skipFirstArgumentOfMethodInfo && trace.isEnabled()) {
+    QByteArray className;
+    QByteArray name;
+    PythonQtSignalTarget_callableNames(callable, className, name);
+    trace.begin(className.constData(), name.constData());
+  }
+  if (PythonQtCallRecorder::isRecording()) {
+    QByteArray className;
+    QByteArray name;
+    PythonQtSignalTarget_callableNames(callable, className, name);
+    PythonQtCallRecorder::record(skipFirstArgumentOfMethodInfo ? PythonQtRecordedCall::VirtualCall : PythonQtRecordedCall::SignalDispatch,
+      className, name, methodInfos, arguments);
+  }
 
   // Note: we check if the callable is a PyFunctionObject and has a fixed number of arguments
   // if that is the case, we only pass these arguments to python and skip the additional arguments from the signal
@@ -149,7 +187,7 @@ bool PythonQtSignalTarget::isSame( int signalId, PyObject* callable ) const
 
 //------------------------------------------------------------------------------
 
-PythonQtSignalReceiver::PythonQtSignalReceiver(QObject* obj):PythonQtSignalReceiverBase(obj)
+PythonQtSignalDispatcher::PythonQtSignalDispatcher():PythonQtSignalReceiverBase(nullptr)
 {
   if (_destroyedSignal1Id == -2) {
     // initialize these once
@@ -160,128 +198,292 @@ PythonQtSignalReceiver::PythonQtSignalReceiver(QObject* obj):PythonQtSignalRecei
     }
   }
 
-  _destroyedSignalCount = 0;
-  _obj = obj;
+  _destroyedSlotId = staticMetaObject.methodOffset();
+  _nextSlotId = _destroyedSlotId + 1;
+}
+
+PythonQtSignalDispatcher::~PythonQtSignalDispatcher()
+{
+  // we need the GIL scope here, because the targets keep references to Python objects
+  PYTHONQT_GIL_SCOPE;
+  _connections.clear();
+  _senders.clear();
+}
+
+bool PythonQtSignalDispatcher::addSignalHandler(QObject* obj, const char* signal, PyObject* callable)
+{
+  int sigId = getSignalIndex(obj, signal);
+  if (sigId<0) {
+    return false;
+  }
 
   // fetch the class info for object, since we will need to for correct enum resolution in
   // signals
-  _objClassInfo = PythonQt::priv()->getClassInfo(obj->metaObject());
-  if (!_objClassInfo || !_objClassInfo->isQObject()) {
+  PythonQtClassInfo* objClassInfo = PythonQt::priv()->getClassInfo(obj->metaObject());
+  if (!objClassInfo || !objClassInfo->isQObject()) {
     PythonQt::self()->registerClass(obj->metaObject());
-    _objClassInfo = PythonQt::priv()->getClassInfo(obj->metaObject());
+    objClassInfo = PythonQt::priv()->getClassInfo(obj->metaObject());
   }
   // force decorator/enum creation
-  _objClassInfo->decorator();
+  objClassInfo->decorator();
+
+  // create PythonQtMethodInfo from signal
+  QMetaMethod meta = obj->metaObject()->method(sigId);
+  const PythonQtMethodInfo* signalInfo = PythonQtMethodInfo::getCachedMethodInfo(meta, objClassInfo);
 
-  _slotCount = staticMetaObject.methodOffset();
+  PYTHONQT_GIL_SCOPE;
+  addConnection(obj, PythonQtSignalTarget(sigId, signalInfo, _nextSlotId, callable));
+  return true;
 }
 
-PythonQtSignalReceiver::~PythonQtSignalReceiver()
+void PythonQtSignalDispatcher::addSignalHandler(QObject* obj, const PythonQtSignalTarget& target)
 {
-  // we need the GIL scope here, because the targets keep references to Python objects
   PYTHONQT_GIL_SCOPE;
-  PythonQt::priv()->removeSignalEmitter(_obj);
-  _targets.clear();
+  addConnection(obj, PythonQtSignalTarget(target.signalId(), target.methodInfo(), _nextSlotId, target.callable()));
 }
 
+void PythonQtSignalDispatcher::addConnection(QObject* obj, const PythonQtSignalTarget& target)
+{
+  QHash<QObject*, QVector<int> >::iterator senderIt = _senders.find(obj);
+  if (senderIt == _senders.end()) {
+    // track the deletion of the sender, this is connected before any of its Python handlers,
+    // so it is called before the Python destroyed() handlers
+    QMetaObject::connect(obj, _destroyedSignal2Id, this, _destroyedSlotId, Qt::DirectConnection, nullptr);
+    // follow the sender when it is moved to another thread
+    obj->installEventFilter(this);
+    senderIt = _senders.insert(obj, QVector<int>());
+  }
+
+  int slotId = _nextSlotId++;
+  Connection& connection = _connections[slotId];
+  connection._sender = obj;
+  connection._senderMetaObject = obj->metaObject();
+  connection._target = target;
+  senderIt->append(slotId);
+
+  // now connect to ourselves with the new slot id
+  QMetaObject::connect(obj, target.signalId(), this, slotId, _movingSenders.contains(obj) ? Qt::DirectConnection : Qt::AutoConnection, nullptr);
+}
 
-bool PythonQtSignalReceiver::addSignalHandler(const char* signal, PyObject* callable)
+QList<PythonQtSignalTarget> PythonQtSignalDispatcher::takeSignalHandlers(QObject* obj)
 {
-  bool flag = false;
-  int sigId = getSignalIndex(signal);
-  if (sigId>=0) {
-    // create PythonQtMethodInfo from signal
-    QMetaMethod meta = _obj->metaObject()->method(sigId);
-    const PythonQtMethodInfo* signalInfo = PythonQtMethodInfo::getCachedMethodInfo(meta, _objClassInfo);
-    PythonQtSignalTarget t(sigId, signalInfo, _slotCount, callable);
-    _targets.append(t);
-    // now connect to ourselves with the new slot id
-    QMetaObject::connect(_obj, sigId, this, _slotCount, Qt::AutoConnection, nullptr);
-
-    _slotCount++;
-    flag = true;
-
-    if (sigId == _destroyedSignal1Id || sigId == _destroyedSignal2Id) {
-      _destroyedSignalCount++;
-      if (_destroyedSignalCount==1) {
-        // make ourself parent of PythonQt, to not get deleted as a child of the QObject we are
-        // listening to, since we do that manually when we receive the destroyed signal
-        this->setParent(PythonQt::priv());
-      }
+  PYTHONQT_GIL_SCOPE;
+  QList<PythonQtSignalTarget> targets;
+  // copy the slot ids, since removeConnection() modifies the list of the sender
+  const QVector<int> slotIds = _senders.value(obj);
+  for (int slotId : slotIds) {
+    QHash<int, Connection>::const_iterator it = _connections.constFind(slotId);
+    if (it != _connections.constEnd()) {
+      targets << it->_target;
+      removeConnection(slotId, true);
     }
   }
-  return flag;
+  return targets;
 }
 
-bool PythonQtSignalReceiver::removeSignalHandler(const char* signal, PyObject* callable)
+bool PythonQtSignalDispatcher::removeSignalHandler(QObject* obj, const char* signal, PyObject* callable)
 {
+  int sigId = getSignalIndex(obj, signal);
+  if (sigId<0) {
+    return false;
+  }
+
+  PYTHONQT_GIL_SCOPE;
+  QHash<QObject*, QVector<int> >::const_iterator senderIt = _senders.constFind(obj);
+  if (senderIt == _senders.constEnd()) {
+    return false;
+  }
+  // copy the slot ids, since removeConnection() modifies the list of the sender
+  const QVector<int> slotIds = senderIt.value();
   int foundCount = 0;
-  int sigId = getSignalIndex(signal);
-  if (sigId>=0) {
-    QMutableListIterator<PythonQtSignalTarget> i(_targets);
-    if (callable) {
-      while (i.hasNext()) {
-        if (i.next().isSame(sigId, callable)) {
-          QMetaObject::disconnect(_obj, sigId, this, i.value().slotId());
-          i.remove();
-          foundCount++;
-          break;
-        }
+  for (int slotId : slotIds) {
+    QHash<int, Connection>::const_iterator it = _connections.constFind(slotId);
+    if (it == _connections.constEnd()) {
+      continue;
+    }
+    if (callable ? it->_target.isSame(sigId, callable) : (it->_target.signalId() == sigId)) {
+      removeConnection(slotId, true);
+      foundCount++;
+      if (callable) {
+        break;
       }
+    }
+  }
+  return foundCount>0;
+}
+
+void PythonQtSignalDispatcher::removeConnection(int slotId, bool disconnect)
+{
+  QHash<int, Connection>::iterator it = _connections.find(slotId);
+  if (it == _connections.end()) {
+    return;
+  }
+  QObject* obj = it->_sender;
+  bool senderDeleted = it->_removeAfterCall;
+  if (disconnect) {
+    QMetaObject::disconnect(obj, it->_target.signalId(), this, slotId);
+  }
+  _connections.erase(it);
+
+  if (senderDeleted) {
+    // the sender was already forgotten in senderDestroyed(), its address may even be used
+    // by a new sender
+    deleteIfUnused();
+    return;
+  }
+  QHash<QObject*, QVector<int> >::iterator senderIt = _senders.find(obj);
+  if (senderIt != _senders.end()) {
+    senderIt->removeOne(slotId);
+    if (senderIt->isEmpty()) {
+      _senders.erase(senderIt);
+      _movingSenders.remove(obj);
+      obj->removeEventFilter(this);
+      QMetaObject::disconnect(obj, _destroyedSignal2Id, this, _destroyedSlotId);
+    }
+  }
+  deleteIfUnused();
+}
+
+void PythonQtSignalDispatcher::deleteIfUnused()
+{
+  if (isExhausted() && _connections.isEmpty()) {
+    // may be called from qt_metacall(), so we can't delete ourselves directly
+    deleteLater();
+  }
+}
+
+void PythonQtSignalDispatcher::senderDestroyed(QObject* obj)
+{
+  QHash<QObject*, QVector<int> >::iterator senderIt = _senders.find(obj);
+  if (senderIt == _senders.end()) {
+    return;
+  }
+  for (int slotId : qAsConst(senderIt.value())) {
+    QHash<int, Connection>::iterator it = _connections.find(slotId);
+    if (it == _connections.end()) {
+      continue;
+    }
+    if (isDestroyedSignal(it->_target.signalId())) {
+      // the Python destroyed() handlers are called after us, they are removed after they were called
+      it->_removeAfterCall = true;
     } else {
-      while (i.hasNext()) {
-        if (i.next().signalId() == sigId) {
-          QMetaObject::disconnect(_obj, sigId, this, i.value().slotId());
-          i.remove();
-          foundCount++;
-        }
+      _connections.erase(it);
+    }
+  }
+  // Qt removes the connections and event filters of the sender itself
+  _senders.erase(senderIt);
+  _movingSenders.remove(obj);
+  deleteIfUnused();
+}
+
+bool PythonQtSignalDispatcher::eventFilter(QObject* watched, QEvent* event)
+{
+  if (event->type() == QEvent::ThreadChange) {
+    PYTHONQT_GIL_SCOPE;
+    if (_senders.contains(watched)) {
+      senderAboutToMove(watched);
+    }
+  }
+  return false;
+}
+
+bool PythonQtSignalDispatcher::event(QEvent* event)
+{
+  if (event->type() == finishMovesEventType()) {
+    PYTHONQT_GIL_SCOPE;
+    // iterates over a copy, finishSenderMove() removes the sender
+    Q_FOREACH(QObject* obj, _movingSenders) {
+      if (_movingSenders.contains(obj)) {
+        finishSenderMove(obj);
       }
     }
+    return true;
   }
-  if ((foundCount>0) && ((sigId == _destroyedSignal1Id) || (sigId == _destroyedSignal2Id))) {
-    _destroyedSignalCount -= foundCount;
-    if (_destroyedSignalCount==0) {
-      // make ourself child of QObject again, to get deleted when the object gets deleted
-      this->setParent(_obj);
+  return PythonQtSignalReceiverBase::event(event);
+}
+
+void PythonQtSignalDispatcher::senderAboutToMove(QObject* obj)
+{
+  // the new thread is not known before the move, so the handlers are called by the emitting thread
+  // until they are moved to the dispatcher of the new thread, the event filter would be in the wrong thread
+  obj->removeEventFilter(this);
+  reconnectSender(obj, Qt::DirectConnection);
+  _movingSenders.insert(obj);
+  QCoreApplication::postEvent(this, new QEvent(finishMovesEventType()));
+}
+
+void PythonQtSignalDispatcher::finishSenderMove(QObject* obj)
+{
+  _movingSenders.remove(obj);
+  if (obj->thread() == thread()) {
+    // the sender was moved back
+    reconnectSender(obj, Qt::AutoConnection);
+    obj->installEventFilter(this);
+  } else {
+    PythonQt::self()->moveSignalHandlersToThreadOf(obj);
+  }
+}
+
+void PythonQtSignalDispatcher::reconnectSender(QObject* obj, Qt::ConnectionType type)
+{
+  Q_FOREACH(int slotId, _senders.value(obj)) {
+    QHash<int, Connection>::const_iterator it = _connections.constFind(slotId);
+    if (it != _connections.constEnd()) {
+      QMetaObject::disconnect(obj, it->_target.signalId(), this, slotId);
+      QMetaObject::connect(obj, it->_target.signalId(), this, slotId, type, nullptr);
     }
   }
-  return foundCount>0;
 }
 
-int PythonQtSignalReceiver::getSignalIndex(const char* signal)
+QEvent::Type PythonQtSignalDispatcher::finishMovesEventType()
+{
+  static const QEvent::Type type = QEvent::Type(QEvent::registerEventType());
+  return type;
+}
+
+bool PythonQtSignalDispatcher::isDestroyedSignal(int sigId)
+{
+  return (sigId == _destroyedSignal1Id) || (sigId == _destroyedSignal2Id);
+}
+
+int PythonQtSignalDispatcher::getSignalIndex(QObject* obj, const char* signal)
 {
-  int sigId = _obj->metaObject()->indexOfSignal(signal+1);
+  int sigId = obj->metaObject()->indexOfSignal(signal+1);
   if (sigId<0) {
     QByteArray tmpSig = QMetaObject::normalizedSignature(signal+1);
-    sigId = _obj->metaObject()->indexOfSignal(tmpSig);
+    sigId = obj->metaObject()->indexOfSignal(tmpSig);
   }
   return sigId;
 }
 
-int PythonQtSignalReceiver::qt_metacall(QMetaObject::Call c, int id, void **arguments)
+int PythonQtSignalDispatcher::qt_metacall(QMetaObject::Call c, int id, void **arguments)
 {
-//  mlabDebugConst("PythonQt", "PythonQtSignalReceiver invoke " << _obj->className() << " " << _obj->name() << " " << id);
   if (c != QMetaObject::InvokeMetaMethod) {
-    QObject::qt_metacall(c, id, arguments);
-  }
-
-  bool shouldDelete = false;
-  for(const PythonQtSignalTarget& t : qAsConst(_targets)) {
-    if (t.slotId() == id) {
-      const int sigId = t.signalId();
-      t.call(arguments);
-      // if the signal is the last destroyed signal, we delete ourselves
-      if ((sigId == _destroyedSignal1Id) || (sigId == _destroyedSignal2Id)) {
-        _destroyedSignalCount--;
-        if (_destroyedSignalCount == 0) {
-          shouldDelete = true;
-        }
-      }
-      break;
-    }
+    return QObject::qt_metacall(c, id, arguments);
+  }
+
+  PYTHONQT_GIL_SITE_SCOPE("PythonQtSignalDispatcher::qt_metacall")
+  if (id == _destroyedSlotId) {
+    senderDestroyed(*reinterpret_cast<QObject**>(arguments[1]));
+    return 0;
+  }
+  QHash<int, Connection>::const_iterator it = _connections.constFind(id);
+  if (it == _connections.constEnd()) {
+    // the handler was removed while the signal was queued
+    return 0;
+  }
+  // copy the target, since the handler may add or remove signal handlers
+  const PythonQtSignalTarget target = it->_target;
+  const bool removeAfterCall = it->_removeAfterCall;
+  PythonQtTraceScope trace(PythonQtTrace::Signals);
+  if (trace.isEnabled()) {
+    const QMetaObject* meta = it->_senderMetaObject;
+    trace.begin(meta->className(), PythonQtUtils::signature(meta->method(target.signalId())).constData());
   }
-  if (shouldDelete) {
-    delete this;
+  target.call(arguments);
+  trace.end();
+  if (removeAfterCall) {
+    removeConnection(id, false);
   }
   return 0;
 }
@@ -47,6 +47,11 @@
 #include "PythonQtSystem.h"
 #include "PythonQtObjectPtr.h"
 
+#include <QEvent>
+#include <QHash>
+#include <QSet>
+#include <QVector>
+
 class PythonQtMethodInfo;
 class PythonQtClassInfo;
 
@@ -81,6 +86,9 @@ public:
   //! get the signals parameter info
   const PythonQtMethodInfo* methodInfo()  const { return _methodInfo; }
 
+  //! get the Python callable
+  PyObject* callable() const { return _callable; }
+
   //! call the python callable with the given arguments (as defined in methodInfo)
   void call(void **arguments) const;
 
@@ -106,34 +114,115 @@ public:
   PythonQtSignalReceiverBase(QObject* obj):QObject(obj) {};
 };
 
-//! receives all signals for one QObject
-/*! we derive from our base but do not declare the QObject macro because we want to reimplement qt_metacall only.
+//! receives the signals of all QObjects of one thread that have Python signal handlers
+/*! Each Python signal handler is a connection to a simulated slot of the dispatcher, the slot ids are
+    never reused, so that pending queued signals of a removed handler are dropped instead of being delivered
+    to a different handler. Qt stores the slot index of a connection in 16 bits, so a dispatcher can only
+    take a limited number of handlers over its lifetime. Once they are used up, PythonQt creates a new dispatcher
+    for the thread and the exhausted one deletes itself (together with its pending queued signals) when its last
+    handler is removed. For each sender, one additional direct connection of the destroyed() signal is made to
+    forget the sender and its handlers when it is deleted.
+    The dispatcher also filters the QEvent::ThreadChange events of its senders. When a sender is about to be moved
+    to another thread, its handlers are connected directly, so that they are called in the new thread, until the
+    event loop of the dispatcher moves them to the dispatcher of the new thread.
+    The connection table is only accessed while holding the GIL.
+    We derive from our base but do not declare the QObject macro because we want to reimplement qt_metacall only.
 */
-class PythonQtSignalReceiver : public PythonQtSignalReceiverBase {
+class PythonQtSignalDispatcher : public PythonQtSignalReceiverBase {
 
 public:
-  PythonQtSignalReceiver(QObject* obj);
-  ~PythonQtSignalReceiver() override;
+  PythonQtSignalDispatcher();
+  ~PythonQtSignalDispatcher() override;
+
+  //! add a signal handler for the given sender
+  bool addSignalHandler(QObject* obj, const char* signal, PyObject* callable);
 
-  //! add a signal handler
-  bool addSignalHandler(const char* signal, PyObject* callable);
+  //! add a signal handler that was taken from another dispatcher with takeSignalHandlers()
+  void addSignalHandler(QObject* obj, const PythonQtSignalTarget& target);
+
+  //! removes all signal handlers of the given sender and returns them, so that they can be added to another dispatcher
+  QList<PythonQtSignalTarget> takeSignalHandlers(QObject* obj);
 
   //! remove a signal handler for given callable (or all callables on that signal if callable is NULL)
-  bool removeSignalHandler(const char* signal, PyObject* callable = nullptr);
+  bool removeSignalHandler(QObject* obj, const char* signal, PyObject* callable = nullptr);
+
+  //! get the number of Python signal handlers of this dispatcher
+  int connectionCount() const { return _connections.size(); }
+
+  //! returns if the given object has signal handlers in this dispatcher
+  bool hasSender(QObject* obj) const { return _senders.contains(obj); }
 
-  //! we implement this method to simulate a number of slots that match the ids in _targets
+  //! returns the objects that have signal handlers in this dispatcher
+  QList<QObject*> senders() const { return _senders.keys(); }
+
+  //! returns if all slot ids have been used, new signal handlers have to be added to another dispatcher then
+  bool isExhausted() const { return _nextSlotId > MaxSlotId; }
+
+  //! we implement this method to simulate a number of slots that match the ids in _connections
   int qt_metacall(QMetaObject::Call c, int id, void **arguments) override;
 
+  //! watches the senders for QEvent::ThreadChange
+  bool eventFilter(QObject* watched, QEvent* event) override;
+
+protected:
+  bool event(QEvent* event) override;
+
 private:
+  struct Connection {
+    Connection():_sender(nullptr),_senderMetaObject(nullptr),_removeAfterCall(false) {}
+
+    QObject* _sender;
+    //! the meta object of the sender, it stays valid when the sender is deleted
+    const QMetaObject* _senderMetaObject;
+    PythonQtSignalTarget _target;
+    //! set when the sender was destroyed and this is one of its destroyed() handlers
+    bool _removeAfterCall;
+  };
+
+  //! Qt stores the index of the receiving slot of a connection in an unsigned short
+  enum { MaxSlotId = 0xffff };
+
   //! get the index of the signal
-  int getSignalIndex(const char* signal);
-
-  QObject* _obj;
-  PythonQtClassInfo* _objClassInfo;
-  int _slotCount;
-  int _destroyedSignalCount;
-  // linear list may get slow on multiple targets, but I think typically we have many objects and just a few signals
-  QList<PythonQtSignalTarget> _targets;
+  static int getSignalIndex(QObject* obj, const char* signal);
+
+  //! adds the connection for the given target, which has to have the next free slot id
+  void addConnection(QObject* obj, const PythonQtSignalTarget& target);
+
+  //! deletes the dispatcher when all slot ids have been used and its last handler was removed
+  void deleteIfUnused();
+
+  //! check if the signal id is one of the destroyed() signals
+  static bool isDestroyedSignal(int sigId);
+
+  //! remove the connection with the given slot id from the tables, disconnects the tracking of
+  //! the sender if it was its last handler
+  void removeConnection(int slotId, bool disconnect);
+
+  //! called via the tracking connection when a sender is deleted
+  void senderDestroyed(QObject* obj);
+
+  //! called before the sender is moved to another thread
+  void senderAboutToMove(QObject* obj);
+
+  //! moves the handlers of a moved sender to the dispatcher of its new thread
+  void finishSenderMove(QObject* obj);
+
+  //! reconnects all handlers of the sender with the given connection type
+  void reconnectSender(QObject* obj, Qt::ConnectionType type);
+
+  //! the event that is posted to finish the moves of the senders
+  static QEvent::Type finishMovesEventType();
+
+  //! the slot id of the tracking connections of the senders
+  int _destroyedSlotId;
+  //! the slot id of the next connection
+  int _nextSlotId;
+  //! the connections by slot id
+  QHash<int, Connection> _connections;
+  //! the slot ids of the connections of each sender
+  QHash<QObject*, QVector<int> > _senders;
+  //! the senders that were moved to another thread, but whose handlers are still here
+  QSet<QObject*> _movingSenders;
 
   static int _destroyedSignal1Id;
   static int _destroyedSignal2Id;
@@ -45,6 +45,9 @@
 #include "PythonQtClassInfo.h"
 #include "PythonQtMisc.h"
 #include "PythonQtConversion.h"
+#include "PythonQtErrorMessage.h"
+#include "PythonQtTrace.h"
+#include "PythonQtCallRecorder.h"
 #include <iostream>
 
 #include <exception>
@@ -148,6 +151,15 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
       }
     }
 
+    if (PythonQtCallRecorder::isRecording()) {
+      PythonQtCallRecorder::record(PythonQtRecordedCall::SlotCall, classInfo ? classInfo->className() : QByteArray(),
+        info->slotName(true), info, argList, 1 + instanceDecoOffset);
+    }
+
+    PythonQtTraceScope trace(PythonQtTrace::SlotCalls);
+    if (trace.isEnabled()) {
+      trace.begin(classInfo ? classInfo->className().constData() : nullptr, info->signature().constData());
+    }
 
     PythonQt::ProfilingCB* profilingCB = PythonQt::priv()->profilingCB();
     if (profilingCB) {
@@ -210,6 +222,7 @@ bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObj
     if (profilingCB) {
       profilingCB(PythonQt::Leave, nullptr, nullptr, nullptr);
     }
+    trace.end();
 
     // handle the return value (which in most cases still needs to be converted to a Python object)
     if (!hadException) {
@@ -339,6 +352,85 @@ namespace {
 
     return beforeEllipsis + ellipsis + afterEllipsis;
   }
+
+  //! renders the message of a failed slot call, the arguments and signatures are only converted to a string when
+  //! the exception is printed. The slot infos may be deleted by then (e.g. by PythonQtClassInfo::clearCachedMembers()),
+  //! so their meta methods and shared method infos are kept, which are valid until PythonQt::cleanup()
+  class PythonQtSlotCallErrorMessage : public PythonQtErrorMessageRenderer
+  {
+  public:
+    enum Reason {
+      WrongArguments,
+      WrongNumberOfArguments,
+      KeywordArgumentsNotSupported,
+      NoMatchingOverload
+    };
+
+    PythonQtSlotCallErrorMessage(Reason reason, PythonQtSlotInfo* info, PyObject* args)
+      : _reason(reason), _args(args) {
+      Py_XINCREF(_args);
+      // only the overload error lists all overloads
+      while (info) {
+        Overload overload;
+        overload._meta = *info->metaMethod();
+        overload._methodInfo = info->cachedMethodInfo();
+        overload._type = info->isClassDecorator() ? PythonQtSlotInfo::ClassDecorator :
+          (info->isInstanceDecorator() ? PythonQtSlotInfo::InstanceDecorator : PythonQtSlotInfo::MemberSlot);
+        _overloads << overload;
+        info = reason == NoMatchingOverload ? info->nextInfo() : nullptr;
+      }
+    }
+    ~PythonQtSlotCallErrorMessage() override {
+      Py_XDECREF(_args);
+    }
+
+    QString render() override {
+      if (!PythonQt::self()) {
+        // the arguments can't be converted after PythonQt::cleanup()
+        return "Slot call failed";
+      }
+      QString argsString = _args ? limitString(PythonQtConv::PyObjGetString(_args)) : QString("()");
+      QString signature = _overloads.isEmpty() ? QString() : fullSignature(_overloads.first());
+      switch (_reason) {
+      case WrongArguments:
+        return QString("Called ") + signature + " with wrong arguments: " + argsString;
+      case WrongNumberOfArguments:
+        return QString("Called ") + signature + " with wrong number of arguments: " + argsString;
+      case KeywordArgumentsNotSupported:
+        return QString("Called ") + signature + " with keyword arguments, but called slot does not support kwargs.";
+      case NoMatchingOverload:
+        {
+          QString e = QString("Could not find matching overload for given arguments:\n" + argsString + "\n The following slots are available:\n");
+          Q_FOREACH(const Overload& overload, _overloads) {
+            e += fullSignature(overload) + "\n";
+          }
+          return e;
+        }
+      }
+      return QString();
+    }
+
+  private:
+    struct Overload {
+      QMetaMethod _meta;
+      const PythonQtMethodInfo* _methodInfo;
+      PythonQtSlotInfo::Type _type;
+    };
+
+    static QString fullSignature(const Overload& overload) {
+      return PythonQtSlotInfo::fullSignature(overload._meta, overload._methodInfo->parameters(), overload._type,
+        overload._type == PythonQtSlotInfo::InstanceDecorator);
+    }
+
+    Reason _reason;
+    QList<Overload> _overloads;
+    PyObject* _args;
+  };
+
+  void setSlotCallError(PyObject* exceptionType, PythonQtSlotCallErrorMessage::Reason reason, PythonQtSlotInfo* info, PyObject* args)
+  {
+    PythonQtErrorMessage_SetError(exceptionType, new PythonQtSlotCallErrorMessage(reason, info, args));
+  }
 };
 
 PyObject *PythonQtSlotFunction_CallImpl(PythonQtClassInfo* classInfo, QObject* objectToCall, PythonQtSlotInfo* info, PyObject *args, PyObject * kw, void* firstArg, void** directReturnValuePointer,  PythonQtPassThisOwnershipType* passThisOwnershipToCPP)
@@ -395,12 +487,10 @@ PyObject *PythonQtSlotFunction_CallImpl(PythonQtClassInfo* classInfo, QObject* o
 
       ok = PythonQtCallSlot(classInfo, objectToCall, combinedArgs, false, slotInfo, firstArg, &r, directReturnValuePointer, passThisOwnershipToCPP);
       if (!ok && !PyErr_Occurred()) {
-        QString e = QString("Called ") + info->fullSignature() + " with wrong arguments: " + limitString(PythonQtConv::PyObjGetString(args));
-        PyErr_SetString(PyExc_ValueError, QStringToPythonConstCharPointer(e));
+        setSlotCallError(PythonQt::priv()->conversionErrorType(), PythonQtSlotCallErrorMessage::WrongArguments, info, args);
       }
     } else {
-      QString e = QString("Called ") + info->fullSignature() + " with keyword arguments, but called slot does not support kwargs.";
-      PyErr_SetString(PyExc_ValueError, QStringToPythonConstCharPointer(e));
+      setSlotCallError(PythonQt::priv()->overloadErrorType(), PythonQtSlotCallErrorMessage::KeywordArgumentsNotSupported, info, args);
     }
 
     Py_DECREF(combinedArgs);
@@ -427,13 +517,7 @@ PyObject *PythonQtSlotFunction_CallImpl(PythonQtClassInfo* classInfo, QObject* o
         }
       }
       if (!ok && !PyErr_Occurred()) {
-        QString e = QString("Could not find matching overload for given arguments:\n" + limitString(PythonQtConv::PyObjGetString(args)) + "\n The following slots are available:\n");
-        PythonQtSlotInfo* i = info;
-        while (i) {
-          e += QString(i->fullSignature()) + "\n";
-          i = i->nextInfo();
-        }
-        PyErr_SetString(PyExc_ValueError, QStringToPythonConstCharPointer(e));
+        setSlotCallError(PythonQt::priv()->overloadErrorType(), PythonQtSlotCallErrorMessage::NoMatchingOverload, info, args);
       }
     } else {
       // simple (non-overloaded) slot call
@@ -445,12 +529,10 @@ PyObject *PythonQtSlotFunction_CallImpl(PythonQtClassInfo* classInfo, QObject* o
   #endif
         ok = PythonQtCallSlot(classInfo, objectToCall, args, false, info, firstArg, &r, directReturnValuePointer, passThisOwnershipToCPP);
         if (!ok && !PyErr_Occurred()) {
-          QString e = QString("Called ") + info->fullSignature() + " with wrong arguments: " + limitString(PythonQtConv::PyObjGetString(args));
-          PyErr_SetString(PyExc_ValueError, QStringToPythonConstCharPointer(e));
+          setSlotCallError(PythonQt::priv()->conversionErrorType(), PythonQtSlotCallErrorMessage::WrongArguments, info, args);
         }
       } else {
-        QString e = QString("Called ") + info->fullSignature() + " with wrong number of arguments: " + limitString(PythonQtConv::PyObjGetString(args));
-        PyErr_SetString(PyExc_ValueError, QStringToPythonConstCharPointer(e));
+        setSlotCallError(PythonQt::priv()->overloadErrorType(), PythonQtSlotCallErrorMessage::WrongNumberOfArguments, info, args);
       }
     }
   }
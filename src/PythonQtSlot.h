@@ -72,6 +72,9 @@ PyObject* PythonQtSlotFunction_Call(PyObject *, PyObject *, PyObject *);
 
 PyObject *PythonQtSlotFunction_CallImpl(PythonQtClassInfo* classInfo, QObject* objectToCall, PythonQtSlotInfo* info, PyObject *args, PyObject *kw, void* firstArg=nullptr,  void** directReturnValuePointer=nullptr, PythonQtPassThisOwnershipType* passThisOwnershipToCPP = nullptr);
 
+//! calls the given overload without overload resolution, returns false if the arguments could not be converted or the call failed
+bool PythonQtCallSlot(PythonQtClassInfo* classInfo, QObject* objectToCall, PyObject* args, bool strict, PythonQtSlotInfo* info, void* firstArgument, PyObject** pythonReturnValue, void** directReturnValuePointer = nullptr, PythonQtPassThisOwnershipType* passThisOwnershipToCPP = nullptr);
+
 PyObject* PythonQtSlotFunction_New(PythonQtSlotInfo *, PyObject *,
            PyObject *);
 
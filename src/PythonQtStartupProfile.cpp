@@ -0,0 +1,98 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtStartupProfile.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtStartupProfile.h"
+
+#include <QElapsedTimer>
+#include <QVector>
+
+namespace {
+
+QElapsedTimer pythonQtStartupClock;
+QList<PythonQtStartupPhase> pythonQtStartupPhases;
+//! indices of the phases that have been begun but not ended
+QVector<int> pythonQtOpenStartupPhases;
+
+}
+
+void PythonQtStartupProfile::begin(const char* name)
+{
+  if (!pythonQtStartupClock.isValid()) {
+    pythonQtStartupClock.start();
+  }
+  PythonQtStartupPhase phase;
+  phase.name = name;
+  phase.depth = pythonQtOpenStartupPhases.size();
+  phase.startNs = pythonQtStartupClock.nsecsElapsed();
+  pythonQtOpenStartupPhases.append(pythonQtStartupPhases.size());
+  pythonQtStartupPhases.append(phase);
+}
+
+void PythonQtStartupProfile::end()
+{
+  if (pythonQtOpenStartupPhases.isEmpty()) {
+    return;
+  }
+  PythonQtStartupPhase& phase = pythonQtStartupPhases[pythonQtOpenStartupPhases.takeLast()];
+  phase.durationNs = pythonQtStartupClock.nsecsElapsed() - phase.startNs;
+}
+
+QList<PythonQtStartupPhase> PythonQtStartupProfile::phases()
+{
+  return pythonQtStartupPhases;
+}
+
+QByteArray PythonQtStartupProfile::report()
+{
+  QByteArray result;
+  Q_FOREACH(const PythonQtStartupPhase& phase, pythonQtStartupPhases) {
+    result += QByteArray::number(phase.durationNs / 1000000., 'f', 2).rightJustified(10) + " ms  ";
+    result += QByteArray(2 * phase.depth, ' ') + phase.name + "\n";
+  }
+  return result;
+}
+
+void PythonQtStartupProfile::clear()
+{
+  pythonQtStartupPhases.clear();
+  pythonQtOpenStartupPhases.clear();
+  pythonQtStartupClock.invalidate();
+}
@@ -0,0 +1,93 @@
+#ifndef _PYTHONQTSTARTUPPROFILE_H
+#define _PYTHONQTSTARTUPPROFILE_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtStartupProfile.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtSystem.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QtGlobal>
+
+//! a timed phase of the PythonQt startup, see PythonQtStartupProfile
+struct PYTHONQT_EXPORT PythonQtStartupPhase
+{
+  PythonQtStartupPhase():depth(0),startNs(0),durationNs(0) {}
+
+  QByteArray name;
+  //! the nesting level, 0 for top level phases
+  int depth;
+  //! the start of the phase, relative to the start of the first recorded phase
+  qint64 startNs;
+  qint64 durationNs;
+};
+
+//! Measures the phases of PythonQt::init(), PythonQt_QtAll::init() and of application defined startup steps.
+/*! The phases are always recorded, they cost two timer reads each. Phases may be nested, begin() and end()
+    have to be called from the thread that initializes PythonQt.
+*/
+class PYTHONQT_EXPORT PythonQtStartupProfile
+{
+public:
+  //! starts a phase with the given name (the name is copied)
+  static void begin(const char* name);
+  //! ends the last phase that was begun
+  static void end();
+
+  //! returns the recorded phases in the order in which they were begun
+  static QList<PythonQtStartupPhase> phases();
+  //! returns the recorded phases as an indented text table with milliseconds
+  static QByteArray report();
+  //! discards the recorded phases
+  static void clear();
+};
+
+//! Records a startup phase for the lifetime of the scope
+class PythonQtStartupPhaseScope
+{
+  Q_DISABLE_COPY(PythonQtStartupPhaseScope)
+public:
+  explicit PythonQtStartupPhaseScope(const char* name) { PythonQtStartupProfile::begin(name); }
+  ~PythonQtStartupPhaseScope() { PythonQtStartupProfile::end(); }
+};
+
+#endif
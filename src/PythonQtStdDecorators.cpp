@@ -43,9 +43,15 @@
 #include "PythonQt.h"
 #include "PythonQtClassInfo.h"
 #include "PythonQtConversion.h"
+#include "PythonQtCallRecorder.h"
+#include "PythonQtStartupProfile.h"
 
 #include <QCoreApplication>
 #include <QRegularExpression>
+#include <QRunnable>
+#include <QThread>
+
+#include <stdexcept>
 
 bool PythonQtStdDecorators::connect(QObject* sender, const QByteArray& signal, PyObject* callable)
 {
@@ -365,6 +371,189 @@ void PythonQtConfigAPI::setTaskDoneCallback(PyObject* object)
   }
 }
 
+void PythonQtConfigAPI::setNumericListsAsBuffers(bool flag)
+{
+  PythonQtConv::setNumericListsAsBuffers(flag);
+}
+
+void PythonQtConfigAPI::setContainerViews(bool flag)
+{
+  PythonQtConv::setContainerViews(flag);
+}
+
+//---------------------------------------------------------------------------
+
+namespace {
+
+class PythonQtThreadPoolRunnable : public QRunnable
+{
+public:
+  PythonQtThreadPoolRunnable(PythonQtThreadPoolJob* job):_job(job), _started(false) {}
+
+  ~PythonQtThreadPoolRunnable() override
+  {
+    if (!_started) {
+      // removed from the queue by QThreadPool::clear(), the future is cancelled in the thread of the job
+      QMetaObject::invokeMethod(_job, "cancel", _job->thread() == QThread::currentThread() ? Qt::DirectConnection : Qt::QueuedConnection);
+    }
+  }
+
+  void run() override
+  {
+    _started = true;
+    _job->execute();
+    // the job lives in the submitting thread, so finish() is called by its event loop
+    QMetaObject::invokeMethod(_job, "finish", Qt::QueuedConnection);
+  }
+
+private:
+  PythonQtThreadPoolJob* _job;
+  bool _started;
+};
+
+}
+
+PythonQtThreadPoolJob::PythonQtThreadPoolJob(const PythonQtObjectPtr& callable, const PythonQtObjectPtr& args, const PythonQtObjectPtr& future)
+{
+  _callable = callable;
+  _args = args;
+  _future = future;
+}
+
+PythonQtThreadPoolJob::~PythonQtThreadPoolJob()
+{
+  PYTHONQT_GIL_SCOPE
+  _callable = nullptr;
+  _args = nullptr;
+  _future = nullptr;
+  _result = nullptr;
+  _exception = nullptr;
+}
+
+void PythonQtThreadPoolJob::execute()
+{
+  PYTHONQT_GIL_SCOPE
+  PyObject* result = PyObject_Call(_callable, _args, nullptr);
+  if (result) {
+    _result.setNewRef(result);
+  } else {
+    PyObject* type;
+    PyObject* value;
+    PyObject* traceback;
+    PyErr_Fetch(&type, &value, &traceback);
+    PyErr_NormalizeException(&type, &value, &traceback);
+#ifdef PY3K
+    if (traceback && value) {
+      PyException_SetTraceback(value, traceback);
+    }
+#endif
+    _exception.setNewRef(value);
+    Py_XDECREF(type);
+    Py_XDECREF(traceback);
+  }
+  // release the callable in the thread that ran it
+  _callable = nullptr;
+  _args = nullptr;
+}
+
+void PythonQtThreadPoolJob::finish()
+{
+  {
+    PYTHONQT_GIL_SCOPE
+    PythonQtObjectPtr done;
+    done.setNewRef(PyObject_CallMethod(_future, const_cast<char*>("done"), nullptr));
+    // the future is already done if it was cancelled in the meantime
+    if (done && !PyObject_IsTrue(done)) {
+      PythonQtObjectPtr r;
+      if (_exception) {
+        r.setNewRef(PyObject_CallMethod(_future, const_cast<char*>("set_exception"), const_cast<char*>("O"), _exception.object()));
+      } else {
+        r.setNewRef(PyObject_CallMethod(_future, const_cast<char*>("set_result"), const_cast<char*>("O"), _result ? _result.object() : Py_None));
+      }
+      done = r;
+    }
+    if (!done) {
+      PythonQt::self()->handleError();
+    }
+  }
+  deleteLater();
+}
+
+void PythonQtThreadPoolJob::cancel()
+{
+  if (Py_IsInitialized()) {
+    PYTHONQT_GIL_SCOPE
+    PythonQtObjectPtr result;
+    result.setNewRef(PyObject_CallMethod(_future, const_cast<char*>("cancel"), nullptr));
+    if (!result && PythonQt::self()) {
+      PythonQt::self()->handleError();
+    }
+    PyErr_Clear();
+    _callable = nullptr;
+    _args = nullptr;
+    _future = nullptr;
+  }
+  deleteLater();
+}
+
+PythonQtThreadPoolAPI::PythonQtThreadPoolAPI(QObject* parent)
+  : QObject(parent)
+{
+}
+
+PythonQtThreadPoolAPI::~PythonQtThreadPoolAPI()
+{
+  // cancels the futures of the callables that did not start yet, see PythonQtThreadPoolRunnable
+  _pool.clear();
+#ifdef PY3K
+  if (Py_IsInitialized() && PyGILState_Check()) {
+    // the running callables need the GIL to finish
+    PYTHONQT_ALLOW_THREADS_SCOPE
+    _pool.waitForDone();
+    return;
+  }
+#endif
+  _pool.waitForDone();
+}
+
+PythonQtObjectPtr PythonQtThreadPoolAPI::submit(PyObject* callable, PyObject* args)
+{
+  if (!PyCallable_Check(callable)) {
+    throw std::runtime_error("ThreadPool.submit() expects a callable");
+  }
+#ifdef PYTHONQT_GIL_SUPPORT
+  if (!PythonQtGILScope::isGILScopeEnabled()) {
+    throw std::runtime_error("ThreadPool.submit() requires thread support, call PythonQt::setEnableThreadSupport(true)");
+  }
+#else
+  throw std::runtime_error("ThreadPool.submit() requires PythonQt to be built with GIL support");
+#endif
+  PythonQtObjectPtr argsTuple;
+  if (!args || args == Py_None) {
+    argsTuple.setNewRef(PyTuple_New(0));
+  } else {
+    argsTuple.setNewRef(PySequence_Tuple(args));
+    if (!argsTuple) {
+      PyErr_Clear();
+      throw std::runtime_error("ThreadPool.submit() expects the arguments as a sequence");
+    }
+  }
+  PythonQtObjectPtr future = PythonQt::priv()->createAsyncioFuture();
+  if (!future) {
+    PyErr_Clear();
+    throw std::runtime_error("ThreadPool.submit() could not create an asyncio future");
+  }
+  PythonQtThreadPoolJob* job = new PythonQtThreadPoolJob(callable, argsTuple, future);
+  _pool.start(new PythonQtThreadPoolRunnable(job));
+  return future;
+}
+
+bool PythonQtThreadPoolAPI::waitForDone(int msecs)
+{
+  PYTHONQT_ALLOW_THREADS_SCOPE
+  return _pool.waitForDone(msecs);
+}
+
 //---------------------------------------------------------------------------
 
 bool PythonQtDebugAPI::isOwnedByPython( PyObject* object )
@@ -424,6 +613,220 @@ bool PythonQtDebugAPI::isPythonQtClassWrapper( PyObject* object )
   return PyObject_TypeCheck(object, &PythonQtClassWrapper_Type) != 0;
 }
 
+int PythonQtDebugAPI::pendingDeferredDecrefs()
+{
+#ifdef PYTHONQT_GIL_SUPPORT
+  return PythonQtDeferredDecref::pendingCount();
+#else
+  return 0;
+#endif
+}
+
+int PythonQtDebugAPI::maxPendingDeferredDecrefs()
+{
+#ifdef PYTHONQT_GIL_SUPPORT
+  return PythonQtDeferredDecref::maxPendingCount();
+#else
+  return 0;
+#endif
+}
+
+qint64 PythonQtDebugAPI::metadataMemoryUsage()
+{
+  return PythonQt::self()->metadataMemoryUsage();
+}
+
+void PythonQtDebugAPI::startTrace(int categories)
+{
+  PythonQtTrace::setCategories(categories);
+}
+
+void PythonQtDebugAPI::stopTrace()
+{
+  PythonQtTrace::setCategories(0);
+}
+
+void PythonQtDebugAPI::clearTrace()
+{
+  PythonQtTrace::clear();
+}
+
+bool PythonQtDebugAPI::writeTrace(const QString& filename)
+{
+  return PythonQtTrace::writeChromeTrace(filename);
+}
+
+#ifdef PYTHONQT_GIL_SUPPORT
+static QVariantList PythonQtDebugAPI_histogram(const QVector<qint64>& histogram)
+{
+  QVariantList list;
+  Q_FOREACH(qint64 count, histogram) {
+    list << count;
+  }
+  return list;
+}
+#endif
+
+void PythonQtDebugAPI::setGILStatisticsEnabled(bool flag)
+{
+#ifdef PYTHONQT_GIL_SUPPORT
+  PythonQtGILStatistics::setEnabled(flag);
+#else
+  Q_UNUSED(flag)
+#endif
+}
+
+void PythonQtDebugAPI::resetGILStatistics()
+{
+#ifdef PYTHONQT_GIL_SUPPORT
+  PythonQtGILStatistics::reset();
+#endif
+}
+
+QVariantList PythonQtDebugAPI::gilThreadStatistics()
+{
+  QVariantList result;
+#ifdef PYTHONQT_GIL_SUPPORT
+  Q_FOREACH(const PythonQtGILThreadStatistics& statistics, PythonQtGILStatistics::threadStatistics()) {
+    QVariantMap thread;
+    thread["thread"] = statistics.threadName;
+    thread["acquisitions"] = statistics.acquisitions;
+    thread["totalWait"] = statistics.totalWaitNs / 1000.;
+    thread["maxWait"] = statistics.maxWaitNs / 1000.;
+    thread["totalHold"] = statistics.totalHoldNs / 1000.;
+    thread["maxHold"] = statistics.maxHoldNs / 1000.;
+    thread["waitHistogram"] = PythonQtDebugAPI_histogram(statistics.waitHistogram);
+    thread["holdHistogram"] = PythonQtDebugAPI_histogram(statistics.holdHistogram);
+    result << thread;
+  }
+#endif
+  return result;
+}
+
+QVariantList PythonQtDebugAPI::gilTopSites(int count)
+{
+  QVariantList result;
+#ifdef PYTHONQT_GIL_SUPPORT
+  Q_FOREACH(const PythonQtGILSiteStatistics& statistics, PythonQtGILStatistics::topSites(count)) {
+    QVariantMap site;
+    site["site"] = QString::fromUtf8(statistics.site);
+    site["acquisitions"] = statistics.acquisitions;
+    site["totalWait"] = statistics.totalWaitNs / 1000.;
+    site["maxWait"] = statistics.maxWaitNs / 1000.;
+    site["totalHold"] = statistics.totalHoldNs / 1000.;
+    result << site;
+  }
+#else
+  Q_UNUSED(count)
+#endif
+  return result;
+}
+
+QVariantList PythonQtDebugAPI::gilHistogramBounds()
+{
+  QVariantList result;
+#ifdef PYTHONQT_GIL_SUPPORT
+  for (int i = 0; i < PythonQtGILStatistics::HistogramBuckets; i++) {
+    result << PythonQtGILStatistics::bucketUpperBoundUs(i);
+  }
+#endif
+  return result;
+}
+
+QVariantMap PythonQtDebugAPI::census()
+{
+  PythonQtCensus census = PythonQt::self()->census();
+  QVariantMap result;
+  QVariantList classes;
+  Q_FOREACH(const PythonQtClassCensus& entry, census.classes) {
+    QVariantMap info;
+    info["className"] = QString::fromUtf8(entry.className);
+    info["wrappers"] = entry.wrappers;
+    info["ownedByPython"] = entry.ownedByPython;
+    info["ownedByCPP"] = entry.ownedByCPP;
+    info["shellInstances"] = entry.shellInstances;
+    info["deletedObjects"] = entry.deletedObjects;
+    info["approximateBytes"] = entry.approximateBytes;
+    classes << info;
+  }
+  result["classes"] = classes;
+  result["wrappers"] = census.wrappers;
+  result["ownedByPython"] = census.ownedByPython;
+  result["ownedByCPP"] = census.ownedByCPP;
+  result["wrapperBytes"] = census.wrapperBytes;
+  result["signalDispatchers"] = census.signalDispatchers;
+  result["signalHandlers"] = census.signalHandlers;
+  result["classInfos"] = census.classInfos;
+  result["cachedMembers"] = census.cachedMembers;
+  result["classInfoBytes"] = census.classInfoBytes;
+  result["cachedSignatures"] = census.cachedSignatures;
+  result["cachedParameterInfos"] = census.cachedParameterInfos;
+  result["methodInfoBytes"] = census.methodInfoBytes;
+  QVariantList sites;
+  for (int i = 0; i < census.allocationSites.size(); i++) {
+    QVariantMap site;
+    site["site"] = QString::fromUtf8(census.allocationSites.at(i).first);
+    site["count"] = census.allocationSites.at(i).second;
+    sites << site;
+  }
+  result["allocationSites"] = sites;
+  return result;
+}
+
+void PythonQtDebugAPI::setWrapperAllocationSampling(int n)
+{
+  PythonQt::self()->setWrapperAllocationSampling(n);
+}
+
+void PythonQtDebugAPI::startCallRecording(int maxCalls)
+{
+  PythonQtCallRecorder::start(maxCalls);
+}
+
+void PythonQtDebugAPI::stopCallRecording()
+{
+  PythonQtCallRecorder::stop();
+}
+
+void PythonQtDebugAPI::clearCallRecording()
+{
+  PythonQtCallRecorder::clear();
+}
+
+bool PythonQtDebugAPI::saveCallRecording(const QString& filename)
+{
+  return PythonQtCallRecorder::save(filename);
+}
+
+QVariantList PythonQtDebugAPI::startupPhases()
+{
+  QVariantList result;
+  Q_FOREACH(const PythonQtStartupPhase& phase, PythonQtStartupProfile::phases()) {
+    QVariantMap entry;
+    entry["name"] = QString::fromUtf8(phase.name);
+    entry["depth"] = phase.depth;
+    entry["start"] = phase.startNs / 1e6;
+    entry["duration"] = phase.durationNs / 1e6;
+    result << entry;
+  }
+  return result;
+}
+
+QString PythonQtDebugAPI::startupReport()
+{
+  return QString::fromUtf8(PythonQtStartupProfile::report());
+}
+
+bool PythonQtDebugAPI::saveStartupSnapshot(const QString& filename)
+{
+  return PythonQt::self()->saveStartupSnapshot(filename);
+}
+
+int PythonQtDebugAPI::deferredClassCount()
+{
+  return PythonQt::self()->deferredClassCount();
+}
+
 //---------------------------------------------------------------------------
 
 PythonQtSingleShotTimer::PythonQtSingleShotTimer(int msec, const PythonQtObjectPtr& callable)
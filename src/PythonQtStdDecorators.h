@@ -45,6 +45,7 @@
 #include "PythonQtPythonInclude.h"
 
 #include "PythonQt.h"
+#include "PythonQtTrace.h"
 
 #include <QObject>
 #include <QVariantList>
@@ -54,6 +55,7 @@
 #include <QDate>
 #include <QTime>
 #include <QTimer>
+#include <QThreadPool>
 #include <QImage>
 #include <QMetaMethod>
 #include <QMetaEnum>
@@ -204,9 +206,68 @@ public slots:
   //! Set a callable that is used as the argument for the add_done_callback for the Task/Future
   //! created when, e.g., an async function is connected to signal.
   void setTaskDoneCallback(PyObject* object);
+
+  //! Return numeric QList/QVector/std::vector values as typed memoryviews instead of tuples (see PythonQtConv::setNumericListsAsBuffers()).
+  void setNumericListsAsBuffers(bool flag);
+
+  //! Return large Qt containers as views that convert their items on access (see PythonQtConv::setContainerViews()).
+  void setContainerViews(bool flag);
 };
 
 
+//! A callable submitted to PythonQtThreadPoolAPI, it lives in the submitting thread
+//! and resolves its asyncio future there after the callable has run on the thread pool.
+class PythonQtThreadPoolJob : public QObject
+{
+  Q_OBJECT
+public:
+  PythonQtThreadPoolJob(const PythonQtObjectPtr& callable, const PythonQtObjectPtr& args, const PythonQtObjectPtr& future);
+  ~PythonQtThreadPoolJob() override;
+
+  //! runs the callable and stores the result or the exception, called on a pool thread
+  void execute();
+
+public Q_SLOTS:
+  //! sets the result or exception on the future and deletes the job
+  void finish();
+  //! cancels the future of a job that was removed from the pool before it ran, releases the
+  //! Python objects and deletes the job
+  void cancel();
+
+private:
+  PythonQtObjectPtr _callable;
+  PythonQtObjectPtr _args;
+  PythonQtObjectPtr _future;
+  PythonQtObjectPtr _result;
+  PythonQtObjectPtr _exception;
+};
+
+//! Runs Python callables (including wrapped C++ slots) on a QThreadPool, available as PythonQt.ThreadPool
+class PYTHONQT_EXPORT PythonQtThreadPoolAPI : public QObject
+{
+  Q_OBJECT
+public:
+  PythonQtThreadPoolAPI(QObject* parent);
+  ~PythonQtThreadPoolAPI() override;
+
+public Q_SLOTS:
+  //! Runs callable(*args) on a thread of the pool and returns an asyncio future, which is resolved
+  //! with the result (or the raised exception) by the event loop of the submitting thread.
+  //! The GIL is acquired while the callable runs, so this requires PythonQt::setEnableThreadSupport(true).
+  PythonQtObjectPtr submit(PyObject* callable, PyObject* args = nullptr);
+
+  int maxThreadCount() const { return _pool.maxThreadCount(); }
+  void setMaxThreadCount(int count) { _pool.setMaxThreadCount(count); }
+  int activeThreadCount() const { return _pool.activeThreadCount(); }
+
+  //! Waits until all submitted callables have run (releases the GIL while waiting).
+  //! Returns false if the timeout expired.
+  bool waitForDone(int msecs = -1);
+
+private:
+  QThreadPool _pool;
+};
+
 //! Some helper methods that allow testing of the ownership
 class PYTHONQT_EXPORT PythonQtDebugAPI : public QObject
 {
@@ -231,6 +292,60 @@ class PYTHONQT_EXPORT PythonQtDebugAPI : public QObject
     bool isPythonQtInstanceWrapper(PyObject* object);
     //! Returns if the given object is a PythonQt class wrapper (or derived class)
     bool isPythonQtClassWrapper(PyObject* object);
+
+    //! Returns the number of Python references that were released by C++ threads without the GIL
+    //! and are waiting to be decref'ed by the next thread that enters Python.
+    int pendingDeferredDecrefs();
+    //! Returns the highest number of pending deferred decrefs seen so far.
+    int maxPendingDeferredDecrefs();
+
+    //! Returns the approximate number of bytes held by the class and method metadata, see PythonQt::metadataMemoryUsage().
+    qint64 metadataMemoryUsage();
+
+    //! Starts tracing of the given PythonQtTrace categories (all by default), see PythonQtTrace.
+    void startTrace(int categories = PythonQtTrace::AllCategories);
+    //! Stops tracing, the recorded events are kept.
+    void stopTrace();
+    //! Discards the recorded trace events.
+    void clearTrace();
+    //! Writes the recorded trace events as Chrome trace event JSON, returns false if the file could not be written.
+    bool writeTrace(const QString& filename);
+
+    //! Enables/disables the GIL contention statistics, see PythonQtGILStatistics.
+    void setGILStatisticsEnabled(bool flag);
+    //! Discards the recorded GIL statistics.
+    void resetGILStatistics();
+    //! Returns a dict for each thread with its GIL acquisition count, wait and hold times (in microseconds)
+    //! and histograms (the bucket bounds are returned by gilHistogramBounds()).
+    QVariantList gilThreadStatistics();
+    //! Returns a dict for each of the count acquisition sites with the highest total GIL wait time.
+    QVariantList gilTopSites(int count = 10);
+    //! Returns the exclusive upper bounds of the GIL histogram buckets in microseconds, the last bucket is unbounded (-1).
+    QVariantList gilHistogramBounds();
+
+    //! Returns a dict with the live wrapper counts (per class in "classes"), signal handlers, cache sizes
+    //! and the sampled "allocationSites", see PythonQt::census().
+    QVariantMap census();
+    //! Records the Python file and line of every n-th wrapper allocation (0 disables sampling).
+    void setWrapperAllocationSampling(int n);
+
+    //! Starts recording the slot calls and signal/virtual dispatches, see PythonQtCallRecorder.
+    void startCallRecording(int maxCalls = 1000000);
+    //! Stops recording calls.
+    void stopCallRecording();
+    //! Discards the recorded calls.
+    void clearCallRecording();
+    //! Writes the recorded calls to the given file, which can be replayed with the PyCallReplay example.
+    bool saveCallRecording(const QString& filename);
+
+    //! Returns the recorded startup phases as list of dicts with name, depth, start and duration (in milliseconds).
+    QVariantList startupPhases();
+    //! Returns the recorded startup phases as text table.
+    QString startupReport();
+    //! Writes the classes used so far to the given file, see PythonQt::saveStartupSnapshot().
+    bool saveStartupSnapshot(const QString& filename);
+    //! Returns the number of classes whose registration is still deferred.
+    int deferredClassCount();
 };
 
 #endif
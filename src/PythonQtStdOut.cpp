@@ -40,6 +40,82 @@
 //----------------------------------------------------------------------------------
 
 #include "PythonQtStdOut.h"
+#include "PythonQt.h"
+#include <QThread>
+
+void PythonQtStdOutBuffer::setPolicy(int policy, int maxBufferSize, int flushInterval)
+{
+  _policy = policy;
+  _maxBufferSize = qMax(1, maxBufferSize);
+  _flushInterval = flushInterval;
+}
+
+void PythonQtStdOutBuffer::write(PythonQtOutputChangedCB* cb, const QString& text)
+{
+  ThreadBuffer& buffer = _threads[QThread::currentThreadId()];
+  if (buffer._text.isEmpty()) {
+    buffer._age.start();
+  }
+  buffer._text += text;
+  QString output;
+  if (((_policy & PythonQt::RedirectFlushOnSize) && buffer._text.size() >= _maxBufferSize) ||
+      ((_policy & PythonQt::RedirectFlushOnInterval) && buffer._age.elapsed() >= _flushInterval)) {
+    output = take(buffer, buffer._text.size());
+  } else if ((_policy & PythonQt::RedirectFlushOnNewline) && text.contains('\n')) {
+    // pass all complete lines on in one call, keep the incomplete last line
+    output = take(buffer, buffer._text.lastIndexOf('\n') + 1);
+  }
+  if (!output.isEmpty()) {
+    (*cb)(output);
+  }
+}
+
+void PythonQtStdOutBuffer::flushCurrentThread(PythonQtOutputChangedCB* cb)
+{
+  QString output;
+  QHash<Qt::HANDLE, ThreadBuffer>::iterator it = _threads.find(QThread::currentThreadId());
+  if (it != _threads.end()) {
+    output = take(it.value(), it.value()._text.size());
+  }
+  if (!output.isEmpty()) {
+    (*cb)(output);
+  }
+}
+
+void PythonQtStdOutBuffer::flushAll(PythonQtOutputChangedCB* cb, int minAge)
+{
+  // collect the text first, the callback may write again and modify the hash
+  QStringList outputs;
+  QHash<Qt::HANDLE, ThreadBuffer>::iterator it = _threads.begin();
+  while (it != _threads.end()) {
+    ThreadBuffer& buffer = it.value();
+    if (buffer._text.isEmpty()) {
+      // don't keep entries of threads that may be gone
+      it = _threads.erase(it);
+      continue;
+    }
+    if (minAge <= 0 || buffer._age.elapsed() >= minAge) {
+      outputs << take(buffer, buffer._text.size());
+    }
+    ++it;
+  }
+  Q_FOREACH (const QString& output, outputs) {
+    (*cb)(output);
+  }
+}
+
+QString PythonQtStdOutBuffer::take(ThreadBuffer& buffer, int length)
+{
+  QString text;
+  if (length >= buffer._text.size()) {
+    text.swap(buffer._text);
+  } else if (length > 0) {
+    text = buffer._text.left(length);
+    buffer._text.remove(0, length);
+    buffer._age.start();
+  }
+  return text;
+}
 
 static PyObject *PythonQtStdOutRedirect_new(PyTypeObject *type, PyObject * /*args*/, PyObject * /*kwds*/)
 {
@@ -49,10 +125,22 @@ static PyObject *PythonQtStdOutRedirect_new(PyTypeObject *type, PyObject * /*arg
   self->softspace = 0;
   self->closed = false;
   self->_cb = nullptr;
+  self->_buffer = nullptr;
 
   return (PyObject *)self;
 }
 
+static void PythonQtStdOutRedirect_dealloc(PythonQtStdOutRedirect* self)
+{
+  if (self->_buffer) {
+    if (self->_cb) {
+      self->_buffer->flushAll(self->_cb);
+    }
+    delete self->_buffer;
+  }
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
 static PyObject *PythonQtStdOutRedirect_write(PyObject *self, PyObject *args)
 {
   PythonQtStdOutRedirect*  s = (PythonQtStdOutRedirect*)self;
@@ -86,17 +174,27 @@ static PyObject *PythonQtStdOutRedirect_write(PyObject *self, PyObject *args)
     }
 
     if (s->softspace > 0) {
-      (*s->_cb)(QString(""));
+      if (!s->_buffer) {
+        (*s->_cb)(QString(""));
+      }
       s->softspace = 0;
     }
 
-    (*s->_cb)(output);
+    if (s->_buffer) {
+      s->_buffer->write(s->_cb, output);
+    } else {
+      (*s->_cb)(output);
+    }
   }
   return Py_BuildValue("");
 }
 
-static PyObject *PythonQtStdOutRedirect_flush(PyObject * /*self*/, PyObject * /*args*/)
+static PyObject *PythonQtStdOutRedirect_flush(PyObject *self, PyObject * /*args*/)
 {
+  PythonQtStdOutRedirect*  s = (PythonQtStdOutRedirect*)self;
+  if (s->_buffer && s->_cb) {
+    s->_buffer->flushCurrentThread(s->_cb);
+  }
   return Py_BuildValue("");
 }
 
@@ -110,7 +208,7 @@ static PyMethodDef PythonQtStdOutRedirect_methods[] = {
   {"write", (PyCFunction)PythonQtStdOutRedirect_write, METH_VARARGS,
   "redirect the writing to a callback"},
   {"flush", (PyCFunction)PythonQtStdOutRedirect_flush, METH_VARARGS,
-  "flush the output, currently not implemented but needed for logging framework"
+  "pass the output that was buffered by the current thread on"
   },
   {"isatty", (PyCFunction)PythonQtStdOutRedirect_isatty,   METH_NOARGS,
   "return False since this object is not a tty-like device. Needed for logging framework"
@@ -133,7 +231,7 @@ PyTypeObject PythonQtStdOutRedirectType = {
     "PythonQtStdOutRedirect",             /*tp_name*/
     sizeof(PythonQtStdOutRedirect),       /*tp_basicsize*/
     0,                         /*tp_itemsize*/
-    nullptr,                   /*tp_dealloc*/
+    (destructor)PythonQtStdOutRedirect_dealloc, /*tp_dealloc*/
     0,                         /*tp_vectorcall_offset*/
     nullptr,                   /*tp_getattr*/
     nullptr,                   /*tp_setattr*/
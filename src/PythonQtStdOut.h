@@ -47,6 +47,9 @@
 
 #include "structmember.h"
 #include <QString>
+#include <QHash>
+#include <QStringList>
+#include <QElapsedTimer>
 
 //! declares the type of the stdout redirection class
 extern PyTypeObject PythonQtStdOutRedirectType;
@@ -54,12 +57,51 @@ extern PyTypeObject PythonQtStdOutRedirectType;
 //! declares the callback that is called from the write() function
 typedef void PythonQtOutputChangedCB(const QString& str);
 
+//! buffers the output of a redirection per thread, so that the callback is called with whole lines
+//! or larger chunks instead of every written fragment (see PythonQt::setRedirectFlushPolicy()).
+//! It is only accessed while holding the GIL.
+class PythonQtStdOutBuffer {
+public:
+  PythonQtStdOutBuffer():_policy(0),_maxBufferSize(4096),_flushInterval(100) {}
+
+  //! set the policy (a combination of PythonQt::RedirectFlushPolicy flags)
+  void setPolicy(int policy, int maxBufferSize, int flushInterval);
+  int policy() const { return _policy; }
+
+  //! adds the text that was written by the current thread and passes it on according to the policy
+  void write(PythonQtOutputChangedCB* cb, const QString& text);
+
+  //! passes the buffered text of the current thread on
+  void flushCurrentThread(PythonQtOutputChangedCB* cb);
+
+  //! passes the buffered text of all threads on, if \c minAge is given, only text that was buffered
+  //! for at least \c minAge milliseconds
+  void flushAll(PythonQtOutputChangedCB* cb, int minAge = 0);
+
+private:
+  struct ThreadBuffer {
+    QString _text;
+    QElapsedTimer _age;
+  };
+
+  //! removes the first \c length characters from the buffer and returns them
+  QString take(ThreadBuffer& buffer, int length);
+
+  QHash<Qt::HANDLE, ThreadBuffer> _threads;
+  int _policy;
+  //! the buffer size for PythonQt::RedirectFlushOnSize
+  int _maxBufferSize;
+  int _flushInterval;
+};
+
 //! declares the stdout redirection class
 struct PythonQtStdOutRedirect {
   PyObject_HEAD
   PythonQtOutputChangedCB* _cb;
   int softspace;
   bool closed;
+  //! the buffer, NULL if the output is passed on unbuffered
+  PythonQtStdOutBuffer* _buffer;
 };
 
 #endif
@@ -57,6 +57,9 @@
     #endif
 #endif
 
+//! the PythonQt version, needs to match VERSION in build/common.prf
+#define PYTHONQT_VERSION_STR "3.2.0"
+#define PYTHONQT_VERSION 0x030200
 
 #endif
 
@@ -40,15 +40,47 @@
 
 #include "PythonQtThreadSupport.h"
 
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QThread>
+
+#include <algorithm>
+
 #ifdef PYTHONQT_GIL_SUPPORT
 
 bool PythonQtGILScope::_enableGILScope = false;
 
-PythonQtGILScope::PythonQtGILScope() : _ensured(false)
+PythonQtGILScope::PythonQtGILScope() : _ensured(false), _measured(false)
+{
+  ensure(nullptr);
+}
+
+PythonQtGILScope::PythonQtGILScope(const char* site) : _ensured(false), _measured(false)
+{
+  ensure(site);
+}
+
+void PythonQtGILScope::ensure(const char* site)
 {
   if (_enableGILScope) {
+    PythonQtTraceScope trace(PythonQtTrace::GILWaits);
+    if (trace.isEnabled()) {
+      trace.begin(nullptr, "PyGILState_Ensure");
+    }
+#ifdef PY3K
+    // nested scopes do not wait, only measure the outermost acquisition
+    _measured = PythonQtGILStatistics::isEnabled() && !PyGILState_Check();
+#endif
+    const qint64 waitStart = _measured ? PythonQtGILStatistics::now() : 0;
     _state = PyGILState_Ensure();
+    if (_measured) {
+      PythonQtGILStatistics::acquired(site ? site : "<untagged>", PythonQtGILStatistics::now() - waitStart, true);
+    }
+    trace.end();
     _ensured = true;
+    PythonQtDeferredDecref::drain();
   }
 }
 
@@ -60,6 +92,10 @@ PythonQtGILScope::~PythonQtGILScope()
 void PythonQtGILScope::release()
 {
   if (_ensured) {
+    if (_measured) {
+      PythonQtGILStatistics::releasing();
+      _measured = false;
+    }
     PyGILState_Release(_state);
     _ensured = false;
   }
@@ -75,4 +111,224 @@ bool PythonQtGILScope::isGILScopeEnabled()
   return _enableGILScope;
 }
 
+bool PythonQtGILScope::currentThreadHoldsGIL()
+{
+  if (!_enableGILScope) {
+    return true;
+  }
+#ifdef PY3K
+  return PyGILState_Check() != 0;
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+
+std::atomic<PythonQtDeferredDecref::Node*> PythonQtDeferredDecref::_head(nullptr);
+std::atomic<int> PythonQtDeferredDecref::_pendingCount(0);
+std::atomic<int> PythonQtDeferredDecref::_maxPendingCount(0);
+std::atomic<qint64> PythonQtDeferredDecref::_totalCount(0);
+
+void PythonQtDeferredDecref::push(PyObject* object)
+{
+  // count before publishing the node, otherwise a drain could subtract it first and the count would become negative
+  _totalCount.fetch_add(1, std::memory_order_relaxed);
+  int pending = _pendingCount.fetch_add(1, std::memory_order_relaxed) + 1;
+  int maxPending = _maxPendingCount.load(std::memory_order_relaxed);
+  while (pending > maxPending && !_maxPendingCount.compare_exchange_weak(maxPending, pending, std::memory_order_relaxed)) {
+  }
+
+  Node* node = new Node;
+  node->object = object;
+  node->next = _head.load(std::memory_order_relaxed);
+  while (!_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+}
+
+void PythonQtDeferredDecref::drainQueue()
+{
+  // take the whole queue at once, so that pushing threads never wait for us
+  Node* node = _head.exchange(nullptr, std::memory_order_acquire);
+  int count = 0;
+  while (node) {
+    Node* next = node->next;
+    Py_DECREF(node->object);
+    delete node;
+    node = next;
+    count++;
+  }
+  _pendingCount.fetch_sub(count, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------
+
+std::atomic<bool> PythonQtGILStatistics::_enabled(false);
+
+namespace {
+
+struct PythonQtGILHoldState
+{
+  bool holding;
+  qint64 start;
+  const char* site;
+};
+
+thread_local PythonQtGILHoldState pythonQtGILHoldState = { false, 0, nullptr };
+
+//! protects the thread and site statistics, it is taken when a measured wait or hold is recorded and by the readers
+//! (the hold state above is thread local and is accessed without locking)
+QMutex pythonQtGILStatisticsMutex;
+QHash<Qt::HANDLE, PythonQtGILThreadStatistics> pythonQtGILThreads;
+QHash<const char*, PythonQtGILSiteStatistics> pythonQtGILSites;
+
+}
+
+static int PythonQtGILStatistics_bucket(qint64 ns)
+{
+  qint64 us = ns / 1000;
+  int bucket = 0;
+  while (us > 0 && bucket < PythonQtGILStatistics::HistogramBuckets - 1) {
+    us >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+//! returns the statistics of the current thread, the mutex has to be locked
+static PythonQtGILThreadStatistics& PythonQtGILStatistics_currentThread()
+{
+  Qt::HANDLE id = QThread::currentThreadId();
+  QHash<Qt::HANDLE, PythonQtGILThreadStatistics>::iterator it = pythonQtGILThreads.find(id);
+  if (it == pythonQtGILThreads.end()) {
+    PythonQtGILThreadStatistics statistics;
+    QThread* thread = QThread::currentThread();
+    statistics.threadName = thread->objectName();
+    if (statistics.threadName.isEmpty()) {
+      if (QCoreApplication::instance() && QCoreApplication::instance()->thread() == thread) {
+        statistics.threadName = "main";
+      } else {
+        statistics.threadName = "thread 0x" + QString::number(quintptr(id), 16);
+      }
+    }
+    statistics.waitHistogram.fill(0, PythonQtGILStatistics::HistogramBuckets);
+    statistics.holdHistogram.fill(0, PythonQtGILStatistics::HistogramBuckets);
+    it = pythonQtGILThreads.insert(id, statistics);
+  }
+  return it.value();
+}
+
+//! returns the statistics of the given site, the mutex has to be locked
+static PythonQtGILSiteStatistics& PythonQtGILStatistics_site(const char* site)
+{
+  PythonQtGILSiteStatistics& statistics = pythonQtGILSites[site];
+  if (statistics.site.isEmpty()) {
+    statistics.site = site;
+  }
+  return statistics;
+}
+
+void PythonQtGILStatistics::setEnabled(bool flag)
+{
+  _enabled.store(flag, std::memory_order_relaxed);
+}
+
+void PythonQtGILStatistics::reset()
+{
+  QMutexLocker locker(&pythonQtGILStatisticsMutex);
+  pythonQtGILThreads.clear();
+  pythonQtGILSites.clear();
+}
+
+QList<PythonQtGILThreadStatistics> PythonQtGILStatistics::threadStatistics()
+{
+  QMutexLocker locker(&pythonQtGILStatisticsMutex);
+  return pythonQtGILThreads.values();
+}
+
+QList<PythonQtGILSiteStatistics> PythonQtGILStatistics::topSites(int count)
+{
+  QList<PythonQtGILSiteStatistics> sites;
+  {
+    QMutexLocker locker(&pythonQtGILStatisticsMutex);
+    // identical literals of different translation units may have different addresses
+    QHash<QByteArray, PythonQtGILSiteStatistics> merged;
+    Q_FOREACH(const PythonQtGILSiteStatistics& site, pythonQtGILSites) {
+      PythonQtGILSiteStatistics& target = merged[site.site];
+      target.site = site.site;
+      target.acquisitions += site.acquisitions;
+      target.totalWaitNs += site.totalWaitNs;
+      target.maxWaitNs = qMax(target.maxWaitNs, site.maxWaitNs);
+      target.totalHoldNs += site.totalHoldNs;
+    }
+    sites = merged.values();
+  }
+  std::sort(sites.begin(), sites.end(), [](const PythonQtGILSiteStatistics& a, const PythonQtGILSiteStatistics& b) {
+    return a.totalWaitNs > b.totalWaitNs;
+  });
+  if (count >= 0 && sites.size() > count) {
+    sites.erase(sites.begin() + count, sites.end());
+  }
+  return sites;
+}
+
+qint64 PythonQtGILStatistics::bucketUpperBoundUs(int bucket)
+{
+  if (bucket < 0 || bucket >= HistogramBuckets - 1) {
+    return -1;
+  }
+  return qint64(1) << bucket;
+}
+
+qint64 PythonQtGILStatistics::now()
+{
+  static QElapsedTimer clock = []() { QElapsedTimer timer; timer.start(); return timer; }();
+  return clock.nsecsElapsed();
+}
+
+void PythonQtGILStatistics::acquired(const char* site, qint64 waitNs, bool trackHold, const char* holdSite)
+{
+  {
+    QMutexLocker locker(&pythonQtGILStatisticsMutex);
+    PythonQtGILThreadStatistics& thread = PythonQtGILStatistics_currentThread();
+    thread.acquisitions++;
+    thread.totalWaitNs += waitNs;
+    thread.maxWaitNs = qMax(thread.maxWaitNs, waitNs);
+    thread.waitHistogram[PythonQtGILStatistics_bucket(waitNs)]++;
+
+    PythonQtGILSiteStatistics& siteStatistics = PythonQtGILStatistics_site(site);
+    siteStatistics.acquisitions++;
+    siteStatistics.totalWaitNs += waitNs;
+    siteStatistics.maxWaitNs = qMax(siteStatistics.maxWaitNs, waitNs);
+  }
+  PythonQtGILHoldState& state = pythonQtGILHoldState;
+  state.holding = trackHold;
+  state.site = holdSite ? holdSite : site;
+  state.start = now();
+}
+
+const char* PythonQtGILStatistics::currentHoldSite()
+{
+  const PythonQtGILHoldState& state = pythonQtGILHoldState;
+  return state.holding ? state.site : nullptr;
+}
+
+bool PythonQtGILStatistics::releasing()
+{
+  PythonQtGILHoldState& state = pythonQtGILHoldState;
+  if (!state.holding) {
+    return false;
+  }
+  state.holding = false;
+  qint64 holdNs = now() - state.start;
+
+  QMutexLocker locker(&pythonQtGILStatisticsMutex);
+  PythonQtGILThreadStatistics& thread = PythonQtGILStatistics_currentThread();
+  thread.totalHoldNs += holdNs;
+  thread.maxHoldNs = qMax(thread.maxHoldNs, holdNs);
+  thread.holdHistogram[PythonQtGILStatistics_bucket(holdNs)]++;
+  PythonQtGILStatistics_site(state.site).totalHoldNs += holdNs;
+  return true;
+}
+
 #endif
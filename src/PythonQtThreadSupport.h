@@ -40,8 +40,15 @@
 //----------------------------------------------------------------------------------
 
 #include <QtGlobal> //Q_DISABLE_COPY
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QVector>
 #include "PythonQtPythonInclude.h"
 #include "PythonQtSystem.h"
+#include "PythonQtTrace.h"
+
+#include <atomic>
 
 #define PYTHONQT_FULL_THREAD_SUPPORT
 
@@ -53,6 +60,9 @@
 #ifdef PYTHONQT_GIL_SUPPORT
 
 #define PYTHONQT_GIL_SCOPE PythonQtGILScope internal_pythonqt_gilscope;
+//! Like PYTHONQT_GIL_SCOPE, but attributes the acquisition to the given site in the PythonQtGILStatistics,
+//! the site has to be a string literal.
+#define PYTHONQT_GIL_SITE_SCOPE(site) PythonQtGILScope internal_pythonqt_gilscope(site);
 
 //! Ensures/releases the Python GIL
 //! An instance of this class can be used to
@@ -61,6 +71,8 @@ class PYTHONQT_EXPORT PythonQtGILScope
 {
 public:
   PythonQtGILScope();
+  //! The site tags the acquisition for the PythonQtGILStatistics, it has to stay valid (e.g. a string literal).
+  explicit PythonQtGILScope(const char* site);
 
   ~PythonQtGILScope();
 
@@ -73,22 +85,141 @@ public:
   //! Check if GIL scopes are enabled.
   static bool isGILScopeEnabled();
 
+  //! Returns true if the current thread holds the GIL (always true if GIL scopes are disabled).
+  //! With Python 2, this always returns false if GIL scopes are enabled.
+  static bool currentThreadHoldsGIL();
+
 private:
+  void ensure(const char* site);
+
   PyGILState_STATE _state;
   bool _ensured;
+  bool _measured;
 
   static bool _enableGILScope;
 };
 
+//! A lock-free queue of Python objects whose last C++ reference was dropped by a thread that did not
+//! hold the GIL (see PythonQtSafeObjectPtr). Instead of waiting for the GIL, the decref is queued and
+//! done the next time a thread enters Python via a PythonQtGILScope (Python 3 only).
+class PYTHONQT_EXPORT PythonQtDeferredDecref
+{
+public:
+  //! Queues a decref of the object, does not need the GIL.
+  static void push(PyObject* object);
+
+  //! Does all queued decrefs, the caller has to hold the GIL.
+  static void drain() {
+    if (_head.load(std::memory_order_relaxed)) {
+      drainQueue();
+    }
+  }
+
+  //! Number of currently queued decrefs
+  static int pendingCount() { return _pendingCount.load(std::memory_order_relaxed); }
+  //! Highest number of queued decrefs seen so far
+  static int maxPendingCount() { return _maxPendingCount.load(std::memory_order_relaxed); }
+  //! Total number of decrefs that have been deferred
+  static qint64 totalCount() { return _totalCount.load(std::memory_order_relaxed); }
+
+private:
+  struct Node {
+    PyObject* object;
+    Node* next;
+  };
+
+  static void drainQueue();
+
+  static std::atomic<Node*> _head;
+  static std::atomic<int> _pendingCount;
+  static std::atomic<int> _maxPendingCount;
+  static std::atomic<qint64> _totalCount;
+};
+
+//! The GIL statistics of one thread, see PythonQtGILStatistics.
+struct PYTHONQT_EXPORT PythonQtGILThreadStatistics
+{
+  PythonQtGILThreadStatistics():acquisitions(0),totalWaitNs(0),maxWaitNs(0),totalHoldNs(0),maxHoldNs(0) {}
+
+  QString threadName;
+  //! number of times the thread acquired the GIL
+  qint64 acquisitions;
+  qint64 totalWaitNs;
+  qint64 maxWaitNs;
+  qint64 totalHoldNs;
+  qint64 maxHoldNs;
+  //! number of waits per bucket, see PythonQtGILStatistics::bucketUpperBoundUs()
+  QVector<qint64> waitHistogram;
+  //! number of measured holds per bucket
+  QVector<qint64> holdHistogram;
+};
+
+//! The GIL statistics of one acquisition site, see PythonQtGILStatistics.
+struct PYTHONQT_EXPORT PythonQtGILSiteStatistics
+{
+  PythonQtGILSiteStatistics():acquisitions(0),totalWaitNs(0),maxWaitNs(0),totalHoldNs(0) {}
+
+  QByteArray site;
+  qint64 acquisitions;
+  qint64 totalWaitNs;
+  qint64 maxWaitNs;
+  qint64 totalHoldNs;
+};
+
+//! Optional instrumentation of the GIL acquisitions of PythonQtGILScope and PythonQtThreadStateSaver.
+/*! When enabled, each acquisition by a thread that did not hold the GIL records how long the thread waited
+    for it, and how long it held the GIL until PythonQt released it again (holds that end inside of the Python
+    interpreter are not seen). Acquisitions are attributed to the site given to PYTHONQT_GIL_SITE_SCOPE(),
+    other GIL scopes are reported as "<untagged>". The waits for reacquiring the GIL after PYTHONQT_ALLOW_THREADS_SCOPE
+    are reported as "<allow threads>", the hold that follows stays attributed to the site of the enclosing scope.
+    Only acquisitions via PythonQtThreadStateSaver are recorded with Python 2, since it can't check if a thread holds the GIL.
+*/
+class PYTHONQT_EXPORT PythonQtGILStatistics
+{
+public:
+  enum { HistogramBuckets = 24 };
+
+  //! Enables/disables recording, it is disabled by default.
+  static void setEnabled(bool flag);
+  static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+  //! Discards the recorded statistics.
+  static void reset();
+
+  //! Returns the statistics of all threads that acquired the GIL.
+  static QList<PythonQtGILThreadStatistics> threadStatistics();
+  //! Returns the count sites with the highest total wait time.
+  static QList<PythonQtGILSiteStatistics> topSites(int count = 10);
+  //! Returns the exclusive upper bound of the histogram bucket in microseconds, -1 for the last (unbounded) bucket.
+  //! The first bucket counts times below 1 microsecond, each further bucket doubles the bound.
+  static qint64 bucketUpperBoundUs(int bucket);
+
+  //! Returns a monotonic time stamp in nanoseconds.
+  static qint64 now();
+  //! Records that the current thread acquired the GIL after waiting waitNs,
+  //! with trackHold, the hold time is measured until releasing() is called and attributed to holdSite
+  //! (or to site if holdSite is nullptr).
+  static void acquired(const char* site, qint64 waitNs, bool trackHold, const char* holdSite = nullptr);
+  //! Records the end of the hold of the current thread, returns false if its hold time was not measured.
+  static bool releasing();
+  //! Returns the site of the measured hold of the current thread, or nullptr if its hold is not measured.
+  static const char* currentHoldSite();
+
+private:
+  static std::atomic<bool> _enabled;
+};
+
 #else
 
 #define PYTHONQT_GIL_SCOPE
+#define PYTHONQT_GIL_SITE_SCOPE(site)
 
 //! Empty dummy implementation.
 class PythonQtGILScope
 {
 public:
   PythonQtGILScope() {}
+  explicit PythonQtGILScope(const char*) {}
   void release() {}
 };
 
@@ -105,7 +236,7 @@ class PythonQtThreadStateSaver
 {
   Q_DISABLE_COPY(PythonQtThreadStateSaver)
 public:
-  PythonQtThreadStateSaver() {
+  PythonQtThreadStateSaver() : _state(nullptr), _trackHold(false), _holdSite(nullptr) {
     save();
   }
 
@@ -114,18 +245,32 @@ public:
   }
 
   void save() {
+    // the hold is measured again after restore() if it was measured so far, it still belongs to the enclosing site
+    _holdSite = PythonQtGILStatistics::isEnabled() ? PythonQtGILStatistics::currentHoldSite() : nullptr;
+    _trackHold = _holdSite && PythonQtGILStatistics::releasing();
     _state = PyEval_SaveThread();
   }
 
   void restore() {
     if (_state) {
+      PythonQtTraceScope trace(PythonQtTrace::GILWaits);
+      if (trace.isEnabled()) {
+        trace.begin(nullptr, "PyEval_RestoreThread");
+      }
+      const bool measure = PythonQtGILStatistics::isEnabled();
+      const qint64 waitStart = measure ? PythonQtGILStatistics::now() : 0;
       PyEval_RestoreThread(_state);
+      if (measure) {
+        PythonQtGILStatistics::acquired("<allow threads>", PythonQtGILStatistics::now() - waitStart, _trackHold, _holdSite);
+      }
       _state = nullptr;
     }
   }
 
 private:
   PyThreadState* _state;
+  bool _trackHold;
+  const char* _holdSite;
 };
 
 #else
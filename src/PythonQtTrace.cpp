@@ -0,0 +1,342 @@
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtTrace.cpp
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtTrace.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QList>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+
+#include <cstring>
+
+std::atomic<int> PythonQtTrace::_categories(0);
+
+namespace {
+
+struct PythonQtTraceEvent
+{
+  qint64 timestamp;
+  char phase;
+  char category;
+  char className[46];
+  char name[72];
+};
+
+struct PythonQtTraceBuffer
+{
+  PythonQtTraceBuffer(int bufferSize)
+    : events(new PythonQtTraceEvent[bufferSize]), size(bufferSize), head(0), start(0), finished(false), threadId(0) {}
+  ~PythonQtTraceBuffer() { delete[] events; }
+
+  PythonQtTraceEvent* events;
+  quint64 size;
+  //! the number of events that were written by the thread
+  std::atomic<quint64> head;
+  //! the index of the first event after the last clear()
+  std::atomic<quint64> start;
+  //! set when the thread has finished, the buffer is deleted by the next clear() or reused by a new thread
+  std::atomic<bool> finished;
+  int threadId;
+  QByteArray threadName;
+};
+
+//! deletes nothing, but tells clear() that the buffer is no longer written when the thread finishes
+struct PythonQtTraceThreadBuffer
+{
+  PythonQtTraceThreadBuffer():buffer(nullptr) {}
+  ~PythonQtTraceThreadBuffer() {
+    if (buffer) {
+      buffer->finished.store(true, std::memory_order_release);
+      buffer = nullptr;
+    }
+  }
+
+  PythonQtTraceBuffer* buffer;
+};
+
+thread_local PythonQtTraceThreadBuffer pythonQtTraceThreadBuffer;
+
+//! protects the list of buffers, it is not used for recording events
+QMutex pythonQtTraceMutex;
+QList<PythonQtTraceBuffer*> pythonQtTraceBuffers;
+int pythonQtTraceThreadCount = 0;
+std::atomic<int> pythonQtTraceBufferSize(16384);
+//! the number of buffers of finished threads that are kept, so that short lived threads don't add up
+const int pythonQtTraceMaxFinishedBuffers = 16;
+
+const char* const pythonQtTraceCategoryNames[] = { "slot", "signal", "virtual", "property", "import", "gil" };
+
+}
+
+static qint64 PythonQtTrace_now()
+{
+  static QElapsedTimer clock = []() { QElapsedTimer timer; timer.start(); return timer; }();
+  return clock.nsecsElapsed();
+}
+
+static int PythonQtTrace_categoryIndex(PythonQtTrace::Category category)
+{
+  int index = 0;
+  while (index < 5 && !(category & (1 << index))) {
+    index++;
+  }
+  return index;
+}
+
+static void PythonQtTrace_copyName(char* target, int size, const char* source)
+{
+  int length = source ? (int)qstrnlen(source, size) : 0;
+  if (length >= size) {
+    // truncate, but do not split a UTF-8 sequence
+    length = size - 1;
+    while (length > 0 && (uchar(source[length]) & 0xc0) == 0x80) {
+      length--;
+    }
+  }
+  memcpy(target, source, length);
+  target[length] = 0;
+}
+
+//! removes the oldest buffer of a finished thread if the maximum number of them is kept, returns it for reuse
+//! if it has the given size, the mutex has to be locked
+static PythonQtTraceBuffer* PythonQtTrace_takeFinishedBuffer(int size)
+{
+  PythonQtTraceBuffer* oldest = nullptr;
+  int finishedCount = 0;
+  Q_FOREACH(PythonQtTraceBuffer* buffer, pythonQtTraceBuffers) {
+    if (buffer->finished.load(std::memory_order_acquire)) {
+      if (!oldest) {
+        oldest = buffer;
+      }
+      finishedCount++;
+    }
+  }
+  if (finishedCount < pythonQtTraceMaxFinishedBuffers) {
+    return nullptr;
+  }
+  pythonQtTraceBuffers.removeOne(oldest);
+  if (oldest->size != quint64(size)) {
+    delete oldest;
+    return nullptr;
+  }
+  oldest->head.store(0, std::memory_order_relaxed);
+  oldest->start.store(0, std::memory_order_relaxed);
+  oldest->finished.store(false, std::memory_order_relaxed);
+  return oldest;
+}
+
+static PythonQtTraceBuffer* PythonQtTrace_threadBuffer()
+{
+  PythonQtTraceBuffer* buffer = pythonQtTraceThreadBuffer.buffer;
+  if (!buffer) {
+    const int size = pythonQtTraceBufferSize.load(std::memory_order_relaxed);
+    QThread* thread = QThread::currentThread();
+    QByteArray threadName = thread->objectName().toUtf8();
+    if (threadName.isEmpty() && QCoreApplication::instance() && QCoreApplication::instance()->thread() == thread) {
+      threadName = "main";
+    }
+    QMutexLocker locker(&pythonQtTraceMutex);
+    buffer = PythonQtTrace_takeFinishedBuffer(size);
+    if (!buffer) {
+      buffer = new PythonQtTraceBuffer(size);
+    }
+    buffer->threadName = threadName;
+    buffer->threadId = ++pythonQtTraceThreadCount;
+    pythonQtTraceBuffers.append(buffer);
+    pythonQtTraceThreadBuffer.buffer = buffer;
+  }
+  return buffer;
+}
+
+static void PythonQtTrace_record(char phase, PythonQtTrace::Category category, const char* className, const char* name)
+{
+  PythonQtTraceBuffer* buffer = PythonQtTrace_threadBuffer();
+  quint64 index = buffer->head.load(std::memory_order_relaxed);
+  PythonQtTraceEvent& event = buffer->events[index % buffer->size];
+  event.timestamp = PythonQtTrace_now();
+  event.phase = phase;
+  event.category = char(PythonQtTrace_categoryIndex(category));
+  if (phase == 'B') {
+    PythonQtTrace_copyName(event.className, sizeof(event.className), className);
+    PythonQtTrace_copyName(event.name, sizeof(event.name), name);
+  }
+  // publish the event to toChromeTraceJson()
+  buffer->head.store(index + 1, std::memory_order_release);
+}
+
+static void PythonQtTrace_appendEscaped(QByteArray& json, const char* string)
+{
+  for (const char* c = string; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      json += '\\';
+      json += *c;
+    } else if (uchar(*c) < 0x20) {
+      char escaped[8];
+      qsnprintf(escaped, sizeof(escaped), "\\u%04x", uchar(*c));
+      json += escaped;
+    } else {
+      json += *c;
+    }
+  }
+}
+
+void PythonQtTrace::setCategories(int categories)
+{
+  // start the clock before the first event
+  PythonQtTrace_now();
+  _categories.store(categories & AllCategories, std::memory_order_relaxed);
+}
+
+void PythonQtTrace::setBufferSize(int events)
+{
+  pythonQtTraceBufferSize.store(qMax(events, 16), std::memory_order_relaxed);
+}
+
+int PythonQtTrace::bufferSize()
+{
+  return pythonQtTraceBufferSize.load(std::memory_order_relaxed);
+}
+
+void PythonQtTrace::begin(Category category, const char* className, const char* name)
+{
+  PythonQtTrace_record('B', category, className, name);
+}
+
+void PythonQtTrace::end(Category category)
+{
+  PythonQtTrace_record('E', category, nullptr, nullptr);
+}
+
+void PythonQtTrace::clear()
+{
+  QMutexLocker locker(&pythonQtTraceMutex);
+  QList<PythonQtTraceBuffer*>::iterator it = pythonQtTraceBuffers.begin();
+  while (it != pythonQtTraceBuffers.end()) {
+    PythonQtTraceBuffer* buffer = *it;
+    if (buffer->finished.load(std::memory_order_acquire)) {
+      delete buffer;
+      it = pythonQtTraceBuffers.erase(it);
+    } else {
+      buffer->start.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+      ++it;
+    }
+  }
+}
+
+QByteArray PythonQtTrace::toChromeTraceJson()
+{
+  const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+  QByteArray json("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  bool first = true;
+
+  QMutexLocker locker(&pythonQtTraceMutex);
+  Q_FOREACH(PythonQtTraceBuffer* buffer, pythonQtTraceBuffers) {
+    const QByteArray tid = QByteArray::number(buffer->threadId);
+    const QByteArray threadName = buffer->threadName.isEmpty() ? "thread " + tid : buffer->threadName;
+    json += first ? "\n" : ",\n";
+    first = false;
+    json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"name\":\"";
+    PythonQtTrace_appendEscaped(json, threadName.constData());
+    json += "\"}}";
+
+    // copy the events without stopping the thread, then drop those that were overwritten while copying
+    quint64 end = buffer->head.load(std::memory_order_acquire);
+    quint64 begin = qMax(buffer->start.load(std::memory_order_relaxed), end > buffer->size ? end - buffer->size : quint64(0));
+    QVector<PythonQtTraceEvent> events;
+    events.reserve(int(end - begin));
+    for (quint64 i = begin; i < end; i++) {
+      events.append(buffer->events[i % buffer->size]);
+    }
+    quint64 endAfterCopy = buffer->head.load(std::memory_order_acquire);
+    quint64 firstValid = endAfterCopy >= buffer->size ? endAfterCopy - buffer->size + 1 : 0;
+    int skip = firstValid > begin ? int(qMin(firstValid - begin, end - begin)) : 0;
+
+    int depth = 0;
+    for (int i = skip; i < events.size(); i++) {
+      const PythonQtTraceEvent& event = events.at(i);
+      if (event.phase == 'E') {
+        if (depth == 0) {
+          // the begin event was overwritten or cleared
+          continue;
+        }
+        depth--;
+      } else {
+        depth++;
+      }
+      json += ",\n{\"ph\":\"";
+      json += event.phase;
+      json += "\",\"cat\":\"";
+      json += pythonQtTraceCategoryNames[int(event.category)];
+      json += "\",\"ts\":" + QByteArray::number(event.timestamp / 1000., 'f', 3) + ",\"pid\":" + pid + ",\"tid\":" + tid;
+      if (event.phase == 'B') {
+        json += ",\"name\":\"";
+        if (event.className[0]) {
+          PythonQtTrace_appendEscaped(json, event.className);
+          json += "::";
+        }
+        PythonQtTrace_appendEscaped(json, event.name);
+        json += "\"";
+        if (event.className[0]) {
+          json += ",\"args\":{\"class\":\"";
+          PythonQtTrace_appendEscaped(json, event.className);
+          json += "\"}";
+        }
+      }
+      json += "}";
+    }
+  }
+  json += "\n]}\n";
+  return json;
+}
+
+bool PythonQtTrace::writeChromeTrace(const QString& filename)
+{
+  QByteArray json = toChromeTraceJson();
+  QFile file(filename);
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+    return false;
+  }
+  return file.write(json) == json.size();
+}
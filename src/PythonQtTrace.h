@@ -0,0 +1,143 @@
+#ifndef _PYTHONQTTRACE_H
+#define _PYTHONQTTRACE_H
+
+/*
+ *
+ *  Copyright (C) 2026 MeVis Medical Solutions AG All Rights Reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  Further, this software is distributed without any warranty that it is
+ *  free of the rightful claim of any third person regarding infringement
+ *  or the like.  Any license provided herein, whether implied or
+ *  otherwise, applies only to this software file.  Patent licenses, if
+ *  any, provided herein do not apply to combinations of this program with
+ *  other software, or any other product whatsoever.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact information: MeVis Medical Solutions AG, Universitaetsallee 29,
+ *  28359 Bremen, Germany or:
+ *
+ *  http://www.mevis.de
+ *
+ */
+
+//----------------------------------------------------------------------------------
+/*!
+// \file    PythonQtTrace.h
+// \author  agent
+// \author  Last changed by $Author: agent $
+// \date    2026-10
+*/
+//----------------------------------------------------------------------------------
+
+#include "PythonQtSystem.h"
+
+#include <QByteArray>
+#include <QString>
+#include <QtGlobal>
+
+#include <atomic>
+
+//! Records begin/end events of crossings between Python and C++ into a ring buffer per thread,
+//! the events can be written as Chrome trace event JSON (viewable in chrome://tracing or ui.perfetto.dev).
+/*! Tracing is disabled by default, a disabled category costs one relaxed atomic load per crossing.
+    Each thread writes into its own fixed size ring buffer without locking, the oldest events are
+    overwritten when the buffer is full. The buffers of the last finished threads are kept for
+    toChromeTraceJson(), older ones are reused by new threads. Class and method names are copied into the events
+    (and truncated if they are too long), so they may be temporary strings.
+*/
+class PYTHONQT_EXPORT PythonQtTrace
+{
+public:
+  enum Category {
+    SlotCalls  = 1,  //!< calls of C++ slots and decorator slots from Python
+    Signals    = 2,  //!< deliveries of Qt signals to Python signal handlers
+    Virtuals   = 4,  //!< calls of Python overrides of C++ virtual methods
+    Properties = 8,  //!< reads and writes of Qt properties from Python
+    Imports    = 16, //!< modules loaded by the PythonQt importer
+    GILWaits   = 32, //!< waiting for the GIL
+    AllCategories = 63
+  };
+
+  //! enables tracing of the given categories (a combination of Category flags), 0 disables tracing
+  static void setCategories(int categories);
+  //! returns the enabled categories
+  static int categories() { return _categories.load(std::memory_order_relaxed); }
+  //! returns if the given category is traced
+  static bool isEnabled(Category category) { return (_categories.load(std::memory_order_relaxed) & category) != 0; }
+
+  //! sets the number of events in the ring buffer of each thread (default 16384),
+  //! only applies to threads that record their first event afterwards
+  static void setBufferSize(int events);
+  //! returns the number of events in the ring buffer of each thread
+  static int bufferSize();
+
+  //! records the begin of a crossing in the current thread
+  static void begin(Category category, const char* className, const char* name);
+  //! records the end of the last crossing that was begun in the current thread
+  static void end(Category category);
+
+  //! discards all recorded events
+  static void clear();
+
+  //! returns the recorded events of all threads as Chrome trace event JSON,
+  //! can be called while other threads are still recording
+  static QByteArray toChromeTraceJson();
+  //! writes toChromeTraceJson() to the given file, returns false if the file could not be written
+  static bool writeChromeTrace(const QString& filename);
+
+private:
+  static std::atomic<int> _categories;
+};
+
+//! Records a begin event and the matching end event when it goes out of scope (or end() is called).
+/*! The names are only needed if the category is enabled, so they are passed to begin() after checking isEnabled():
+    \code
+    PythonQtTraceScope trace(PythonQtTrace::SlotCalls);
+    if (trace.isEnabled()) {
+      trace.begin(className, info->signature());
+    }
+    \endcode
+*/
+class PythonQtTraceScope
+{
+  Q_DISABLE_COPY(PythonQtTraceScope)
+public:
+  explicit PythonQtTraceScope(PythonQtTrace::Category category):_category(category),_begun(false) {}
+  ~PythonQtTraceScope() { end(); }
+
+  //! returns if the category of the scope is traced
+  bool isEnabled() const { return PythonQtTrace::isEnabled(_category); }
+
+  //! records the begin event
+  void begin(const char* className, const char* name) {
+    PythonQtTrace::begin(_category, className, name);
+    _begun = true;
+  }
+
+  //! records the end event, if begin() was called
+  void end() {
+    if (_begun) {
+      PythonQtTrace::end(_category);
+      _begun = false;
+    }
+  }
+
+private:
+  PythonQtTrace::Category _category;
+  bool _begun;
+};
+
+#endif
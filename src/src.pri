@@ -42,6 +42,14 @@ HEADERS +=                    \
   $$PWD/PythonQtUtils.h \
   $$PWD/PythonQtBoolResult.h \
   $$PWD/PythonQtThreadSupport.h \
+  $$PWD/PythonQtAsyncio.h \
+  $$PWD/PythonQtContainerView.h \
+  $$PWD/PythonQtErrorMessage.h \
+  $$PWD/PythonQtCallable.h \
+  $$PWD/PythonQtBytecodeCompiler.h \
+  $$PWD/PythonQtTrace.h \
+  $$PWD/PythonQtCallRecorder.h \
+  $$PWD/PythonQtStartupProfile.h \
   
 SOURCES +=                    \
   $$PWD/PythonQtStdDecorators.cpp   \
@@ -65,6 +73,13 @@ SOURCES +=                    \
   $$PWD/PythonQtBoolResult.cpp      \
   $$PWD/gui/PythonQtScriptingConsole.cpp \
   $$PWD/PythonQtThreadSupport.cpp \
+  $$PWD/PythonQtAsyncio.cpp \
+  $$PWD/PythonQtContainerView.cpp \
+  $$PWD/PythonQtErrorMessage.cpp \
+  $$PWD/PythonQtBytecodeCompiler.cpp \
+  $$PWD/PythonQtTrace.cpp \
+  $$PWD/PythonQtCallRecorder.cpp \
+  $$PWD/PythonQtStartupProfile.cpp \
 
 
 
@@ -40,6 +40,18 @@
 //----------------------------------------------------------------------------------
 
 #include "PythonQtTests.h"
+#include "PythonQtMethodInfo.h"
+#include "PythonQtClassInfo.h"
+#include "PythonQtCallable.h"
+#include "PythonQtBytecodeCompiler.h"
+#include "PythonQtImporter.h"
+#include "PythonQtTrace.h"
+#include "PythonQtCallRecorder.h"
+#include "PythonQtStartupProfile.h"
+#include "PythonQtStdDecorators.h"
+
+#include <QJsonDocument>
+#include <QTemporaryDir>
 
 void PythonQtMemoryTests::testBaseCleanup()
 {
@@ -78,6 +90,34 @@ void PythonQtMemoryTests::testInitWithPreconfig() {
 #endif
 }
 
+void PythonQtMemoryTests::testMethodInfoCacheRoundTrip()
+{
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  QString fileName = dir.filePath("methodinfos.cache");
+  const char* args[] = { "void", "QRectF", "const QByteArray&", "qint8" };
+
+  PythonQt::init();
+  QVERIFY(!PythonQt::self()->setMethodInfoCacheFile(fileName, "test"));
+  QVERIFY(PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, args));
+  // cleanup writes the cache file and forgets all parsed signatures
+  PythonQt::cleanup();
+  QVERIFY(QFile::exists(fileName));
+  QCOMPARE(PythonQtMethodInfo::cachedSignatureCount(), 0);
+
+  PythonQt::init();
+  QVERIFY(PythonQt::self()->setMethodInfoCacheFile(fileName, "test"));
+  int pending = PythonQtMethodInfo::persistentSignatureCount();
+  QVERIFY(pending > 0);
+  // the signature is taken from the cache instead of being parsed again
+  const PythonQtMethodInfo* info = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(4, args);
+  QCOMPARE(PythonQtMethodInfo::persistentSignatureCount(), pending - 1);
+  QCOMPARE(info->parameterCount(), 4);
+  QVERIFY(info->parameters().at(2).isConst);
+  QVERIFY(info->parameters().at(2).isReference);
+  PythonQt::cleanup();
+}
+
 void PythonQtTestSlotCalling::initTestCase()
 {
   _helper = new PythonQtTestSlotCallingHelper(this);
@@ -163,6 +203,36 @@ void PythonQtTestSlotCalling::testInheritance() {
 
 }
 
+void PythonQtTestSlotCalling::testLateParentClassWithOffset() {
+  PythonQt::self()->registerCPPClass("ClassB",NULL,NULL, PythonQtCreateObject<ClassBWrapper>);
+  PythonQt::self()->registerCPPClass("ClassE",NULL,NULL, PythonQtCreateObject<ClassEWrapper>);
+  PythonQtClassInfo* infoB = PythonQt::priv()->getClassInfo("ClassB");
+  PythonQtClassInfo* infoE = PythonQt::priv()->getClassInfo("ClassE");
+  QVERIFY(infoB);
+  QVERIFY(infoE);
+
+  // build the ancestor table of ClassE before ClassB is added as its parent class
+  ClassE e;
+  QVERIFY(!infoE->inherits("ClassB"));
+  QVERIFY(infoE->findAncestor("ClassB") == NULL);
+  QVERIFY(infoE->castTo(&e, infoB) == NULL);
+  QEXPECT_FAIL("", "ClassE can not be converted to ClassB before ClassB is added as parent class", Continue);
+  QVERIFY(_helper->runScript("a = PythonQt.private.ClassE();\nif obj.getClassBPtr(a).getY()==2: obj.setPassed();\n"));
+
+  int offset = PythonQtUpcastingOffset<ClassE,ClassB>();
+  QVERIFY(offset != 0);
+  PythonQt::self()->addParentClass("ClassE", "ClassB", offset);
+
+  QVERIFY(infoE->inherits("ClassB"));
+  QVERIFY(infoE->findAncestor("ClassB") == infoB);
+  QVERIFY(infoE->castTo(&e, infoB) == static_cast<ClassB*>(&e));
+  QVERIFY(infoE->castTo(&e, "ClassB") == static_cast<ClassB*>(&e));
+  QVERIFY(infoE->castTo(&e, infoE) == &e);
+
+  QVERIFY(_helper->runScript("a = PythonQt.private.ClassE();\nif obj.getClassBPtr(a).getY()==2: obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("a = PythonQt.private.ClassE();\nif a.getY()==2 and a.getE()==5: obj.testNoArg(); obj.setPassed();\n"));
+}
+
 void PythonQtTestSlotCalling::testAutoConversion() {
   QVERIFY(_helper->runScript("if obj.setAutoConvertColor(PythonQt.QtCore.Qt.red)==PythonQt.Qt.QColor(PythonQt.QtCore.Qt.red): obj.setPassed();\n"));
   QVERIFY(_helper->runScript("if obj.setAutoConvertBrush(PythonQt.QtCore.Qt.red)==PythonQt.Qt.QBrush(PythonQt.QtCore.Qt.red): obj.setPassed();\n"));
@@ -189,6 +259,10 @@ void PythonQtTestSlotCalling::testOverloadedCall()
   QVERIFY(_helper->runScript("obj.overload(('test','test2')); obj.setPassed();\n", 4));
   QVERIFY(_helper->runScript("obj.overload(obj); obj.setPassed();\n", 5));
   QVERIFY(_helper->runScript("obj.overload(12,13); obj.setPassed();\n", 6));
+  // failed calls raise PythonQt specific exceptions, which are still ValueErrors
+  QVERIFY(_helper->runScript("try:\n  obj.overload(1,2,3)\nexcept PythonQt.OverloadError as e:\n  if isinstance(e, ValueError) and 'Could not find matching overload' in str(e) and obj.getInt(1)==1: obj.setPassed()\n"));
+  QVERIFY(_helper->runScript("try:\n  obj.getInt([1])\nexcept PythonQt.ConversionError as e:\n  if 'getInt' in str(e) and obj.getInt(1)==1: obj.setPassed()\n"));
+  QVERIFY(_helper->runScript("try:\n  obj.getInt([1])\nexcept PythonQt.ConversionError as e:\n  if type(e.args[0]) is str and 'getInt' in e.args[0] and e.args == (str(e),): obj.setPassed()\n"));
 }
 
 
@@ -273,6 +347,16 @@ void PythonQtTestSlotCalling::testQListSlotCalls()
   QVERIFY(_helper->runScript("if obj.getQListdouble()==(1.1,2.2,3.3): obj.setPassed();\n"));
   QVERIFY(_helper->runScript("if obj.getQListfloat()==(1,2,3): obj.setPassed();\n"));
 
+  // numeric buffers are converted in one pass
+  QVERIFY(_helper->runScript("import array\nif obj.getQVectordouble(array.array('d', (1.5, 2.5)))==(1.5, 2.5): obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("import array\nif obj.getQVectordouble(array.array('i', (1, -2)))==(1.0, -2.0): obj.setPassed();\n"));
+  QVERIFY(_helper->runScript("import array\nif obj.getQListqint64(array.array('h', (1, -2)))==(1, -2): obj.setPassed();\n"));
+#ifdef PY3K
+  QVERIFY(_helper->runScript("PythonQt.Config.setNumericListsAsBuffers(True)\nr = obj.getQVectordouble((1.5, 2.5))\nPythonQt.Config.setNumericListsAsBuffers(False)\nif isinstance(r, memoryview) and r.format=='d' and r.tolist()==[1.5, 2.5]: obj.setPassed();\n"));
+  // a scalar memoryview is not a list
+  QVERIFY(_helper->runScript("try:\n  obj.getQListqint64(memoryview(bytes(8)).cast('q', shape=[]))\nexcept Exception:\n  obj.setPassed()\n"));
+#endif
+
   QVERIFY(_helper->runScript("if obj.getQListDayOfWeek((PythonQt.QtCore.Qt.Monday, PythonQt.QtCore.Qt.Friday))==(PythonQt.QtCore.Qt.Monday, PythonQt.QtCore.Qt.Friday): obj.setPassed();\n"));
 
   QVERIFY(_helper->runScript("if obj.getQPair((1.2, PythonQt.QtGui.QColor(PythonQt.QtCore.Qt.red)))==(1.2, PythonQt.QtGui.QColor(PythonQt.QtCore.Qt.red)): obj.setPassed();\n"));
@@ -283,6 +367,12 @@ void PythonQtTestSlotCalling::testQListSlotCalls()
 
   QVERIFY(_helper->runScript("if obj.getQListQSize()==(PythonQt.QtCore.QSize(1,2), PythonQt.QtCore.QSize(3,4)): obj.setPassed();\n"));
   QVERIFY(_helper->runScript("if obj.getQListQSize((PythonQt.QtCore.QSize(1,2), PythonQt.QtCore.QSize(3,4)))==(PythonQt.QtCore.QSize(1,2), PythonQt.QtCore.QSize(3,4)): obj.setPassed();\n"));
+
+  // container views convert their items on access, but compare like the converted tuples/dicts
+  QVERIFY(_helper->runScript("PythonQt.Config.setContainerViews(True)\nl = obj.getQVariant([1, 'a', 2.5])\nm = obj.getQVariant({'a': 1, 'b': 2})\ns = obj.getQListQSize()\nPythonQt.Config.setContainerViews(False)\n"
+    "if isinstance(l, PythonQt.SequenceView) and len(l)==3 and l[1]=='a' and l[-1]==2.5 and l[1:]==('a', 2.5) and l==(1, 'a', 2.5) and list(l)==[1, 'a', 2.5] and "
+    "isinstance(m, PythonQt.MappingView) and m['a']==1 and 'b' in m and m.get('c') is None and sorted(m)==['a', 'b'] and m=={'a': 1, 'b': 2} and "
+    "s[1]==PythonQt.QtCore.QSize(3,4) and obj.getQVariant(l)==(1, 'a', 2.5): obj.setPassed();\n"));
 }
 
 void PythonQtTestSlotCalling::testQMapSlotCalls()
@@ -300,6 +390,31 @@ void PythonQtTestSlotCalling::testObjectSlotCalls()
   QVERIFY(_helper->runScript("if obj.getQWidget(obj)==obj: obj.setPassed();\n"));
 }
 
+void PythonQtTestSlotCalling::testOperators()
+{
+  PythonQt::priv()->registerCPPClass("PQOperatorObject", nullptr, "private", PythonQtCreateObject<PQOperatorObjectDecorator>, nullptr, nullptr,
+    PythonQt::Type_Add | PythonQt::Type_Subtract | PythonQt::Type_InplaceAdd | PythonQt::Type_InplaceSubtract | PythonQt::Type_RichCompare);
+  PyRun_SimpleString("from PythonQt.private import PQOperatorObject\na = PQOperatorObject(1)\nb = PQOperatorObject(2)\n");
+
+  // same type operands use the overload that was chosen when the operator was looked up
+  QVERIFY(_helper->runScript("obj.testNoArg()\nif a + b == 3 and b - a == 1: obj.setPassed()\n"));
+  PythonQtClassInfo* info = PythonQt::priv()->getClassInfo("PQOperatorObject");
+  QVERIFY(info->operatorSlot(PythonQtClassInfo::Op_Add)._sameTypeOverload != nullptr);
+  QCOMPARE(info->operatorSlot(PythonQtClassInfo::Op_Add)._sameTypeOverload->parameters().at(2).name, QByteArray("PQOperatorObject"));
+  QVERIFY(_helper->runScript("obj.testNoArg()\nif a == PQOperatorObject(1) and not (a == b): obj.setPassed()\n"));
+
+  // other operands use the full overload resolution
+  QVERIFY(_helper->runScript("obj.testNoArg()\nif a + 5 == 1006: obj.setPassed()\n"));
+  QVERIFY(_helper->runScript("obj.testNoArg()\ntry:\n  b - 1\nexcept ValueError:\n  obj.setPassed()\n"));
+
+  // the in-place operator is used if it accepts the operand, otherwise the binary operator
+  QVERIFY(_helper->runScript("obj.testNoArg()\nc = PQOperatorObject(5)\nd = c\nc += 1\nif d.value() == 6 and c.value() == 6: obj.setPassed()\n"));
+  QVERIFY(_helper->runScript("obj.testNoArg()\nc = PQOperatorObject(5)\nc += b\nif c == 7: obj.setPassed()\n"));
+  // without an in-place operator, the binary operator is used
+  QVERIFY(_helper->runScript("obj.testNoArg()\nc = PQOperatorObject(5)\nc -= b\nif c == 3: obj.setPassed()\n"));
+  PyRun_SimpleString("del a, b, c, d\n");
+}
+
 void PythonQtTestSlotCalling::testCppFactory()
 {
   PythonQtTestCppFactory* f = new PythonQtTestCppFactory;
@@ -459,6 +574,94 @@ void PythonQtTestSignalHandler::testRecursiveSignalHandler()
   QVERIFY(_helper->emitSignal1(12));
 }
 
+void PythonQtTestSignalHandler::testSenderDestroyed()
+{
+  PythonQtObjectPtr main = PythonQt::self()->getMainModule();
+  PythonQtTestSignalHandlerHelper* sender1 = new PythonQtTestSignalHandlerHelper(this);
+  PythonQtTestSignalHandlerHelper* sender2 = new PythonQtTestSignalHandlerHelper(this);
+  PythonQt::self()->addObject(main, "sender2", sender2);
+  PyRun_SimpleString("destroyedCount = 0\ndef testSenderDestroyed():\n  global destroyedCount\n  destroyedCount += 1\n");
+  PyRun_SimpleString("def testSender1Signal(a):\n  pass\n");
+  PyRun_SimpleString("def testSender2Signal(a):\n  if a==12: sender2.setPassed();\n");
+  QVERIFY(PythonQt::self()->addSignalHandler(sender1, SIGNAL(intSignal(int)), main, "testSender1Signal"));
+  QVERIFY(PythonQt::self()->addSignalHandler(sender1, SIGNAL(destroyed(QObject*)), main, "testSenderDestroyed"));
+  QVERIFY(PythonQt::self()->addSignalHandler(sender2, SIGNAL(intSignal(int)), main, "testSender2Signal"));
+
+  // the destroyed handler is still called, the other sender keeps its handlers
+  delete sender1;
+  QCOMPARE(main.getVariable("destroyedCount").toInt(), 1);
+  QVERIFY(sender2->emitIntSignal(12));
+
+  QVERIFY(PythonQt::self()->removeSignalHandler(sender2, SIGNAL(intSignal(int)), main, "testSender2Signal"));
+  QVERIFY(!sender2->emitIntSignal(12));
+  main.removeVariable("sender2");
+  delete sender2;
+}
+
+void PythonQtTestSignalHandler::testSenderMovedToThread()
+{
+  PythonQtObjectPtr main = PythonQt::self()->getMainModule();
+  int handlerCount = PythonQt::self()->census().signalHandlers;
+  PythonQtTestSignalHandlerHelper* sender = new PythonQtTestSignalHandlerHelper(this);
+  PyRun_SimpleString("def testMovedSenderSignal1(a):\n  pass\n");
+  PyRun_SimpleString("def testMovedSenderSignal2(a):\n  pass\n");
+  QVERIFY(PythonQt::self()->addSignalHandler(sender, SIGNAL(intSignal(int)), main, "testMovedSenderSignal1"));
+
+  // the handlers are found by their sender, not by its current thread
+  QThread thread;
+  sender->moveToThread(&thread);
+  QVERIFY(PythonQt::self()->addSignalHandler(sender, SIGNAL(intSignal(int)), main, "testMovedSenderSignal2"));
+  QCOMPARE(PythonQt::self()->census().signalHandlers, handlerCount + 2);
+  QVERIFY(PythonQt::self()->removeSignalHandler(sender, SIGNAL(intSignal(int)), main, "testMovedSenderSignal1"));
+  QVERIFY(PythonQt::self()->removeSignalHandler(sender, SIGNAL(intSignal(int)), main, "testMovedSenderSignal2"));
+  QVERIFY(!PythonQt::self()->removeSignalHandler(sender, SIGNAL(intSignal(int)), main, "testMovedSenderSignal1"));
+  QCOMPARE(PythonQt::self()->census().signalHandlers, handlerCount);
+  delete sender;
+}
+
+void PythonQtTestSignalHandler::testHandlersFollowSenderThread()
+{
+#ifdef PY3K
+  PythonQt::self()->setEnableThreadSupport(true);
+  PythonQtObjectPtr main = PythonQt::self()->getMainModule();
+  int handlerCount = PythonQt::self()->census().signalHandlers;
+  PythonQtTestSignalHandlerHelper* sender = new PythonQtTestSignalHandlerHelper(this);
+  main.addObject("threadSender", sender);
+  PyRun_SimpleString("import threading\n"
+                     "def testThreadSenderSignal(a):\n"
+                     "  if threading.current_thread() is not threading.main_thread():\n"
+                     "    threadSender.setPassed()\n");
+  QVERIFY(PythonQt::self()->addSignalHandler(sender, SIGNAL(intSignal(int)), main, "testThreadSenderSignal"));
+  QVERIFY(!sender->emitIntSignal(1));
+
+  QThread thread;
+  thread.start();
+  sender->moveToThread(&thread);
+  // the handler is called in the new thread of the sender, before and after it is moved to its dispatcher
+  for (int i = 0; i < 2; i++) {
+    bool passed = false;
+    {
+      PYTHONQT_ALLOW_THREADS_SCOPE
+      QMetaObject::invokeMethod(sender, "emitIntSignal", Qt::BlockingQueuedConnection, Q_RETURN_ARG(bool, passed), Q_ARG(int, i));
+    }
+    QVERIFY(passed);
+    QCoreApplication::sendPostedEvents();
+  }
+  QCOMPARE(PythonQt::self()->census().signalHandlers, handlerCount + 1);
+
+  QVERIFY(PythonQt::self()->removeSignalHandler(sender, SIGNAL(intSignal(int)), main, "testThreadSenderSignal"));
+  QCOMPARE(PythonQt::self()->census().signalHandlers, handlerCount);
+  main.removeVariable("threadSender");
+  sender->deleteLater();
+  {
+    PYTHONQT_ALLOW_THREADS_SCOPE
+    thread.quit();
+    thread.wait();
+  }
+  PythonQt::self()->setEnableThreadSupport(false);
+#endif
+}
+
 
 void PythonQtTestApi::initTestCase()
 {
@@ -518,6 +721,468 @@ void PythonQtTestApi::testDynamicProperties()
   
 }
 
+void PythonQtTestApi::testMissingAttributes()
+{
+  PythonQtObjectPtr main = PythonQt::self()->getMainModule();
+
+  // the second lookup is answered from the negative cache of the class
+  QVERIFY(!main.evalScript("hasattr(obj, 'missingAttr')", Py_eval_input).toBool());
+  QVERIFY(!main.evalScript("hasattr(obj, 'missingAttr')", Py_eval_input).toBool());
+  QVERIFY(main.evalScript("getattr(obj, 'missingAttr', 42)", Py_eval_input).toInt() == 42);
+
+  // per instance attributes are still found
+  main.evalScript("obj.setProperty('missingAttr', 12)");
+  QVERIFY(main.evalScript("obj.missingAttr", Py_eval_input).toInt() == 12);
+  main.evalScript("obj.setProperty('missingAttr', None)");
+
+  // enough children to use the objectName index
+  QList<QObject*> children;
+  for (int i = 0; i < 20; i++) {
+    QObject* child = new QObject(_helper);
+    child->setObjectName(QString("child%1").arg(i));
+    children << child;
+  }
+  QVERIFY(main.evalScript("obj.child5.objectName", Py_eval_input).toString() == "child5");
+  QVERIFY(!main.evalScript("hasattr(obj, 'missingAttr')", Py_eval_input).toBool());
+  // the index follows renamed and added children
+  children[3]->setObjectName("missingAttr");
+  QVERIFY(main.evalScript("obj.missingAttr.objectName", Py_eval_input).toString() == "missingAttr");
+  QObject* added = new QObject(_helper);
+  added->setObjectName("addedChild");
+  children << added;
+  QVERIFY(main.evalScript("hasattr(obj, 'addedChild')", Py_eval_input).toBool());
+  // replacing a child does not change the number of children, but still updates the index
+  delete children.takeAt(7);
+  QObject* replacement = new QObject(_helper);
+  replacement->setObjectName("replacedChild");
+  children << replacement;
+  QVERIFY(!main.evalScript("hasattr(obj, 'child7')", Py_eval_input).toBool());
+  QVERIFY(main.evalScript("hasattr(obj, 'replacedChild')", Py_eval_input).toBool());
+  qDeleteAll(children);
+  QVERIFY(!main.evalScript("hasattr(obj, 'child5')", Py_eval_input).toBool());
+
+  // the message is rendered when it is needed
+  main.evalScript("def missingAttrMessage():\n  try:\n    obj.missingAttr\n  except AttributeError as e:\n    return str(e)\n");
+  QVERIFY(main.evalScript("missingAttrMessage()", Py_eval_input).toString().contains("has no attribute named 'missingAttr'"));
+  // the arguments of the exception are plain strings
+  main.evalScript("def missingAttrArg():\n  try:\n    obj.missingAttr\n  except AttributeError as e:\n    return isinstance(e.args[0], str) and 'missingAttr' in e.args[0]\n");
+  QVERIFY(main.evalScript("missingAttrArg()", Py_eval_input).toBool());
+}
+
+void PythonQtTestApi::testMethodInfoCache()
+{
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  QString fileName = dir.filePath("methodinfos.cache");
+
+  // make sure that there is at least one parsed signature
+  const char* args[] = { "QString", "int", "const QVariant&" };
+  const PythonQtMethodInfo* info = PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, args);
+  QByteArray buildId = PythonQtMethodInfo::persistentCacheBuildId("test");
+  QVERIFY(PythonQtMethodInfo::savePersistentCache(fileName, buildId));
+
+  QVERIFY(PythonQtMethodInfo::loadPersistentCache(fileName, buildId));
+  QVERIFY(!PythonQtMethodInfo::loadPersistentCache(fileName, PythonQtMethodInfo::persistentCacheBuildId("other")));
+  QVERIFY(!PythonQtMethodInfo::loadPersistentCache(dir.filePath("missing.cache"), buildId));
+
+  // already parsed infos are not replaced by the cache
+  QVERIFY(info == PythonQtMethodInfo::getCachedMethodInfoFromArgumentList(3, args));
+  QCOMPARE(info->parameterCount(), 3);
+  QVERIFY(info->parameters().at(2).isReference);
+  QVERIFY(info->parameters().at(2).isConst);
+}
+
+void PythonQtTestApi::testMetadataMemoryUsage()
+{
+  qint64 before = PythonQt::self()->metadataMemoryUsage();
+  QVERIFY(before > 0);
+  // the lookup caches the member
+  QVERIFY(!_main.evalScript("hasattr(obj, 'metadataMemoryUsageProbe')", Py_eval_input).toBool());
+  QVERIFY(PythonQt::self()->metadataMemoryUsage() > before);
+  QVERIFY(_main.evalScript("PythonQt.Debug.metadataMemoryUsage() > 0", Py_eval_input).toBool());
+}
+
+void PythonQtTestApi::testSharedSlotChains()
+{
+  PythonQtClassInfo* objectInfo = PythonQt::priv()->getClassInfo(&QObject::staticMetaObject);
+  PythonQtClassInfo* helperInfo = PythonQt::priv()->getClassInfo(_helper->metaObject());
+  QVERIFY(objectInfo && helperInfo);
+  // the helper does not add a deleteLater overload, so it uses the slot chain of QObject
+  PythonQtSlotInfo* slot = objectInfo->member("deleteLater")._slot;
+  QVERIFY(slot);
+  QVERIFY(helperInfo->member("deleteLater")._slot == slot);
+
+  // resetting the owner deletes the chain, the subclass has to look it up again
+  objectInfo->setMetaObject(&QObject::staticMetaObject);
+  slot = objectInfo->member("deleteLater")._slot;
+  QVERIFY(slot);
+  QVERIFY(helperInfo->member("deleteLater")._slot == slot);
+
+  // resetting the subclass ends the sharing, so resetting the owner again must not touch the subclass
+  helperInfo->setMetaObject(_helper->metaObject());
+  objectInfo->setMetaObject(&QObject::staticMetaObject);
+  slot = objectInfo->member("deleteLater")._slot;
+  QVERIFY(slot);
+  QVERIFY(helperInfo->member("deleteLater")._slot == slot);
+  QVERIFY(_main.evalScript("callable(obj.deleteLater)", Py_eval_input).toBool());
+}
+
+static int PythonQtTestApi_thunkCalls = 0;
+
+static void PythonQtTestApi_thunkAdd(QObject* o, void** a)
+{
+  PythonQtTestApi_thunkCalls++;
+  int r = static_cast<PythonQtTestThunkDecorator*>(o)->static_QSize_thunkAdd(*reinterpret_cast<int*>(a[1]), *reinterpret_cast<int*>(a[2]));
+  if (a[0]) { *reinterpret_cast<int*>(a[0]) = r; }
+}
+
+void PythonQtTestApi::testSlotThunks()
+{
+  static const PythonQtSlotThunkEntry thunks[] = {
+    { "static_QSize_thunkAdd(int, int)", PythonQtTestApi_thunkAdd },
+    { "static_QSize_missingSlot(int)", PythonQtTestApi_thunkAdd },
+    { nullptr, nullptr }
+  };
+  PythonQt::priv()->registerSlotThunks(&PythonQtTestThunkDecorator::staticMetaObject, thunks);
+  PythonQt::self()->addDecorators(new PythonQtTestThunkDecorator);
+
+  PythonQtTestApi_thunkCalls = 0;
+  QCOMPARE(_main.evalScript("PythonQt.QtCore.QSize.thunkAdd(1, 2)", Py_eval_input).toInt(), 3);
+  QCOMPARE(PythonQtTestApi_thunkCalls, 1);
+  // slots without a thunk are still called through qt_metacall
+  QCOMPARE(_main.evalScript("PythonQt.QtCore.QSize.noThunkAdd(3, 4)", Py_eval_input).toInt(), 7);
+  QCOMPARE(PythonQtTestApi_thunkCalls, 1);
+}
+
+void PythonQtTestApi::testBytecodeCache()
+{
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  QVERIFY(PythonQt::self()->setBytecodeCacheDirectory(dir.filePath("cache")));
+  QCOMPARE(PythonQt::self()->bytecodeCacheDirectory(), QDir(dir.filePath("cache")).absolutePath());
+  QVERIFY(QDir(dir.filePath("cache")).exists());
+
+  // the resource files are read-only, so no pyc file can be written next to them
+  // and the compiled code has to go to the cache directory
+  PythonQt::self()->setImporter(nullptr);
+  QCOMPARE(PythonQt::self()->populateBytecodeCache(QStringList() << ":/bytecodecache"), 2);
+  QString cacheFilename = PythonQtImport::getBytecodeCacheFilename(":/bytecodecache/bytecodecachetest.py", "x = 42\n");
+  QString otherCacheFilename = PythonQtImport::getBytecodeCacheFilename(":/bytecodecache/bytecodecacheother.py", "x = 43\n");
+  QVERIFY(cacheFilename.startsWith(PythonQt::self()->bytecodeCacheDirectory() + "/"));
+  QVERIFY(QFile::exists(cacheFilename));
+  QVERIFY(QFile::exists(otherCacheFilename));
+  QVERIFY(!QFile::exists(":/bytecodecache/bytecodecachetest.pyc"));
+
+  // replace the cached code of the first module by the one of the second module,
+  // the import only sees the difference if it reads the cache file
+  QVERIFY(QFile::remove(cacheFilename));
+  QVERIFY(QFile::copy(otherCacheFilename, cacheFilename));
+  _main.evalScript("import sys\n"
+    "sys.path.insert(0, ':/bytecodecache')\n"
+    "import bytecodecachetest\n"
+    "sys.path.remove(':/bytecodecache')\n");
+  QCOMPARE(_main.evalScript("bytecodecachetest.x", Py_eval_input).toInt(), 43);
+  _main.evalScript("del sys.modules['bytecodecachetest']\ndel bytecodecachetest\n");
+
+  PythonQt::self()->setImporter(_helper);
+  QVERIFY(PythonQt::self()->setBytecodeCacheDirectory(QString()));
+  QVERIFY(PythonQt::self()->bytecodeCacheDirectory().isEmpty());
+}
+
+void PythonQtTestApi::testBytecodeCompiler()
+{
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  QVERIFY(QDir(dir.path()).mkpath("scripts/package"));
+  QFile module(dir.filePath("scripts/package/compilertest.py"));
+  QVERIFY(module.open(QIODevice::WriteOnly));
+  module.write("x = 42\n");
+  module.close();
+  QFile broken(dir.filePath("scripts/broken.py"));
+  QVERIFY(broken.open(QIODevice::WriteOnly));
+  broken.write("def (:\n");
+  broken.close();
+
+  QList<PythonQtCompiledFile> results = PythonQtBytecodeCompiler::compileTree(QStringList() << dir.filePath("scripts"), 2);
+  QCOMPARE(results.size(), 2);
+  int compiled = 0;
+  Q_FOREACH(const PythonQtCompiledFile& result, results) {
+    if (result.sourcePath.endsWith("compilertest.py")) {
+      QVERIFY(result.ok);
+      QCOMPARE(result.cachePath, result.sourcePath + "c");
+      QVERIFY(QFile::exists(result.cachePath));
+      compiled++;
+    } else {
+      QVERIFY(!result.ok);
+      QVERIFY(!result.error.isEmpty());
+    }
+  }
+  QCOMPARE(compiled, 1);
+}
+
+void PythonQtTestApi::testTrace()
+{
+  PythonQtTrace::clear();
+  _main.evalScript("PythonQt.Debug.startTrace(1)");
+  _main.evalScript("obj.setPassed()");
+  _main.evalScript("PythonQt.Debug.stopTrace()");
+  QCOMPARE(PythonQtTrace::categories(), 0);
+
+  QByteArray json = PythonQtTrace::toChromeTraceJson();
+  QVERIFY(QJsonDocument::fromJson(json).isObject());
+  QVERIFY(json.contains("::setPassed()\""));
+  QVERIFY(json.contains("\"ph\":\"E\""));
+
+  PythonQtTrace::clear();
+  QVERIFY(!PythonQtTrace::toChromeTraceJson().contains("setPassed"));
+}
+
+void PythonQtTestApi::testGILStatistics()
+{
+  PythonQtGILStatistics::reset();
+  PythonQtGILStatistics::setEnabled(true);
+  // waitForDone() releases the GIL while waiting
+  QVERIFY(_main.evalScript("PythonQt.ThreadPool.waitForDone()", Py_eval_input).toBool());
+  PythonQtGILStatistics::setEnabled(false);
+
+  QList<PythonQtGILSiteStatistics> sites = PythonQtGILStatistics::topSites();
+  QVERIFY(!sites.isEmpty());
+  QCOMPARE(sites.at(0).site, QByteArray("<allow threads>"));
+  QVERIFY(sites.at(0).acquisitions >= 1);
+  QVERIFY(_main.evalScript("PythonQt.Debug.gilThreadStatistics()[0]['acquisitions'] >= 1", Py_eval_input).toBool());
+  QCOMPARE(_main.evalScript("len(PythonQt.Debug.gilHistogramBounds())", Py_eval_input).toInt(), int(PythonQtGILStatistics::HistogramBuckets));
+
+  PythonQtGILStatistics::reset();
+  QVERIFY(PythonQtGILStatistics::threadStatistics().isEmpty());
+}
+
+static int PythonQtTestApi_censusWrappers(const PythonQtCensus& census, const QByteArray& className)
+{
+  Q_FOREACH(const PythonQtClassCensus& classCensus, census.classes) {
+    if (classCensus.className == className) {
+      return classCensus.wrappers;
+    }
+  }
+  return 0;
+}
+
+void PythonQtTestApi::testCensus()
+{
+  int sizeWrappers = PythonQtTestApi_censusWrappers(PythonQt::self()->census(), "QSize");
+  PythonQt::self()->setWrapperAllocationSampling(1);
+  _main.evalScript("censusSizes = [PythonQt.QtCore.QSize(1,2), PythonQt.QtCore.QSize(3,4), PythonQt.QtCore.QSize(5,6)]");
+  PythonQtCensus census = PythonQt::self()->census();
+  PythonQt::self()->setWrapperAllocationSampling(0);
+
+  QCOMPARE(PythonQtTestApi_censusWrappers(census, "QSize"), sizeWrappers + 3);
+  // obj is wrapped by the test setup
+  QVERIFY(census.wrappers > 0);
+  QVERIFY(!census.classes.isEmpty());
+  QVERIFY(census.classes.at(0).wrappers >= census.classes.last().wrappers);
+  QVERIFY(census.cachedSignatures > 0);
+  QVERIFY(!census.allocationSites.isEmpty());
+  QVERIFY(_main.evalScript("PythonQt.Debug.census()['wrappers'] > 0", Py_eval_input).toBool());
+
+  _main.evalScript("del censusSizes");
+  QCOMPARE(PythonQtTestApi_censusWrappers(PythonQt::self()->census(), "QSize"), sizeWrappers);
+}
+
+void PythonQtTestApi::testCallRecorder()
+{
+  PythonQtCallRecorder::clear();
+  PythonQtCallRecorder::start();
+  _main.evalScript("PythonQt.Debug.setWrapperAllocationSampling(0)");
+  PythonQtCallRecorder::stop();
+  _main.evalScript("PythonQt.Debug.setWrapperAllocationSampling(0)");
+
+  QList<PythonQtRecordedCall> calls = PythonQtCallRecorder::calls();
+  QCOMPARE(calls.size(), 1);
+  QCOMPARE(calls.at(0).kind, PythonQtRecordedCall::SlotCall);
+  QCOMPARE(calls.at(0).signature(), QByteArray("setWrapperAllocationSampling(int)"));
+  QCOMPARE(calls.at(0).arguments, QVariantList() << 0);
+
+  QTemporaryDir dir;
+  QString fileName = dir.path() + "/calls.rec";
+  QVERIFY(PythonQtCallRecorder::save(fileName));
+  QList<PythonQtRecordedCall> loaded;
+  QVERIFY(PythonQtCallRecorder::load(fileName, loaded));
+  QCOMPARE(loaded.size(), 1);
+  QCOMPARE(loaded.at(0).signature(), calls.at(0).signature());
+  QCOMPARE(loaded.at(0).arguments, calls.at(0).arguments);
+
+  QList<PythonQtReplayStatistics> statistics = PythonQtCallReplay::replay(loaded, 3);
+  QCOMPARE(statistics.size(), 1);
+  QCOMPARE(statistics.at(0).calls, 3);
+  QCOMPARE(statistics.at(0).failures, 0);
+  PythonQtCallRecorder::clear();
+}
+
+void PythonQtTestApi::testStartupProfile()
+{
+  bool foundInit = false;
+  Q_FOREACH(const PythonQtStartupPhase& phase, PythonQtStartupProfile::phases()) {
+    if (phase.name == "PythonQt::init") {
+      foundInit = phase.depth == 0;
+    }
+  }
+  QVERIFY(foundInit);
+  QVERIFY(_main.evalScript("len(PythonQt.Debug.startupPhases()) > 0", Py_eval_input).toBool());
+
+#if PY_VERSION_HEX >= 0x03070000
+  PythonQt::self()->setDeferredClassRegistration(true);
+  PythonQt::priv()->beginDeferredRegistration();
+  PythonQt::self()->registerCPPClass("PQDeferredTestClass", nullptr, "DeferredTest");
+  PythonQt::priv()->endDeferredRegistration();
+  QCOMPARE(PythonQt::self()->deferredClassCount(), 1);
+
+  QVERIFY(_main.evalScript("PythonQt.DeferredTest.PQDeferredTestClass is not None", Py_eval_input).toBool());
+  QCOMPARE(PythonQt::self()->deferredClassCount(), 0);
+  QVERIFY(PythonQt::self()->usedClasses().contains("PQDeferredTestClass"));
+  QVERIFY(PythonQt::priv()->getClassInfo("PQDeferredTestClass")->pythonQtClassWrapper() != nullptr);
+  PythonQt::self()->setDeferredClassRegistration(false);
+#endif
+}
+
+void PythonQtTestApi::testDeferredDecref()
+{
+#if defined(PYTHONQT_GIL_SUPPORT) && defined(PY3K)
+  PythonQt::self()->setEnableThreadSupport(true);
+  PyObject* object = PyList_New(0);
+  PythonQtSafeObjectPtr* ptr = new PythonQtSafeObjectPtr(object);
+  const Py_ssize_t refCount = Py_REFCNT(object);
+  const int pending = PythonQtDeferredDecref::pendingCount();
+  const qint64 total = PythonQtDeferredDecref::totalCount();
+
+  // the worker thread does not hold the GIL, so it only queues the decref
+  QThread thread;
+  QObject::connect(&thread, &QThread::started, [ptr]() { delete ptr; });
+  thread.start();
+  QVERIFY(thread.wait(5000));
+  QCOMPARE(Py_REFCNT(object), refCount);
+  QCOMPARE(PythonQtDeferredDecref::pendingCount(), pending + 1);
+  QCOMPARE(PythonQtDeferredDecref::totalCount(), total + 1);
+  QVERIFY(PythonQtDeferredDecref::maxPendingCount() >= pending + 1);
+
+  // the next GIL scope does the decref
+  {
+    PYTHONQT_GIL_SCOPE
+  }
+  QCOMPARE(Py_REFCNT(object), refCount - 1);
+  QCOMPARE(PythonQtDeferredDecref::pendingCount(), 0);
+  QCOMPARE(PythonQtDeferredDecref::totalCount(), total + 1);
+  Py_DECREF(object);
+  PythonQt::self()->setEnableThreadSupport(false);
+#endif
+}
+
+PythonQtShell_PQDynamicObject::~PythonQtShell_PQDynamicObject()
+{
+  PythonQtPrivate* priv = PythonQt::priv();
+  if (priv) { priv->shellClassDeleted(this); }
+}
+
+const QMetaObject* PythonQtShell_PQDynamicObject::metaObject() const
+{
+  if (_wrapper) {
+    return PythonQt::priv()->getDynamicMetaObject(_wrapper, &PQDynamicObject::staticMetaObject);
+  } else {
+    return &PQDynamicObject::staticMetaObject;
+  }
+}
+
+int PythonQtShell_PQDynamicObject::qt_metacall(QMetaObject::Call call, int id, void** args)
+{
+  int result = PQDynamicObject::qt_metacall(call, id, args);
+  return result >= 0 ? PythonQt::priv()->handleMetaCall(this, _wrapper, call, id, args) : result;
+}
+
+void PythonQtTestApi::testDynamicQObjectSubclass()
+{
+  PythonQt::self()->registerClass(&PQDynamicObject::staticMetaObject, NULL, PythonQtCreateObject<PQDynamicObjectDecorator>,
+    PythonQtSetInstanceWrapperOnShell<PythonQtShell_PQDynamicObject>);
+  _main.evalScript("from PythonQt import QtCore\n"
+    "class PyDynamicObject(PythonQt.private.PQDynamicObject):\n"
+    "  def __init__(self):\n"
+    "    PythonQt.private.PQDynamicObject.__init__(self)\n"
+    "    self._value = 1\n"
+    "  @QtCore.Slot(int, result=int)\n"
+    "  def twice(self, v):\n"
+    "    return 2*v\n"
+    "  def getValue(self):\n"
+    "    return self._value\n"
+    "  def setValue(self, v):\n"
+    "    self._value = v\n"
+    "  value = QtCore.Property(int, getValue, setValue)\n"
+    "dynamicObject = PyDynamicObject()\n");
+  QObject* object = qvariant_cast<QObject*>(_main.getVariable("dynamicObject"));
+  QVERIFY(object);
+  QVERIFY(object->metaObject() != &PQDynamicObject::staticMetaObject);
+  QVERIFY(object->metaObject()->indexOfSlot("twice(int)") >= 0);
+  QVERIFY(object->metaObject()->indexOfProperty("value") >= 0);
+
+  // the second call uses the function that was cached by the first one
+  int result = 0;
+  QVERIFY(QMetaObject::invokeMethod(object, "twice", Q_RETURN_ARG(int, result), Q_ARG(int, 21)));
+  QCOMPARE(result, 42);
+  QVERIFY(QMetaObject::invokeMethod(object, "twice", Q_RETURN_ARG(int, result), Q_ARG(int, 5)));
+  QCOMPARE(result, 10);
+
+  // changing the class invalidates the cached function
+  _main.evalScript("PyDynamicObject.twice = lambda self, v: 3*v\n");
+  QVERIFY(QMetaObject::invokeMethod(object, "twice", Q_RETURN_ARG(int, result), Q_ARG(int, 5)));
+  QCOMPARE(result, 15);
+
+  QCOMPARE(object->property("value").toInt(), 1);
+  QVERIFY(object->setProperty("value", 7));
+  QCOMPARE(object->property("value").toInt(), 7);
+  QCOMPARE(_main.evalScript("dynamicObject._value", Py_eval_input).toInt(), 7);
+
+  _main.evalScript("del dynamicObject\n");
+}
+
+void PythonQtTestApi::testAsyncioEventLoop()
+{
+#ifdef PY3K
+  QVERIFY(PythonQt::self()->installAsyncioEventLoop());
+  // the task is run by the Qt event loop
+  _main.evalScript("import asyncio\n"
+    "asyncioResult = 0\n"
+    "async def asyncioTest():\n"
+    "  global asyncioResult\n"
+    "  await asyncio.sleep(0.01)\n"
+    "  asyncioResult = 42\n"
+    "asyncioTask = asyncio.get_event_loop().create_task(asyncioTest())\n");
+  QTRY_COMPARE(_main.getVariable("asyncioResult").toInt(), 42);
+  QVERIFY(_main.evalScript("asyncioTask.done()", Py_eval_input).toBool());
+
+  // the loop is not reported as running outside of its iterations
+  QCOMPARE(_main.evalScript("asyncio.get_event_loop().run_until_complete(asyncio.sleep(0.01, result=7))", Py_eval_input).toInt(), 7);
+  _main.evalScript("del asyncioTask");
+#endif
+}
+
+void PythonQtTestApi::testThreadPool()
+{
+#ifdef PY3K
+  PythonQt::self()->setEnableThreadSupport(true);
+  _main.evalScript("import time\npoolFuture = PythonQt.ThreadPool.submit(lambda a, b: a + b, (2, 3))\n");
+  QVERIFY(_main.evalScript("PythonQt.ThreadPool.waitForDone()", Py_eval_input).toBool());
+  // the future is resolved by the event loop of the submitting thread
+  QTRY_VERIFY(_main.evalScript("poolFuture.done()", Py_eval_input).toBool());
+  QCOMPARE(_main.evalScript("poolFuture.result()", Py_eval_input).toInt(), 5);
+
+  // the callables that did not start are cancelled when the pool is deleted
+  PythonQtThreadPoolAPI* pool = new PythonQtThreadPoolAPI(nullptr);
+  pool->setMaxThreadCount(1);
+  _main.addObject("testPool", pool);
+  _main.evalScript("runningFuture = testPool.submit(time.sleep, (0.2,))\npendingFuture = testPool.submit(time.sleep, (0,))\n");
+  delete pool;
+  QVERIFY(_main.evalScript("pendingFuture.cancelled()", Py_eval_input).toBool());
+  QTRY_VERIFY(_main.evalScript("runningFuture.done() and not runningFuture.cancelled()", Py_eval_input).toBool());
+  _main.evalScript("del poolFuture, runningFuture, pendingFuture, testPool");
+  PythonQt::self()->setEnableThreadSupport(false);
+#endif
+}
 
 bool PythonQtTestApiHelper::call(const QString& function, const QVariantList& args, const QVariant& expectedResult) {
   _passed = false;
@@ -541,6 +1206,38 @@ void PythonQtTestApi::testCall()
   QVariant r = PythonQt::self()->call(PythonQt::self()->getMainModule(), "testCall2", QVariantList() << QVariant("test") << QVariant::fromValue((QObject*)_helper));
   QObject* p = qvariant_cast<QObject*>(r);
   QVERIFY(p==_helper);
+
+  PyRun_SimpleString("def testCallTyped(a, b, c):\n return '%s %d %g' % (a, b, c)\n");
+  PythonQtCallable<QString(const QString&, int, double)> typed(PythonQt::self()->getMainModule(), "testCallTyped");
+  QVERIFY(typed.isValid());
+  QCOMPARE(typed("x", 2, 1.5), QString("x 2 1.5"));
+
+  PyRun_SimpleString("def testCallTypedObject(o):\n return o\n");
+  PythonQtCallable<QObject*(QObject*)> typedObject(PythonQt::self()->getMainModule(), "testCallTypedObject");
+  QVERIFY(typedObject(_helper) == _helper);
+  bool ok = true;
+  PythonQtCallable<int(const QString&)> typedBadResult(PythonQt::self()->getMainModule(), "testCallTypedObject");
+  typedBadResult.call(&ok, "no int");
+  QVERIFY(!ok);
+  // a wrapper of a different class is not converted
+  ok = true;
+  PythonQtCallable<PythonQtTestApiHelper*(QObject*)> typedWrongClass(PythonQt::self()->getMainModule(), "testCallTypedObject");
+  QVERIFY(typedWrongClass.call(&ok, this) == nullptr);
+  QVERIFY(!ok);
+
+  PyRun_SimpleString("def testCallBatch(a):\n return 10 // a\n");
+  QVector<QVariantList> batchArgs;
+  batchArgs << (QVariantList() << 1) << (QVariantList() << 0) << (QVariantList() << 5);
+  QVector<QVariant> batchResults;
+  QStringList batchErrors;
+  PythonQtObjectPtr batchCallable = PythonQt::self()->lookupCallable(main, "testCallBatch");
+  QCOMPARE(batchCallable.callBatch(batchArgs, batchResults, &batchErrors, 2), 2);
+  QCOMPARE(batchResults.size(), 3);
+  QCOMPARE(batchResults.at(0).toInt(), 10);
+  QVERIFY(!batchResults.at(1).isValid());
+  QCOMPARE(batchResults.at(2).toInt(), 2);
+  QVERIFY(batchErrors.at(0).isEmpty());
+  QVERIFY(batchErrors.at(1).startsWith("ZeroDivisionError"));
 }
 
 void PythonQtTestApi::testVariables()
@@ -666,10 +1363,58 @@ void PythonQtTestApi::testRedirect()
   connect(PythonQt::self(), SIGNAL(pythonStdOut(const QString&)), _helper, SLOT(stdOut(const QString&)));
   connect(PythonQt::self(), SIGNAL(pythonStdErr(const QString&)), _helper, SLOT(stdErr(const QString&)));
   PyRun_SimpleString("print('test')\n");
+
+  // with line buffering, the fragments of a line arrive as one string
+  PythonQt::self()->setRedirectFlushPolicy(PythonQt::RedirectFlushOnNewline);
+  _helper->_stdOutput.clear();
+  PyRun_SimpleString("import sys\nsys.stdout.write('a')\nsys.stdout.write(' b\\n')\nsys.stdout.write('incomplete')\n");
+  QCOMPARE(_helper->_stdOutput, QStringList() << "a b\n");
+  PyRun_SimpleString("sys.stdout.flush()\n");
+  QCOMPARE(_helper->_stdOutput, QStringList() << "a b\n" << "incomplete");
+
+  // the buffer size only matters with RedirectFlushOnSize
+  PythonQt::self()->setRedirectFlushPolicy(PythonQt::RedirectFlushOnNewline, 8);
+  _helper->_stdOutput.clear();
+  PyRun_SimpleString("sys.stdout.write('0123456789')\n");
+  QVERIFY(_helper->_stdOutput.isEmpty());
+  PyRun_SimpleString("sys.stdout.write('\\n')\n");
+  QCOMPARE(_helper->_stdOutput, QStringList() << "0123456789\n");
+  PythonQt::self()->setRedirectFlushPolicy(PythonQt::RedirectFlushOnSize, 8);
+  _helper->_stdOutput.clear();
+  PyRun_SimpleString("sys.stdout.write('abc')\n");
+  QVERIFY(_helper->_stdOutput.isEmpty());
+  PyRun_SimpleString("sys.stdout.write('defgh')\n");
+  QCOMPARE(_helper->_stdOutput, QStringList() << "abcdefgh");
+
+  // the flush timer passes the text on without another write
+  PythonQt::self()->setRedirectFlushPolicy(PythonQt::RedirectFlushOnInterval, 4096, 20);
+  _helper->_stdOutput.clear();
+  PyRun_SimpleString("sys.stdout.write('x')\n");
+  QVERIFY(_helper->_stdOutput.isEmpty());
+  QTRY_COMPARE(_helper->_stdOutput, QStringList() << "x");
+
+  // each thread has its own buffer, the lines of a worker thread are not mixed with the main thread
+  PythonQt::self()->setRedirectFlushPolicy(PythonQt::RedirectFlushOnNewline);
+  _helper->_stdOutput.clear();
+  PyRun_SimpleString("import threading\n"
+                     "sys.stdout.write('main ')\n"
+                     "def redirectWorker():\n"
+                     "  sys.stdout.write('worker ')\n"
+                     "  sys.stdout.write('line\\n')\n"
+                     "redirectThread = threading.Thread(target=redirectWorker)\n"
+                     "redirectThread.start()\n"
+                     "redirectThread.join()\n"
+                     "del redirectThread\n");
+  // the signal of the worker thread is queued
+  QTRY_COMPARE(_helper->_stdOutput, QStringList() << "worker line\n");
+  PyRun_SimpleString("sys.stdout.write('line\\n')\n");
+  QCOMPARE(_helper->_stdOutput, QStringList() << "worker line\n" << "main line\n");
+  PythonQt::self()->setRedirectFlushPolicy(PythonQt::RedirectUnbuffered);
 }
 
 void PythonQtTestApiHelper::stdOut(const QString& s)
 {
+  _stdOutput << s;
   qDebug() << s;
 }
 
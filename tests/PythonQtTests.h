@@ -68,6 +68,7 @@ private Q_SLOTS:
   void testSeveralCleanup();
   void testInitWithPreconfig();
   void testInitAlreadyInitialized();
+  void testMethodInfoCacheRoundTrip();
 };
 
 //! test the PythonQt api
@@ -87,6 +88,22 @@ private Q_SLOTS:
 
   void testProperties();
   void testDynamicProperties();
+  void testMissingAttributes();
+  void testMethodInfoCache();
+  void testMetadataMemoryUsage();
+  void testSharedSlotChains();
+  void testSlotThunks();
+  void testBytecodeCache();
+  void testBytecodeCompiler();
+  void testTrace();
+  void testGILStatistics();
+  void testCensus();
+  void testCallRecorder();
+  void testStartupProfile();
+  void testAsyncioEventLoop();
+  void testThreadPool();
+  void testDeferredDecref();
+  void testDynamicQObjectSubclass();
   
 private:
   PythonQtTestApiHelper* _helper;
@@ -128,6 +145,22 @@ private:
   virtual int type() { return 4; }
 };
 
+class ClassEBase {
+public:
+  ClassEBase() { e0 = 0; }
+  virtual ~ClassEBase() {}
+  int e0;
+};
+
+//! ClassB is not the primary base, so its upcasting offset is not zero
+class ClassE : public ClassEBase, public ClassB {
+public:
+  ClassE() { e = 5; }
+  int e;
+
+  virtual int type() { return 5; }
+};
+
 class ClassAWrapper : public QObject {
   Q_OBJECT
 public Q_SLOTS:
@@ -155,6 +188,39 @@ class ClassDWrapper : public QObject {
       ClassD* new_ClassD() { return new ClassD; }
 };
 
+class ClassEWrapper : public QObject {
+  Q_OBJECT
+public Q_SLOTS:
+  ClassE* new_ClassE() { return new ClassE; }
+  int getE(ClassE* o) { return o->e; }
+};
+
+//! base class for Python subclasses that add slots and properties
+class PQDynamicObject : public QObject {
+  Q_OBJECT
+public:
+  PQDynamicObject(QObject* parent = nullptr):QObject(parent) {}
+};
+
+//! shell of PQDynamicObject, it redirects the meta object and meta calls to Python like the generated shell classes
+class PythonQtShell_PQDynamicObject : public PQDynamicObject
+{
+public:
+  PythonQtShell_PQDynamicObject(QObject* parent = nullptr):PQDynamicObject(parent),_wrapper(nullptr) {}
+  ~PythonQtShell_PQDynamicObject();
+
+  const QMetaObject* metaObject() const;
+  int qt_metacall(QMetaObject::Call call, int id, void** args);
+  PythonQtInstanceWrapper* _wrapper;
+};
+
+class PQDynamicObjectDecorator : public QObject {
+  Q_OBJECT
+public Q_SLOTS:
+  PQDynamicObject* new_PQDynamicObject(QObject* parent = nullptr) { return new PythonQtShell_PQDynamicObject(parent); }
+  void delete_PQDynamicObject(PQDynamicObject* o) { delete o; }
+};
+
 
 //! test the PythonQt api (helper)
 class PythonQtTestApiHelper : public QObject , public PythonQtImportFileInterface
@@ -184,11 +250,24 @@ public Q_SLOTS:
   void stdOut(const QString&);
   void stdErr(const QString&);
 
+public:
+  //! the text that was passed to stdOut()
+  QStringList _stdOutput;
+
 private:
   bool _passed;
 };
 
 
+//! decorator whose first slot is called through a registered slot thunk
+class PythonQtTestThunkDecorator : public QObject
+{
+  Q_OBJECT
+public Q_SLOTS:
+  int static_QSize_thunkAdd(int a, int b) { return a + b; }
+  int static_QSize_noThunkAdd(int a, int b) { return a + b; }
+};
+
 // test implementation of the wrapper factory
 class PythonQtTestCppFactory : public PythonQtCppWrapperFactory 
 {
@@ -264,6 +343,37 @@ public Q_SLOTS:
 
 };
 
+//! a cpp object with operators that is wrapped by decorators only
+class PQOperatorObject {
+
+public:
+  PQOperatorObject(int value) { _value = value; }
+
+  int value() const { return _value; }
+  void setValue(int value) { _value = value; }
+
+private:
+  int _value;
+};
+
+class PQOperatorObjectDecorator : public QObject {
+  Q_OBJECT
+
+public Q_SLOTS:
+  PQOperatorObject* new_PQOperatorObject(int value) { return new PQOperatorObject(value); }
+  void delete_PQOperatorObject(PQOperatorObject* obj) { delete obj; }
+
+  int value(PQOperatorObject* obj) { return obj->value(); }
+
+  // the int overload comes first, but it can't take a wrapped object, so the same type overload is still used directly
+  int __add__(PQOperatorObject* obj, int other) { return obj->value() + other + 1000; }
+  int __add__(PQOperatorObject* obj, PQOperatorObject* other) { return obj->value() + other->value(); }
+  int __sub__(PQOperatorObject* obj, PQOperatorObject* other) { return obj->value() - other->value(); }
+  bool __eq__(PQOperatorObject* obj, PQOperatorObject* other) { return obj->value() == other->value(); }
+  // only int operands are added in place, there is no in-place subtraction
+  PQOperatorObject* __iadd__(PQOperatorObject* obj, int other) { obj->setValue(obj->value() + other); return obj; }
+};
+
 
 //! an cpp object that is to be wrapped by decorators only
 class PQCppObject2 {
@@ -340,7 +450,9 @@ private Q_SLOTS:
   void testOverloadedCall();
   void testKeywordCall();
   void testCppFactory();
+  void testOperators();
   void testInheritance();
+  void testLateParentClassWithOffset();
   void testAutoConversion();
   void testProperties();
 
@@ -454,6 +566,8 @@ public Q_SLOTS:
   QList<double> getQListdouble() { _called = true; return QList<double>() << 1.1 << 2.2 << 3.3; }
   QList<quint64> getQListquint64() { _called = true; return QList<quint64>() << 1 << 2 << 3; }
   QList<qint64> getQListqint64() { _called = true; return QList<qint64>() << 1 << 2 << 3; }
+  QVector<double> getQVectordouble(const QVector<double>& list) { _called = true; return list; }
+  QList<qint64> getQListqint64(const QList<qint64>& list) { _called = true; return list; }
   //QList<GLuint64> getQListGLuint64() { _called = true; return QList<GLuint64>() << 1 << 2 << 3; }
   //QList<GLuint> getQListGLuint() { _called = true; return QList<GLuint>() << 1 << 2 << 3; }
 
@@ -565,6 +679,9 @@ private Q_SLOTS:
 
   void testSignalHandler();
   void testRecursiveSignalHandler();
+  void testSenderDestroyed();
+  void testSenderMovedToThread();
+  void testHandlersFollowSenderThread();
 
 private:
   PythonQtTestSignalHandlerHelper* _helper;
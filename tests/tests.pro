@@ -30,3 +30,6 @@ HEADERS +=                    \
 SOURCES +=                    \
   PythonQtTestMain.cpp        \
   PythonQtTests.cpp
+
+RESOURCES +=                  \
+  PythonQtTests.qrc